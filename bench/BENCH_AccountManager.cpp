@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+#include "../inc/AccountIndex.hpp"
+#include "../inc/AccountManager.hpp"
+
+// Benchmark arguments: book size (10 .. 10M) and injected service latency in microseconds.
+// Books are provisioned with createAccounts, MAX_ACCOUNTS_PER_USER accounts per owner.
+
+namespace {
+
+const long MIN_BOOK_SIZE = 10;
+const long MAX_BOOK_SIZE = 10000000;
+
+std::vector<std::string> populate(AccountManager& manager, long count) {
+    std::vector<double> balances(static_cast<std::size_t>(count));
+    std::vector<std::uint32_t> ownerIds(static_cast<std::size_t>(count));
+    for (long i = 0; i < count; ++i) {
+        balances[i] = 100.0 + i % 1000;
+        ownerIds[i] = static_cast<std::uint32_t>(i / AccountManager::getMaxAccountsPerUser());
+    }
+    return manager.createAccounts(balances.size(), AccountType::CHECKING, balances.data(), ownerIds.data());
+}
+
+void applyBookSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"accounts", "latency_us"});
+    for (long size = MIN_BOOK_SIZE; size <= MAX_BOOK_SIZE; size *= 10) {
+        benchmark->Args({size, 0});
+    }
+    benchmark->Args({MIN_BOOK_SIZE, 20});
+}
+
+} // namespace
+
+// ============================================================================
+// Method: createAccount() / createAccounts()
+// ============================================================================
+
+static void BM_AccountManager_createAccount(benchmark::State& state) {
+    const long count = state.range(0);
+    long created = 0;
+    for (auto _ : state) {
+        AccountManager manager;
+        for (long i = 0; i < count; ++i) {
+            const std::uint32_t ownerId = static_cast<std::uint32_t>(i / AccountManager::getMaxAccountsPerUser());
+            created += manager.createAccount(AccountType::CHECKING, 100.0 + i % 1000, ownerId).empty() ? 0 : 1;
+        }
+    }
+    state.SetItemsProcessed(created);
+    state.counters["accounts"] = static_cast<double>(count);
+}
+BENCHMARK(BM_AccountManager_createAccount)->ArgName("accounts")->RangeMultiplier(10)->Range(MIN_BOOK_SIZE, MAX_BOOK_SIZE)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_AccountManager_createAccounts(benchmark::State& state) {
+    const long count = state.range(0);
+    long created = 0;
+    for (auto _ : state) {
+        AccountManager manager;
+        std::vector<std::string> accountNumbers = populate(manager, count);
+        created += static_cast<long>(accountNumbers.size());
+        benchmark::DoNotOptimize(accountNumbers.data());
+    }
+    state.SetItemsProcessed(created);
+    state.counters["accounts"] = static_cast<double>(count);
+}
+BENCHMARK(BM_AccountManager_createAccounts)->ArgName("accounts")->RangeMultiplier(10)->Range(MIN_BOOK_SIZE, MAX_BOOK_SIZE)
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Method: getAccount()
+// ============================================================================
+
+static void BM_AccountManager_getAccount(benchmark::State& state) {
+    AccountManager manager;
+    std::vector<std::string> accountNumbers = populate(manager, state.range(0));
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.getAccount(accountNumbers[next]));
+        next = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["accounts"] = static_cast<double>(manager.getAccountCount());
+}
+BENCHMARK(BM_AccountManager_getAccount)->ArgName("accounts")->RangeMultiplier(10)->Range(MIN_BOOK_SIZE, MAX_BOOK_SIZE);
+
+static void BM_AccountIndex_find(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    AccountIndex index;
+    index.reserve(static_cast<std::size_t>(count));
+    for (int i = 0; i < count; ++i) {
+        index.insert(500001 + i, Account{std::string(), AccountType::CHECKING, AccountStatus::ACTIVE,
+                                         100.0, 0.0, 0, false, false});
+    }
+
+    // Stride through the ids so large books miss the cache the way random lookups do
+    std::uint64_t cursor = 0;
+    for (auto _ : state) {
+        cursor = (cursor + 7919) % static_cast<std::uint64_t>(count);
+        benchmark::DoNotOptimize(index.find(500001 + static_cast<int>(cursor)));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AccountIndex_find)->ArgName("accounts")->RangeMultiplier(10)->Range(MIN_BOOK_SIZE, MAX_BOOK_SIZE);
+
+// ============================================================================
+// Method: evaluateAccountRisk()
+// ============================================================================
+
+static void BM_AccountManager_evaluateAccountRisk(benchmark::State& state) {
+    StubExternalDataService dataService{std::chrono::microseconds(state.range(1))};
+    AccountManager manager;
+    manager.setExternalDataService(&dataService);
+    std::vector<std::string> accountNumbers = populate(manager, state.range(0));
+
+    // Low-risk inputs keep every account ACTIVE so each iteration takes the same path
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(manager.evaluateAccountRisk(accountNumbers[next], 10, 5000.0));
+        next = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["accounts"] = static_cast<double>(manager.getAccountCount());
+}
+BENCHMARK(BM_AccountManager_evaluateAccountRisk)->Apply(applyBookSizes);
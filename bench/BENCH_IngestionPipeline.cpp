@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+#include "../inc/AccountSymbolTable.hpp"
+#include "../inc/IngestionPipeline.hpp"
+#include "../inc/TransactionHistory.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// Benchmark argument: number of rows per ingestion. The services are zero-latency stubs, so the
+// measurement is the parse, queue hand-off and execution cost per row. Refunds are not daily
+// limited, so every row stays on the accepted path. Rates are per wall-clock second, the stages
+// running on their own threads.
+
+namespace {
+
+const long MIN_ROW_COUNT = 10000;
+const long MAX_ROW_COUNT = 1000000;
+const std::size_t BENCH_ACCOUNT_COUNT = 10000;
+
+std::string makeCsv(std::size_t rowCount, const std::vector<std::string>& accountNumbers) {
+    std::string csv = "type,amount,source,destination\n";
+    for (std::size_t i = 0; i < rowCount; ++i) {
+        csv += "REFUND,";
+        csv += std::to_string(10 + i % 900);
+        csv += ".25,";
+        csv += accountNumbers[i % accountNumbers.size()];
+        csv += ",\n";
+    }
+    return csv;
+}
+
+std::string makeRecords(std::size_t rowCount, const std::vector<std::string>& accountNumbers) {
+    AccountSymbolTable symbols;
+    std::string records(rowCount * sizeof(TransactionHistoryRecord), '\0');
+    for (std::size_t i = 0; i < rowCount; ++i) {
+        const Transaction transaction{static_cast<int>(i), TransactionType::REFUND,
+                                      Money::fromCents(1000 + static_cast<std::int64_t>(i % 90000)),
+                                      symbols.intern(accountNumbers[i % accountNumbers.size()]),
+                                      symbols.intern(""), 0, TransactionStatus::COMPLETED};
+        TransactionHistoryRecord record;
+        TransactionHistory::toRecord(transaction, symbols, record);
+        std::memcpy(&records[i * sizeof(TransactionHistoryRecord)], &record, sizeof(record));
+    }
+    return records;
+}
+
+} // namespace
+
+// ============================================================================
+// Method: ingest()
+// ============================================================================
+
+static void runIngest(benchmark::State& state, IngestionFormat format) {
+    StubComplianceCheckService complianceService;
+    StubAuditLoggingService auditService;
+    StubRateLimitingService rateLimitingService;
+    TransactionProcessor processor;
+    processor.setComplianceService(&complianceService);
+    processor.setAuditService(&auditService);
+    processor.setRateLimitingService(&rateLimitingService);
+    processor.setTransactionLogSink(nullptr);
+    IngestionPipeline pipeline(processor);
+
+    const std::size_t rowCount = static_cast<std::size_t>(state.range(0));
+    const std::vector<std::string> accountNumbers = makeAccountNumbers(BENCH_ACCOUNT_COUNT);
+    const std::string input = format == IngestionFormat::CSV ? makeCsv(rowCount, accountNumbers)
+                                                             : makeRecords(rowCount, accountNumbers);
+
+    IngestionReport report{};
+    for (auto _ : state) {
+        report = pipeline.ingest(input.data(), input.size(), format);
+        benchmark::DoNotOptimize(report.rowCount);
+    }
+    for (std::size_t i = 0; i < INGESTION_QUEUE_COUNT; ++i) {
+        state.counters["peak_depth_" + std::to_string(i)] = static_cast<double>(report.peakQueueDepths[i]);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long>(report.rowCount));
+}
+
+static void BM_IngestionPipeline_ingest_Csv(benchmark::State& state) {
+    runIngest(state, IngestionFormat::CSV);
+}
+BENCHMARK(BM_IngestionPipeline_ingest_Csv)->ArgName("rows")->RangeMultiplier(10)->Range(MIN_ROW_COUNT, MAX_ROW_COUNT)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_IngestionPipeline_ingest_Binary(benchmark::State& state) {
+    runIngest(state, IngestionFormat::BINARY);
+}
+BENCHMARK(BM_IngestionPipeline_ingest_Binary)->ArgName("rows")->RangeMultiplier(10)->Range(MIN_ROW_COUNT, MAX_ROW_COUNT)
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,59 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+#include "../inc/TokenBucketRateLimiter.hpp"
+
+// Benchmark arguments: number of distinct accounts the checks are spread over (10 .. 1M). The
+// buckets refill far faster than they are drained, so every check takes the accepted path; the
+// threaded variants share one limiter to show the cost of CAS contention.
+
+namespace {
+
+const long MIN_ACCOUNT_COUNT = 10;
+const long MAX_ACCOUNT_COUNT = 1000000;
+
+TokenBucketRateLimiter& sharedLimiter() {
+    static TokenBucketRateLimiter limiter(1000, 1e9, static_cast<std::size_t>(MAX_ACCOUNT_COUNT));
+    return limiter;
+}
+
+} // namespace
+
+// ============================================================================
+// Method: incrementRateCounter()
+// ============================================================================
+
+static void BM_TokenBucketRateLimiter_incrementRateCounter(benchmark::State& state) {
+    TokenBucketRateLimiter& limiter = sharedLimiter();
+    std::vector<std::string> accountNumbers = makeAccountNumbers(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t next = static_cast<std::size_t>(state.thread_index()) % accountNumbers.size();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(limiter.incrementRateCounter(accountNumbers[next]));
+        next = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TokenBucketRateLimiter_incrementRateCounter)
+    ->ArgName("accounts")->RangeMultiplier(100)->Range(MIN_ACCOUNT_COUNT, MAX_ACCOUNT_COUNT)->ThreadRange(1, 4);
+
+// ============================================================================
+// Method: checkRateLimit()
+// ============================================================================
+
+static void BM_TokenBucketRateLimiter_checkRateLimit(benchmark::State& state) {
+    TokenBucketRateLimiter& limiter = sharedLimiter();
+    std::vector<std::string> accountNumbers = makeAccountNumbers(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t next = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(limiter.checkRateLimit(accountNumbers[next]));
+        next = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TokenBucketRateLimiter_checkRateLimit)
+    ->ArgName("accounts")->RangeMultiplier(100)->Range(MIN_ACCOUNT_COUNT, MAX_ACCOUNT_COUNT);
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "BenchSupport.hpp"
+#include "../inc/BatchedAuditWriter.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// Benchmark arguments: number of distinct accounts the traffic is spread over (10 .. 10M) and
+// injected compliance/audit latency in microseconds. The processor resets its daily limits every
+// MAX_DAILY_TRANSACTIONS iterations so the measurement stays on the accepted path. The BatchedAudit
+// variant audits through a BatchedAuditWriter, so the audit latency is paid once per batch on its
+// flush thread instead of on every call.
+
+namespace {
+
+const long MIN_BOOK_SIZE = 10;
+const long MAX_BOOK_SIZE = 10000000;
+const long DAILY_RESET_INTERVAL = 1000;
+
+void applyBookSizes(benchmark::internal::Benchmark* benchmark) {
+    benchmark->ArgNames({"accounts", "latency_us"});
+    for (long size = MIN_BOOK_SIZE; size <= MAX_BOOK_SIZE; size *= 10) {
+        benchmark->Args({size, 0});
+    }
+    benchmark->Args({MIN_BOOK_SIZE, 20});
+}
+
+void reportAllocations(benchmark::State& state, long allocations) {
+    state.counters["allocs_per_txn"] = benchmark::Counter(static_cast<double>(allocations),
+                                                          benchmark::Counter::kAvgIterations);
+}
+
+} // namespace
+
+// ============================================================================
+// Method: processTransaction()
+// ============================================================================
+
+static void runProcessTransaction(benchmark::State& state, TransactionType type, double amount,
+                                  bool batchedAudit = false) {
+    const std::chrono::microseconds latency(state.range(1));
+    StubComplianceCheckService complianceService{latency};
+    StubAuditLoggingService auditService{latency};
+    BatchedAuditWriter auditWriter{auditService};
+    TransactionProcessor processor;
+    processor.setComplianceService(&complianceService);
+    processor.setAuditService(&auditService);
+    if (batchedAudit) {
+        processor.setAuditWriter(&auditWriter);
+    }
+    processor.setTransactionLogSink(nullptr);
+    std::vector<std::string> accountNumbers = makeAccountNumbers(static_cast<std::size_t>(state.range(0)));
+
+    // Warm-up interns every account and sizes the reusable audit buffers
+    for (const std::string& accountNumber : accountNumbers) {
+        processor.internAccount(accountNumber);
+    }
+    processor.processTransaction(type, amount, accountNumbers[0], accountNumbers[accountNumbers.size() - 1]);
+    processor.resetDailyLimits();
+
+    std::size_t next = 0;
+    long sinceReset = 0;
+    const long allocationsBefore = benchAllocationCount();
+    for (auto _ : state) {
+        const std::size_t destination = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+        benchmark::DoNotOptimize(processor.processTransaction(type, amount, accountNumbers[next],
+                                                              accountNumbers[destination]));
+        next = destination;
+        if (++sinceReset == DAILY_RESET_INTERVAL) {
+            processor.resetDailyLimits();
+            sinceReset = 0;
+        }
+    }
+    reportAllocations(state, benchAllocationCount() - allocationsBefore);
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_TransactionProcessor_processTransaction_Deposit(benchmark::State& state) {
+    runProcessTransaction(state, TransactionType::DEPOSIT, 250.0);
+}
+BENCHMARK(BM_TransactionProcessor_processTransaction_Deposit)->Apply(applyBookSizes);
+
+static void BM_TransactionProcessor_processTransaction_DepositBatchedAudit(benchmark::State& state) {
+    runProcessTransaction(state, TransactionType::DEPOSIT, 250.0, true);
+}
+BENCHMARK(BM_TransactionProcessor_processTransaction_DepositBatchedAudit)->Apply(applyBookSizes);
+
+static void BM_TransactionProcessor_processTransaction_Withdrawal(benchmark::State& state) {
+    runProcessTransaction(state, TransactionType::WITHDRAWAL, 250.0);
+}
+BENCHMARK(BM_TransactionProcessor_processTransaction_Withdrawal)->Apply(applyBookSizes);
+
+static void BM_TransactionProcessor_processTransaction_Transfer(benchmark::State& state) {
+    runProcessTransaction(state, TransactionType::TRANSFER, 250.0);
+}
+BENCHMARK(BM_TransactionProcessor_processTransaction_Transfer)->Apply(applyBookSizes);
+
+static void BM_TransactionProcessor_processTransaction_Refund(benchmark::State& state) {
+    runProcessTransaction(state, TransactionType::REFUND, 250.0);
+}
+BENCHMARK(BM_TransactionProcessor_processTransaction_Refund)->Apply(applyBookSizes);
+
+// ============================================================================
+// Method: executeTransfer()
+// ============================================================================
+
+static void BM_TransactionProcessor_executeTransfer(benchmark::State& state) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    std::vector<std::string> accountNumbers = makeAccountNumbers(static_cast<std::size_t>(state.range(0)));
+
+    std::size_t next = 0;
+    const long allocationsBefore = benchAllocationCount();
+    for (auto _ : state) {
+        const std::size_t destination = (next + 1 == accountNumbers.size()) ? 0 : next + 1;
+        benchmark::DoNotOptimize(processor.executeTransfer(250.0, accountNumbers[next], accountNumbers[destination],
+                                                           (next & 1) != 0));
+        next = destination;
+    }
+    reportAllocations(state, benchAllocationCount() - allocationsBefore);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransactionProcessor_executeTransfer)->ArgName("accounts")->RangeMultiplier(10)->Range(MIN_BOOK_SIZE, MAX_BOOK_SIZE);
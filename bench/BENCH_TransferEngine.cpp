@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../inc/ConcurrentAccountManager.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+#include "../inc/TransferEngine.hpp"
+
+// Threaded variants share one engine over 64 shards. In the disjoint variant every thread moves
+// money back and forth between its own pair of accounts, so throughput should grow with the
+// thread count; in the hot variant every transfer also touches one shared account and queues on
+// its shard lock.
+
+namespace {
+
+const int MAX_THREADS = 16;
+const std::size_t SHARD_COUNT = 64;
+
+struct TransferBench {
+    ProcessingContext context;
+    ConcurrentAccountManager accounts{SHARD_COUNT};
+    TransactionProcessor processor;
+    TransferEngine engine{accounts, processor};
+    std::vector<std::string> accountNumbers;
+    std::string hotAccount;
+
+    TransferBench() {
+        accounts.setProcessingContext(&context);
+        processor.setProcessingContext(&context);
+        processor.setTransactionLogSink(nullptr);
+        for (int i = 0; i <= 2 * MAX_THREADS; ++i) {
+            const std::string number = accounts.createAccount(AccountType::CHECKING, 1000000.0,
+                                                              static_cast<std::uint32_t>(i + 1));
+            accounts.verifyAccount(number, true);
+            accountNumbers.push_back(number);
+        }
+        hotAccount = accountNumbers.back();
+        accountNumbers.pop_back();
+    }
+};
+
+TransferBench& sharedBench() {
+    static TransferBench bench;
+    return bench;
+}
+
+} // namespace
+
+// ============================================================================
+// Method: transfer()
+// ============================================================================
+
+static void BM_TransferEngine_transfer_Disjoint(benchmark::State& state) {
+    TransferBench& bench = sharedBench();
+    const std::string& first = bench.accountNumbers[2 * state.thread_index()];
+    const std::string& second = bench.accountNumbers[2 * state.thread_index() + 1];
+
+    bool forward = true;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench.engine.transfer(1.0, forward ? first : second, forward ? second : first));
+        forward = !forward;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransferEngine_transfer_Disjoint)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+static void BM_TransferEngine_transfer_HotAccount(benchmark::State& state) {
+    TransferBench& bench = sharedBench();
+    const std::string& own = bench.accountNumbers[2 * state.thread_index()];
+
+    bool forward = true;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench.engine.transfer(1.0, forward ? own : bench.hotAccount,
+                                                       forward ? bench.hotAccount : own));
+        forward = !forward;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TransferEngine_transfer_HotAccount)->ThreadRange(1, MAX_THREADS)->UseRealTime();
@@ -0,0 +1,49 @@
+#include "BenchSupport.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<long> allocationCount{0};
+
+} // namespace
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+long benchAllocationCount() {
+    return allocationCount.load(std::memory_order_relaxed);
+}
+
+void simulateLatency(std::chrono::nanoseconds latency) {
+    if (latency.count() <= 0) {
+        return;
+    }
+    const auto deadline = std::chrono::steady_clock::now() + latency;
+    while (std::chrono::steady_clock::now() < deadline) {
+    }
+}
+
+std::vector<std::string> makeAccountNumbers(std::size_t count, int first) {
+    std::vector<std::string> accountNumbers;
+    accountNumbers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        accountNumbers.push_back("ACC" + std::to_string(first + static_cast<int>(i)));
+    }
+    return accountNumbers;
+}
@@ -0,0 +1,220 @@
+#ifndef BENCH_SUPPORT_HPP
+#define BENCH_SUPPORT_HPP
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../inc/ExternalServices.hpp"
+
+// ============================================================================
+// Allocation counting (operator new is replaced in BenchSupport.cpp)
+// ============================================================================
+
+/// @brief Retrieves the number of operator new calls made by the process so far.
+/// @return The allocation count.
+long benchAllocationCount();
+
+// ============================================================================
+// Latency injection
+// ============================================================================
+
+/// @brief Busy-waits for the given duration to model a remote round-trip without scheduler noise.
+/// @param [in] latency The simulated latency; zero returns immediately.
+void simulateLatency(std::chrono::nanoseconds latency);
+
+/// @brief Builds canonical account numbers "ACC<first>", "ACC<first + 1>", ...
+/// @param [in] count The number of account numbers.
+/// @param [in] first The first numeric id.
+/// @return The account numbers.
+std::vector<std::string> makeAccountNumbers(std::size_t count, int first = 500001);
+
+// ============================================================================
+// External service stubs: a zero latency gives a null stub
+// ============================================================================
+
+class StubAuthenticationService : public AuthenticationService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubAuthenticationService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    bool validateCredentials(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool enableMultiFactor(const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    VerificationResult verifyMultiFactorToken(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return VerificationResult::SUCCESS;
+    }
+
+    bool lockAccount(const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+};
+
+class StubComplianceCheckService : public ComplianceCheckService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubComplianceCheckService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    ComplianceLevel checkComplianceLevel(const std::string&) override {
+        simulateLatency(latency);
+        return ComplianceLevel::LOW_RISK;
+    }
+
+    bool reportSuspiciousActivity(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    std::vector<std::string> getBlacklist() override {
+        simulateLatency(latency);
+        return {};
+    }
+
+    bool isAccountBlacklisted(const std::string&) override {
+        simulateLatency(latency);
+        return false;
+    }
+};
+
+class StubAuditLoggingService : public AuditLoggingService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubAuditLoggingService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    bool logTransaction(const std::string&, const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool logAccountEvent(const std::string&, const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool logTransactionEntry(const AuditEntry&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    // One round trip per bulk emit, as a back end with a bulk endpoint would take
+    bool logTransactionBatch(const std::vector<AuditEntry>&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    std::vector<std::string> getAuditTrail(const std::string&) override {
+        simulateLatency(latency);
+        return {};
+    }
+
+    bool archiveAuditLogs(const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+};
+
+class StubNotificationService : public NotificationService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubNotificationService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    bool sendEmailNotification(const std::string&, const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool sendSmsNotification(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool sendPushNotification(const std::string&, const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool subscribeToNotifications(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+};
+
+class StubExternalDataService : public ExternalDataService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubExternalDataService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    std::string getCreditScore(const std::string&) override {
+        simulateLatency(latency);
+        return "750";
+    }
+
+    std::string getIdentityVerificationStatus(const std::string&) override {
+        simulateLatency(latency);
+        return "VERIFIED";
+    }
+
+    bool validateBankAccount(const std::string&, const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    std::vector<std::string> getLinkedAccounts(const std::string&) override {
+        simulateLatency(latency);
+        return {};
+    }
+};
+
+class StubRateLimitingService : public RateLimitingService {
+private:
+    std::chrono::nanoseconds latency;
+
+public:
+    explicit StubRateLimitingService(std::chrono::nanoseconds latency = std::chrono::nanoseconds(0))
+        : latency(latency) {}
+
+    bool checkRateLimit(const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    bool incrementRateCounter(const std::string&) override {
+        simulateLatency(latency);
+        return true;
+    }
+
+    void resetRateLimits(const std::string&) override {
+        simulateLatency(latency);
+    }
+
+    int getRemainingRequests(const std::string&) override {
+        simulateLatency(latency);
+        return 1000;
+    }
+};
+
+#endif // BENCH_SUPPORT_HPP
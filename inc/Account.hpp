@@ -0,0 +1,37 @@
+#ifndef ACCOUNT_HPP
+#define ACCOUNT_HPP
+
+#include <cstdint>
+#include <string>
+
+#include "Money.hpp"
+
+enum class AccountStatus {
+    ACTIVE,
+    SUSPENDED,
+    FROZEN,
+    CLOSED,
+    PENDING_VERIFICATION
+};
+
+enum class AccountType {
+    CHECKING,
+    SAVINGS,
+    INVESTMENT,
+    BUSINESS
+};
+
+struct Account {
+    std::string accountNumber;
+    AccountType type;
+    AccountStatus status;
+    Money balance;
+    Money creditLimit;
+    int riskScore;
+    bool isVerified;
+    bool hasFraudAlert;
+    // Customer holding the account; MAX_ACCOUNTS_PER_USER applies per owner
+    std::uint32_t ownerId = 0;
+};
+
+#endif // ACCOUNT_HPP
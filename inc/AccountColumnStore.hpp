@@ -0,0 +1,87 @@
+#ifndef ACCOUNT_COLUMN_STORE_HPP
+#define ACCOUNT_COLUMN_STORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Account.hpp"
+
+class AccountIndex;
+
+/// @brief Struct-of-arrays copy of the account fields used by bulk risk evaluation.
+/// @details Each field lives in its own contiguous column so the risk kernel streams
+///          through one or two bytes per account instead of a whole Account record.
+///          Column positions follow the insertion order of the AccountIndex it was loaded from.
+class AccountColumnStore {
+private:
+    std::vector<std::uint8_t> status;
+    std::vector<std::int32_t> riskScore;
+    std::vector<std::uint8_t> isVerified;
+    std::vector<std::uint8_t> hasFraudAlert;
+    std::vector<Money> balance;
+
+    std::vector<std::int32_t> evaluatedScore;
+    std::vector<std::uint8_t> evaluatedStatus;
+    std::vector<std::size_t> changedRows;
+
+public:
+    /// @brief Constructs an empty AccountColumnStore instance.
+    AccountColumnStore();
+
+    /// @brief Reloads every column from an account index.
+    /// @param [in] accounts The index to copy the account fields from.
+    void load(const AccountIndex& accounts);
+
+    /// @brief Retrieves the number of accounts in the store.
+    /// @return The account count.
+    std::size_t size() const;
+
+    /// @brief Scores every account with the same rules as AccountManager::evaluateAccountRisk.
+    /// @details Branch-free kernel over the columns; results are kept in the evaluated columns, and the
+    ///          positions whose score changed or whose outcome is high risk are listed in the changed rows.
+    /// @param [in] txnCounts Transaction count per account, one entry per store position.
+    /// @param [in] volumes Last-day volume per account, one entry per store position.
+    /// @param [in] highRiskThreshold Score at or above which an account is high risk.
+    /// @param [in] auditMode Whether high-risk accounts are frozen instead of suspended.
+    /// @param [in] linkedFraudAlerts Optional flag per store position, set where a linked account has a fraud alert.
+    /// @param [in] linkedFraudScore Score added where the linked fraud alert flag is set.
+    void evaluateRisk(const int* txnCounts, const double* volumes, int highRiskThreshold, bool auditMode,
+                      const std::uint8_t* linkedFraudAlerts = nullptr, int linkedFraudScore = 0);
+
+    /// @brief Retrieves the status column.
+    /// @return Pointer to size() AccountStatus values stored as bytes.
+    const std::uint8_t* getStatus() const;
+
+    /// @brief Retrieves the stored risk score column.
+    /// @return Pointer to size() risk scores.
+    const std::int32_t* getRiskScore() const;
+
+    /// @brief Retrieves the verification flag column.
+    /// @return Pointer to size() flags.
+    const std::uint8_t* getIsVerified() const;
+
+    /// @brief Retrieves the fraud alert flag column.
+    /// @return Pointer to size() flags.
+    const std::uint8_t* getHasFraudAlert() const;
+
+    /// @brief Retrieves the balance column.
+    /// @return Pointer to size() balances.
+    const Money* getBalance() const;
+
+    /// @brief Retrieves the scores computed by the last evaluateRisk call.
+    /// @return Pointer to size() scores.
+    const std::int32_t* getEvaluatedScore() const;
+
+    /// @brief Retrieves the statuses computed by the last evaluateRisk call.
+    /// @return Pointer to size() AccountStatus values stored as bytes.
+    const std::uint8_t* getEvaluatedStatus() const;
+
+    /// @brief Retrieves the rows the last evaluateRisk call needs written back to the accounts.
+    /// @details These are the rows AccountManager::storeRiskEvaluation would change or log: a new score,
+    ///          or a FROZEN or SUSPENDED outcome. Every other account already holds its evaluated state.
+    /// @return The store positions, in ascending order.
+    const std::vector<std::size_t>& getChangedRows() const;
+};
+
+#endif // ACCOUNT_COLUMN_STORE_HPP
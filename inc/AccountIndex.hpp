@@ -0,0 +1,110 @@
+#ifndef ACCOUNT_INDEX_HPP
+#define ACCOUNT_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "Account.hpp"
+
+/// @brief Flat open-addressing index of accounts keyed on the numeric account id.
+/// @details Slots hold only the 32-bit id and the position of the account in a dense
+///          entry store, so a lookup is one multiplicative hash and a short linear probe
+///          over contiguous memory. Entries keep stable addresses: Account pointers
+///          returned by find stay valid while more accounts are inserted. Slots and entries are
+///          allocated from the memory resource given at construction; the account number strings
+///          are short enough to stay inline.
+class AccountIndex {
+private:
+    static const std::uint32_t EMPTY_SLOT;
+
+    struct Slot {
+        std::uint32_t accountId;
+        std::uint32_t entry;
+    };
+
+    std::pmr::vector<Slot> slots;
+    std::pmr::deque<Account> entries;
+    std::size_t slotMask;
+
+    /// @brief Computes the home slot of an account id.
+    /// @param [in] accountId The account id.
+    /// @return The slot position to start probing from.
+    std::size_t homeSlot(std::uint32_t accountId) const;
+
+    /// @brief Rebuilds the slot table with the given capacity.
+    /// @param [in] slotCount The new slot count, a power of two.
+    void rehash(std::size_t slotCount);
+
+public:
+    /// @brief Constructs an empty AccountIndex instance.
+    /// @param [in] resource The memory resource of the slots and entries; must outlive the index.
+    explicit AccountIndex(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    AccountIndex(const AccountIndex&) = delete;
+    AccountIndex& operator=(const AccountIndex&) = delete;
+
+    /// @brief Parses a canonical account number of the form "ACC<digits>" without allocating.
+    /// @details Leading zeros and values outside the int range are not canonical.
+    /// @param [in] accountNumber The account number to parse.
+    /// @param [out] accountId The parsed account id.
+    /// @return True if the account number is canonical, false otherwise.
+    static bool parseAccountId(const std::string& accountNumber, int& accountId);
+
+    /// @brief Formats the canonical account number "ACC<accountId>" with std::to_chars.
+    /// @param [in] accountId The non-negative account id.
+    /// @return The account number, short enough to stay inline in the string.
+    static std::string formatAccountNumber(int accountId);
+
+    /// @brief Finds an account by numeric id.
+    /// @param [in] accountId The account id.
+    /// @return Pointer to the account, or nullptr if not found.
+    Account* find(int accountId);
+
+    /// @brief Finds an account by numeric id.
+    /// @param [in] accountId The account id.
+    /// @return Pointer to the account, or nullptr if not found.
+    const Account* find(int accountId) const;
+
+    /// @brief Finds an account by account number.
+    /// @param [in] accountNumber The account number.
+    /// @return Pointer to the account, or nullptr if not found or not canonical.
+    Account* find(const std::string& accountNumber);
+
+    /// @brief Finds an account by account number.
+    /// @param [in] accountNumber The account number.
+    /// @return Pointer to the account, or nullptr if not found or not canonical.
+    const Account* find(const std::string& accountNumber) const;
+
+    /// @brief Inserts a new account under its numeric id.
+    /// @param [in] accountId The account id.
+    /// @param [in] account The account to store.
+    /// @return Pointer to the stored account, or nullptr if the id is already present or negative.
+    Account* insert(int accountId, const Account& account);
+
+    /// @brief Pre-sizes the index for the given number of accounts.
+    /// @param [in] accountCount The expected number of accounts.
+    void reserve(std::size_t accountCount);
+
+    /// @brief Removes all accounts.
+    void clear();
+
+    /// @brief Retrieves the number of stored accounts.
+    /// @return The account count.
+    std::size_t size() const;
+
+    /// @brief Accesses an account by insertion position.
+    /// @param [in] position The position, in [0, size()).
+    /// @return Reference to the account.
+    Account& entryAt(std::size_t position);
+
+    /// @brief Accesses an account by insertion position.
+    /// @param [in] position The position, in [0, size()).
+    /// @return Reference to the account.
+    const Account& entryAt(std::size_t position) const;
+};
+
+#endif // ACCOUNT_INDEX_HPP
@@ -0,0 +1,213 @@
+#ifndef ACCOUNT_JOURNAL_HPP
+#define ACCOUNT_JOURNAL_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Account.hpp"
+
+enum class AccountLogOperation : std::uint8_t {
+    CREATE,
+    ACTIVATE,
+    SUSPEND,
+    DEACTIVATE,
+    UPDATE_STATUS,
+    VERIFY,
+    EVALUATE_RISK,
+    ADJUST_BALANCE
+};
+
+/// @brief Fixed-width image of one account after a mutation, shared by the WAL and the snapshots.
+/// @details Replay overwrites the stored account with the image, so applying a record twice is harmless.
+///          The checksum covers every byte before it and detects torn writes at the end of the log.
+struct AccountLogRecord {
+    static const std::uint8_t VERIFIED_FLAG = 0x01;
+    static const std::uint8_t FRAUD_ALERT_FLAG = 0x02;
+
+    std::uint64_t sequence;
+    std::int32_t accountId;
+    std::int32_t riskScore;
+    Money balance;
+    Money creditLimit;
+    std::int32_t suspendedAccountCount;
+    std::uint8_t operation;
+    std::uint8_t type;
+    std::uint8_t status;
+    std::uint8_t flags;
+    std::uint32_t ownerId;              // zero in files written before owners were recorded
+    std::uint32_t checksum;
+
+    /// @brief Builds the image of an account.
+    /// @param [in] operation The mutation that produced the image.
+    /// @param [in] accountId The numeric account id.
+    /// @param [in] account The account after the mutation.
+    /// @param [in] suspendedAccountCount The suspended account counter of the manager after the mutation.
+    /// @return The record, with sequence and checksum still zero.
+    static AccountLogRecord fromAccount(AccountLogOperation operation, int accountId,
+                                        const Account& account, int suspendedAccountCount);
+
+    /// @brief Restores the account described by the image.
+    /// @return The account, numbered "ACC<accountId>".
+    Account toAccount() const;
+
+    /// @brief Computes the checksum over every field before it.
+    /// @return The checksum value.
+    std::uint32_t computeChecksum() const;
+};
+
+/// @brief Append-only write-ahead log of account mutations with group commit.
+/// @details append only copies the record into a pending batch; a flusher thread writes the batch
+///          and fsyncs it once per flushInterval, or as soon as maxBatchRecords are pending, so
+///          concurrent committers share one fsync. waitDurable blocks until a sequence is on disk.
+///          The file starts with a 64-byte header holding the sequence of its first record, so
+///          sequences keep increasing across reset and restarts.
+class AccountWriteAheadLog {
+private:
+    std::FILE* file;
+    std::string path;
+
+    mutable std::mutex mutex;
+    std::condition_variable flushWanted;
+    std::condition_variable flushDone;
+    std::vector<AccountLogRecord> pending;
+    std::uint64_t nextSequence;
+    std::uint64_t durableSequence;
+    std::size_t syncCount;
+    bool syncRequested;
+    bool stopRequested;
+    bool writeFailed;
+
+    std::chrono::milliseconds flushInterval;
+    std::size_t maxBatchRecords;
+    std::thread flushThread;
+
+    /// @brief Writes pending batches until the log is closed.
+    void flushLoop();
+
+    /// @brief Writes the header of an empty log starting at the given sequence.
+    /// @param [in] firstSequence The sequence of the first record of the log.
+    /// @return True if the header was written and synced, false otherwise.
+    bool writeHeader(std::uint64_t firstSequence);
+
+public:
+    static const std::size_t HEADER_SIZE = 64;
+
+    /// @brief Constructs a closed AccountWriteAheadLog instance.
+    /// @param [in] flushInterval Longest time a record waits for its fsync.
+    /// @param [in] maxBatchRecords Pending record count that triggers an early flush (at least 1).
+    explicit AccountWriteAheadLog(std::chrono::milliseconds flushInterval = std::chrono::milliseconds(5),
+                                  std::size_t maxBatchRecords = 1024);
+
+    /// @brief Flushes the pending batch and closes the log.
+    ~AccountWriteAheadLog();
+
+    AccountWriteAheadLog(const AccountWriteAheadLog&) = delete;
+    AccountWriteAheadLog& operator=(const AccountWriteAheadLog&) = delete;
+
+    /// @brief Opens or creates a log and starts the flusher thread.
+    /// @details A torn record at the end of an existing log is cut off; appends continue after the
+    ///          last intact record.
+    /// @param [in] path The log file path.
+    /// @return True if the log is open, false if the file cannot be used or has a foreign layout.
+    bool open(const std::string& path);
+
+    /// @brief Flushes the pending batch, stops the flusher thread and closes the file.
+    void close();
+
+    /// @brief Checks whether a log is open.
+    /// @return True if open, false otherwise.
+    bool isOpen() const;
+
+    /// @brief Queues a record for the next group commit.
+    /// @param [in] record The record; its sequence and checksum are assigned here.
+    /// @return The sequence assigned to the record, or 0 if the log is not open.
+    std::uint64_t append(AccountLogRecord record);
+
+    /// @brief Blocks until the given sequence has been written and synced.
+    /// @param [in] sequence The sequence to wait for.
+    /// @return True once durable, false if the log was closed or a write failed first.
+    bool waitDurable(std::uint64_t sequence);
+
+    /// @brief Blocks until every appended record is durable.
+    /// @return True if every record is durable, false otherwise.
+    bool sync();
+
+    /// @brief Discards every record after a snapshot has made them redundant.
+    /// @details Pending records are synced first; the next record keeps the next sequence.
+    /// @return True if the log was truncated, false otherwise.
+    bool reset();
+
+    /// @brief Retrieves the sequence of the last appended record.
+    /// @return The last sequence, or the sequence before the first record if none was appended.
+    std::uint64_t getLastSequence() const;
+
+    /// @brief Retrieves the number of fsyncs issued so far.
+    /// @return The sync count.
+    std::size_t getSyncCount() const;
+
+    /// @brief Reads the intact records of a log file in sequence order.
+    /// @param [in] path The log file path.
+    /// @param [in] visit Called for every intact record.
+    /// @return True if the file was read or does not exist, false if it has a foreign layout.
+    static bool readRecords(const std::string& path, const std::function<void(const AccountLogRecord&)>& visit);
+};
+
+/// @brief Header of a compact account snapshot file, followed by accountCount AccountLogRecord images.
+/// @details The images are sorted by account id and 16-byte aligned, so the file can be mapped and
+///          searched in place (see MappedAccountBook) as well as read into memory.
+struct AccountSnapshotHeader {
+    static const std::uint32_t SORTED_BY_ID_FLAG = 0x01;
+
+    char magic[8];
+    std::uint32_t recordSize;
+    std::uint32_t flags;
+    std::uint64_t accountCount;
+    std::uint64_t lastSequence;
+    std::int64_t suspendedAccountCount;
+    std::int64_t accountCounter;
+    Money totalManagedBalance;
+    std::uint64_t checksum;
+};
+
+class AccountSnapshot {
+public:
+    /// @brief Computes the checksum a snapshot header stores for its records.
+    /// @param [in] header The header; its checksum field is ignored.
+    /// @param [in] records The account images, in file order.
+    /// @param [in] count The number of images.
+    /// @return The checksum value.
+    static std::uint64_t computeChecksum(const AccountSnapshotHeader& header,
+                                         const AccountLogRecord* records, std::size_t count);
+
+    /// @brief Checks the magic, the record size and the file size against a snapshot header.
+    /// @param [in] header The header read from the file.
+    /// @param [in] fileSize The size of the whole snapshot file in bytes.
+    /// @return True if the header describes a snapshot of exactly fileSize bytes, false otherwise.
+    static bool isValidHeader(const AccountSnapshotHeader& header, std::uint64_t fileSize);
+
+    /// @brief Writes a snapshot atomically: to a temporary file that is synced and renamed over path.
+    /// @param [in] path The snapshot file path.
+    /// @param [in] header The header; magic, recordSize, flags, accountCount and checksum are filled in here.
+    /// @param [in] records The account images, in any order; they are written sorted by account id.
+    /// @return True if the snapshot was written, false otherwise.
+    static bool write(const std::string& path, AccountSnapshotHeader header,
+                      std::vector<AccountLogRecord> records);
+
+    /// @brief Reads a snapshot written by write.
+    /// @param [in] path The snapshot file path.
+    /// @param [out] header The snapshot header.
+    /// @param [out] records The account images, sorted by account id.
+    /// @return True if the snapshot was read intact, false if missing, truncated or corrupt.
+    static bool read(const std::string& path, AccountSnapshotHeader& header,
+                     std::vector<AccountLogRecord>& records);
+};
+
+#endif // ACCOUNT_JOURNAL_HPP
@@ -0,0 +1,72 @@
+#ifndef ACCOUNT_LINK_GRAPH_HPP
+#define ACCOUNT_LINK_GRAPH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/// @brief Compact adjacency store of the account link graph, one row of linked account ids per account.
+/// @details Rows are kept in CSR form: the linked ids of every account are contiguous in one edge array
+///          and a row is an offset range into it, so walking the links of many accounts streams through
+///          memory. A replaced row is rewritten in place when its new links fit, and otherwise appended
+///          with the old range left dead; once the dead edges outnumber the live ones the array is
+///          rewritten without them, so replacement is amortized O(links). Each row records when it was fetched so callers can refresh rows one
+///          at a time.
+class AccountLinkGraph {
+public:
+    using Clock = std::chrono::steady_clock;
+
+private:
+    struct Row {
+        std::uint32_t offset;
+        std::uint32_t count;
+        Clock::time_point fetchedAt;
+    };
+
+    std::vector<Row> rows;
+    std::unordered_map<int, std::uint32_t> rowOf;
+    std::vector<int> edges;
+    std::size_t deadEdgeCount;
+
+    /// @brief Rewrites the edge array without the ranges of replaced rows.
+    void compact();
+
+public:
+    /// @brief Constructs an empty AccountLinkGraph instance.
+    AccountLinkGraph();
+
+    /// @brief Stores the links of an account, replacing any links stored for it before.
+    /// @param [in] accountId The numeric account id.
+    /// @param [in] linkedIds The numeric ids of the linked accounts.
+    /// @param [in] fetchedAt When the links were fetched.
+    void setLinks(int accountId, const std::vector<int>& linkedIds, Clock::time_point fetchedAt);
+
+    /// @brief Finds the stored links of an account.
+    /// @param [in] accountId The numeric account id.
+    /// @param [out] links The first of count linked ids; valid until the next setLinks call.
+    /// @param [out] count The number of links, zero if none are stored.
+    /// @return True if the account has a stored row, false otherwise.
+    bool findLinks(int accountId, const int*& links, std::size_t& count) const;
+
+    /// @brief Checks whether the links of an account were fetched recently enough to be reused.
+    /// @param [in] accountId The numeric account id.
+    /// @param [in] now The current time.
+    /// @param [in] maxAge The age up to which stored links are fresh.
+    /// @return True if a row is stored and at most maxAge old, false otherwise.
+    bool isFresh(int accountId, Clock::time_point now, Clock::duration maxAge) const;
+
+    /// @brief Removes every row.
+    void clear();
+
+    /// @brief Retrieves the number of accounts with a stored row.
+    /// @return The row count.
+    std::size_t size() const;
+
+    /// @brief Retrieves the number of live links over all rows.
+    /// @return The link count.
+    std::size_t getLinkCount() const;
+};
+
+#endif // ACCOUNT_LINK_GRAPH_HPP
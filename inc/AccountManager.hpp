@@ -1,60 +1,183 @@
 #ifndef ACCOUNT_MANAGER_HPP
 #define ACCOUNT_MANAGER_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory_resource>
 #include <string>
-#include <map>
+#include <unordered_map>
 #include <vector>
 
+#include "Account.hpp"
+#include "AccountIndex.hpp"
+#include "AccountColumnStore.hpp"
+#include "AccountLinkGraph.hpp"
+#include "AccountJournal.hpp"
+#include "AccountStatusIndex.hpp"
+#include "MappedAccountBook.hpp"
+#include "MemoryResources.hpp"
+
 class AuthenticationService;
 class NotificationService;
 class ExternalDataService;
-
-enum class AccountStatus {
-    ACTIVE,
-    SUSPENDED,
-    FROZEN,
-    CLOSED,
-    PENDING_VERIFICATION
-};
-
-enum class AccountType {
-    CHECKING,
-    SAVINGS,
-    INVESTMENT,
-    BUSINESS
-};
-
-struct Account {
-    std::string accountNumber;
-    AccountType type;
-    AccountStatus status;
-    double balance;
-    double creditLimit;
-    int riskScore;
-    bool isVerified;
-    bool hasFraudAlert;
-};
+class AsyncExternalDataService;
+class AsyncNotificationService;
+struct ProcessingContext;
 
 class AccountManager {
 private:
-    static int accountCounter;
-    static const double MINIMUM_BALANCE;
+    static std::atomic<int> accountCounter;
+    static constexpr Money MINIMUM_BALANCE = Money::fromCents(1);
     static const int HIGH_RISK_THRESHOLD;
     static const int MAX_ACCOUNTS_PER_USER;
+    static const int LINKED_FRAUD_ALERT_RISK;
+    
+    // Counts the allocations of the account index; declared first so it outlives the index
+    CountingMemoryResource accountMemory;
+    AccountIndex accounts;
+    AccountColumnStore riskColumns;
+    std::vector<std::uint8_t> linkedFraudAlerts;
     
-    std::map<std::string, Account> accounts;
+    // Links of ExternalDataService::getLinkedAccounts, reused by every evaluation until linkCacheTtl has passed
+    AccountLinkGraph linkGraph;
+    std::chrono::milliseconds linkCacheTtl;
+    
+    // Accounts held per owner; rebuilt from the accounts on first use after a recovery
+    mutable std::pmr::unordered_map<std::uint32_t, int> ownerAccountCounts;
+    mutable bool ownerCountsStale;
+    // Accounts by status and risk; rebuilt from the accounts on first use after a recovery
+    mutable AccountStatusIndex statusIndex;
+    mutable bool statusIndexStale;
     int suspendedAccountCount;
-    double totalManagedBalance;
+    Money totalManagedBalance;
     
     // External service pointers (stub/mock for testing)
     AuthenticationService* authService;
     NotificationService* notificationService;
     ExternalDataService* dataService;
+    AsyncExternalDataService* asyncDataService;
+    AsyncNotificationService* asyncNotificationService;
+    
+    // Totals and the compliance audit switch; the process-wide context unless another one is injected
+    ProcessingContext* context;
+    
+    // Durability: every mutation is appended to the WAL, and a snapshot is taken every recordsPerSnapshot records
+    AccountWriteAheadLog* writeAheadLog;
+    std::string snapshotPath;
+    std::size_t recordsPerSnapshot;
+    std::size_t recordsSinceSnapshot;
+    
+    // Mapped snapshot serving reads in place; accounts holds the copy-on-write overlay on top of it
+    MappedAccountBook mappedBook;
+    std::size_t materializedCount;
+    
+    /// @brief Finds an account for update, copying it from the mapped snapshot into the overlay on first use.
+    /// @param [in] accountNumber The account number.
+    /// @return Pointer to the account in the overlay, or nullptr if not found.
+    Account* findAccount(const std::string& accountNumber);
+    
+    /// @brief Copies every account of the mapped snapshot not yet in the overlay into it.
+    void materializeAll();
+    
+    /// @brief Accesses the number of accounts of an owner, recounting every account first if needed.
+    /// @param [in] ownerId The owner.
+    /// @return Reference to the count of the owner.
+    int& ownerAccountCount(std::uint32_t ownerId) const;
+    
+    /// @brief Accesses the status and risk index, indexing every account first if needed.
+    /// @return Reference to the index.
+    const AccountStatusIndex& currentStatusIndex() const;
+    
+    /// @brief Moves an account to the index lists matching its fields; a no-op while the index is stale.
+    /// @param [in] account The account.
+    void reindexAccount(const Account& account);
+    
+    /// @brief Changes the status of an account, keeping the suspended count and the index in step.
+    /// @param [in,out] account The account to update.
+    /// @param [in] newStatus The new account status.
+    void setStatus(Account& account, AccountStatus newStatus);
+    
+    /// @brief Formats the account numbers of a list of ids.
+    /// @param [in] accountIds The account ids.
+    /// @return One account number per id, in the same order.
+    static std::vector<std::string> toAccountNumbers(const std::vector<int>& accountIds);
+    
+    /// @brief Validates the initial balance of a new account.
+    /// @param [in] initialBalance The requested balance.
+    /// @param [out] balance The balance in cents.
+    /// @return True if the balance is finite and at least MINIMUM_BALANCE, false otherwise; it is rounded to the nearest cent.
+    static bool parseInitialBalance(double initialBalance, Money& balance);
+    
+    /// @brief Inserts and logs a new account; limits and totals are left to the caller.
+    /// @param [in] accountId The reserved account id.
+    /// @param [in] type The type of account to create.
+    /// @param [in] balance The validated initial balance.
+    /// @param [in] ownerId The owner of the account.
+    /// @return Pointer to the stored account, or nullptr if the id is already taken.
+    Account* insertNewAccount(int accountId, AccountType type, Money balance, std::uint32_t ownerId);
+    
+    /// @brief Appends the image of a mutated account to the WAL and takes a snapshot when one is due.
+    /// @param [in] operation The mutation that was applied.
+    /// @param [in] account The account after the mutation.
+    void logMutation(AccountLogOperation operation, const Account& account);
+    
+    /// @brief Applies the risk thresholds to an account and stores the high-risk outcomes.
+    /// @param [in,out] account The account to evaluate.
+    /// @param [in] transactionCount The number of transactions in the evaluation period.
+    /// @param [in] volumeLastDay The transaction volume from the last day.
+    /// @param [in] linkedFraudAlert Whether a linked account has a fraud alert.
+    /// @return The evaluated account status.
+    AccountStatus applyRiskRules(Account& account, int transactionCount, double volumeLastDay, bool linkedFraudAlert);
+    
+    /// @brief Stores the links of an account in the link graph, dropping numbers that are not canonical.
+    /// @param [in] accountId The numeric account id.
+    /// @param [in] linkedAccounts The linked account numbers.
+    /// @param [in] fetchedAt When the links were fetched.
+    void storeLinkedAccounts(int accountId, const std::vector<std::string>& linkedAccounts,
+                             AccountLinkGraph::Clock::time_point fetchedAt);
+    
+    /// @brief Checks the fraud alert flag of an account, reading the mapped snapshot if needed.
+    /// @param [in] accountId The numeric account id.
+    /// @return True if the account is held by this manager and has a fraud alert, false otherwise.
+    bool hasFraudAlert(int accountId) const;
+    
+    /// @brief Checks whether any cached link of an account leads to an account with a fraud alert.
+    /// @param [in] accountId The numeric account id.
+    /// @return True if a linked account has a fraud alert, false otherwise.
+    bool hasLinkedFraudAlert(int accountId) const;
+    
+    /// @brief Stores an evaluated risk score and applies the high-risk outcomes to the account.
+    /// @param [in,out] account The evaluated account.
+    /// @param [in] riskScore The evaluated risk score.
+    /// @param [in] evaluated The evaluated account status.
+    void storeRiskEvaluation(Account& account, int riskScore, AccountStatus evaluated);
+    
+    /// @brief Stores a verification result and activates accounts pending verification.
+    /// @param [in,out] account The account to update.
+    /// @param [in] verificationResult The verification result.
+    /// @return True if the account became active, false otherwise.
+    bool applyVerificationResult(Account& account, bool verificationResult);
+    
+    /// @brief Sends the "Account Verified" email, asynchronously when an async service is set.
+    void sendVerifiedEmail();
 
 public:
+    // Owner of the accounts created without one
+    static const std::uint32_t DEFAULT_OWNER_ID = 0;
+    
+    // How long the links of an account are reused before evaluateAccountRisk fetches them again
+    static const int DEFAULT_LINK_CACHE_TTL_MS = 300000;
+    
     /// @brief Constructs an AccountManager instance.
     /// @details Initializes the account manager with empty account storage and zero counters.
-    AccountManager();
+    ///          Passing an arena (e.g. std::pmr::monotonic_buffer_resource) lets a short-lived manager
+    ///          release all of its account storage at once when the arena is destroyed.
+    /// @param [in] upstream The memory resource of the account index; nullptr means the default resource.
+    ///                      Must outlive the manager.
+    explicit AccountManager(std::pmr::memory_resource* upstream = nullptr);
     
     /// @brief Destructs the AccountManager instance.
     ~AccountManager();
@@ -71,11 +194,103 @@ public:
     /// @param [in] service Pointer to the ExternalDataService implementation.
     void setExternalDataService(ExternalDataService* service);
     
+    /// @brief Sets the asynchronous external data service used by the async entry points.
+    /// @details When set, it replaces the blocking data service in verifyAccountAsync and evaluateAccountRiskAsync.
+    /// @param [in] service Pointer to the AsyncExternalDataService implementation.
+    void setAsyncExternalDataService(AsyncExternalDataService* service);
+    
+    /// @brief Sets the asynchronous notification service used for fire-and-forget emails.
+    /// @details When set, verification emails are queued instead of sent inline, from both verify entry points.
+    /// @param [in] service Pointer to the AsyncNotificationService implementation.
+    void setAsyncNotificationService(AsyncNotificationService* service);
+    
+    /// @brief Binds the manager to the context holding the creation totals and the compliance audit switch.
+    /// @details nullptr restores ProcessingContext::global(), the default.
+    /// @param [in] processingContext Pointer to the context; must outlive the manager.
+    void setProcessingContext(ProcessingContext* processingContext);
+    
+    /// @brief Accesses the context the manager is bound to.
+    /// @return Reference to the processing context.
+    ProcessingContext& getProcessingContext() const;
+    
+    /// @brief Sets how long the fetched links of an account are reused by the risk evaluations.
+    /// @details Once the time has passed, the next evaluateAccountRisk of the account fetches the links
+    ///          again and replaces only that account's row of the link graph.
+    /// @param [in] ttl The reuse period; zero fetches on every evaluation.
+    void setLinkCacheTtl(std::chrono::milliseconds ttl);
+    
+    /// @brief Accesses the cached account link graph.
+    /// @return Reference to the link graph.
+    const AccountLinkGraph& getLinkGraph() const;
+    
+    /// @brief Sets the write-ahead log receiving every account mutation.
+    /// @details nullptr (the default) disables logging. Records are group-committed by the log;
+    ///          call AccountWriteAheadLog::sync to wait until the mutations so far are durable.
+    /// @param [in] log Pointer to an open AccountWriteAheadLog.
+    void setWriteAheadLog(AccountWriteAheadLog* log);
+    
+    /// @brief Enables periodic snapshots, taken after every recordsPerSnapshot logged mutations.
+    /// @param [in] path The snapshot file path.
+    /// @param [in] recordsPerSnapshot Mutations between two snapshots; 0 disables periodic snapshots.
+    void setSnapshotPolicy(const std::string& path, std::size_t recordsPerSnapshot);
+    
+    /// @brief Writes a compact snapshot of all accounts and counters, then truncates the WAL it covers.
+    /// @param [in] path The snapshot file path.
+    /// @return True if the snapshot was written, false otherwise.
+    bool writeSnapshot(const std::string& path);
+    
+    /// @brief Restores the state of an empty manager from the latest snapshot and the WAL tail.
+    /// @details Loads the snapshot, then replays WAL records newer than it; a torn record ends the replay.
+    ///          The shared account counter is advanced past every recovered id. Either file may be missing.
+    /// @param [in] snapshotPath The snapshot file path.
+    /// @param [in] walPath The WAL file path.
+    /// @return True if the state was recovered, false if the manager is not empty or a file is corrupt.
+    bool recover(const std::string& snapshotPath, const std::string& walPath);
+    
+    /// @brief Serves the accounts of a snapshot from a file mapping, then replays the WAL tail.
+    /// @details Start-up cost depends on the WAL tail only: no account is read before it is used.
+    ///          getAccountBalance reads the mapping directly; getAccount and the mutators copy an
+    ///          account into an in-memory overlay on first use, leaving the file unmodified.
+    ///          getAccountAt and evaluateAllAccountsRisk copy every remaining account first.
+    ///          A missing snapshot leaves only the WAL replay, as in recover.
+    /// @param [in] snapshotPath The snapshot file path; must stay in place while the manager is alive.
+    /// @param [in] walPath The WAL file path.
+    /// @return True if the state was restored, false if the manager is not empty or a file is corrupt.
+    bool openSnapshot(const std::string& snapshotPath, const std::string& walPath);
+    
     /// @brief Creates a new account with the specified type and initial balance.
     /// @param [in] type The type of account to create.
-    /// @param [in] initialBalance The initial balance for the account.
-    /// @return A unique account number as a string.
-    std::string createAccount(AccountType type, double initialBalance);
+    /// @param [in] initialBalance The initial balance for the account; rounded to the nearest cent.
+    /// @param [in] ownerId The owner, who may hold at most getMaxAccountsPerUser() accounts.
+    /// @return A unique account number, or an empty string if the account could not be created.
+    std::string createAccount(AccountType type, double initialBalance, std::uint32_t ownerId = DEFAULT_OWNER_ID);
+    
+    /// @brief Creates many accounts of one type in one call, e.g. for an onboarding migration.
+    /// @details Every request is checked as in createAccount, in input order; the accepted ones take one
+    ///          contiguous block of ids from the shared account counter, in input order, and the storage
+    ///          is sized for them up front.
+    /// @param [in] count The number of accounts to create.
+    /// @param [in] type The type of every account.
+    /// @param [in] balances The initial balance of every account.
+    /// @param [in] ownerIds The owner of every account; nullptr assigns all of them to DEFAULT_OWNER_ID.
+    /// @return The account number of every request, empty where the account was refused.
+    std::vector<std::string> createAccounts(std::size_t count, AccountType type, const double* balances,
+                                            const std::uint32_t* ownerIds = nullptr);
+    
+    /// @brief Reserves a contiguous block of account ids from the shared account counter.
+    /// @details Safe to call from several threads; every id is handed out exactly once.
+    /// @param [in] count The number of ids to reserve.
+    /// @return The first id of the reserved block.
+    static int reserveAccountIds(int count);
+    
+    /// @brief Creates a new account under an id obtained from reserveAccountIds.
+    /// @param [in] accountId The reserved account id.
+    /// @param [in] type The type of account to create.
+    /// @param [in] initialBalance The initial balance for the account; rounded to the nearest cent.
+    /// @param [in] ownerId The owner, who may hold at most getMaxAccountsPerUser() accounts.
+    /// @return The account number, or an empty string if the account could not be created.
+    std::string createReservedAccount(int accountId, AccountType type, double initialBalance,
+                                      std::uint32_t ownerId = DEFAULT_OWNER_ID);
     
     /// @brief Activates a suspended or inactive account.
     /// @param [in] accountNumber The account number to activate.
@@ -88,12 +303,30 @@ public:
     /// @return True if suspension succeeded, false otherwise.
     bool suspendAccount(const std::string& accountNumber, const std::string& reason);
     
+    /// @brief Checks whether adjustBalance would accept a balance change.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] delta The amount to add; negative for a debit.
+    /// @return True if the account is ACTIVE and a debit leaves the balance non-negative, false otherwise.
+    bool canAdjustBalance(const std::string& accountNumber, Money delta);
+    
+    /// @brief Adds an amount to the balance of an active account, e.g. one side of a transfer.
+    /// @details The managed total and the system total of the processing context move by the same
+    ///          amount, and the account image is logged, so recovery restores both.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] delta The amount to add; negative for a debit.
+    /// @return True if the balance was changed, false if canAdjustBalance refused it.
+    bool adjustBalance(const std::string& accountNumber, Money delta);
+    
     /// @brief Deactivates an account.
     /// @param [in] accountNumber The account number to deactivate.
     /// @return True if deactivation succeeded, false otherwise.
     bool deactivateAccount(const std::string& accountNumber);
     
     /// @brief Evaluates the risk level of an account based on transaction activity.
+    /// @details The score is stored in Account::riskScore; high-risk accounts are suspended or frozen.
+    ///          A fraud alert on a linked account held by this manager raises the score. The links come
+    ///          from ExternalDataService::getLinkedAccounts, fetched only when the cached ones are missing
+    ///          or older than the link cache TTL.
     /// @param [in] accountNumber The account number to evaluate.
     /// @param [in] transactionCount The number of transactions in the evaluation period.
     /// @param [in] volumeLastDay The transaction volume from the last day.
@@ -102,6 +335,16 @@ public:
                                       int transactionCount, 
                                       double volumeLastDay);
     
+    /// @brief Evaluates the risk level of every account in one pass over a columnar store.
+    /// @details Applies the thresholds of evaluateAccountRisk with a branch-free kernel and the same
+    ///          score and status side effects. Inputs and results are indexed by account position (see getAccountAt).
+    ///          Linked fraud alerts are read from the cached link graph only; unlike the scalar path it
+    ///          never calls ExternalDataService::getLinkedAccounts.
+    /// @param [in] txnCounts Transaction count per account, getAccountCount() entries.
+    /// @param [in] volumes Last-day volume per account, getAccountCount() entries.
+    /// @param [out] results Optional evaluated status per account, getAccountCount() entries.
+    void evaluateAllAccountsRisk(const int* txnCounts, const double* volumes, AccountStatus* results = nullptr);
+    
     /// @brief Updates the status of an account.
     /// @param [in] accountNumber The account number to update.
     /// @param [in] newStatus The new account status.
@@ -113,20 +356,100 @@ public:
     /// @return Pointer to the Account object, or nullptr if not found.
     Account* getAccount(const std::string& accountNumber);
     
+    /// @brief Retrieves an account by its position in creation order.
+    /// @param [in] position The account position, in [0, getAccountCount()).
+    /// @return Pointer to the Account object, or nullptr if out of range.
+    Account* getAccountAt(std::size_t position);
+    
     /// @brief Verifies or updates the verification status of an account.
     /// @param [in] accountNumber The account number to verify.
     /// @param [in] verificationResult The verification result.
     /// @return True if verification update succeeded, false otherwise.
     bool verifyAccount(const std::string& accountNumber, bool verificationResult);
     
+    /// @brief Verifies an account with the identity and credit lookups running concurrently.
+    /// @details The account is updated before returning, exactly as verifyAccount would; the returned
+    ///          future becomes ready once both lookups have completed, so many verifications can be
+    ///          in flight on one thread. The verification email is fire-and-forget.
+    /// @param [in] accountNumber The account number to verify.
+    /// @param [in] verificationResult The verification result.
+    /// @return Future receiving the result verifyAccount would return.
+    std::future<bool> verifyAccountAsync(const std::string& accountNumber, bool verificationResult);
+    
+    /// @brief Evaluates the risk of an account without blocking on the linked-accounts lookup.
+    /// @details Fresh cached links skip the lookup and return a ready future. Otherwise the lookup is
+    ///          started and the returned future caches the fetched links and evaluates the account when
+    ///          it is waited on, so the manager must outlive it and the caller must hold off other
+    ///          calls on the manager meanwhile. A failed lookup is scored with the links cached so far.
+    /// @param [in] accountNumber The account number to evaluate.
+    /// @param [in] transactionCount The number of transactions in the evaluation period.
+    /// @param [in] volumeLastDay The transaction volume from the last day.
+    /// @return Future receiving the status evaluateAccountRisk would return.
+    std::future<AccountStatus> evaluateAccountRiskAsync(const std::string& accountNumber,
+                                                        int transactionCount,
+                                                        double volumeLastDay);
+    
     /// @brief Retrieves the current balance of an account.
     /// @param [in] accountNumber The account number.
     /// @return The account balance as a double.
     double getAccountBalance(const std::string& accountNumber) const;
     
     /// @brief Retrieves the count of currently suspended accounts.
+    /// @details Counts status transitions, so suspending an account twice counts it once.
     /// @return The number of suspended accounts.
     int getSuspendedAccountCount() const;
+    
+    /// @brief Retrieves the accounts in a status, in time proportional to their number.
+    /// @details Served from indexes kept up to date by every status change made through the manager.
+    ///          Fields written directly through an Account pointer are indexed at the next change of
+    ///          that account through the manager. The first query after recover or openSnapshot
+    ///          indexes every account once. The order of the accounts is unspecified.
+    /// @param [in] status The account status.
+    /// @return The account numbers.
+    std::vector<std::string> getAccountsByStatus(AccountStatus status) const;
+    
+    /// @brief Retrieves the accounts in a status with the given fraud alert flag, e.g. FROZEN with an alert.
+    /// @details Served from the same indexes as getAccountsByStatus(AccountStatus).
+    /// @param [in] status The account status.
+    /// @param [in] hasFraudAlert The fraud alert flag.
+    /// @return The account numbers.
+    std::vector<std::string> getAccountsByStatus(AccountStatus status, bool hasFraudAlert) const;
+    
+    /// @brief Retrieves the number of accounts in a status without listing them.
+    /// @param [in] status The account status.
+    /// @return The account count.
+    int getAccountCountByStatus(AccountStatus status) const;
+    
+    /// @brief Retrieves the accounts whose stored risk score is at least a minimum.
+    /// @details Served from a risk-bucket index; see getAccountsByStatus(AccountStatus).
+    /// @param [in] minimumScore The lowest matching risk score.
+    /// @return The account numbers.
+    std::vector<std::string> getAccountsWithRiskAtLeast(int minimumScore) const;
+    
+    /// @brief Retrieves the accounts whose stored risk score reaches the high-risk threshold.
+    /// @return The account numbers.
+    std::vector<std::string> getHighRiskAccounts() const;
+    
+    /// @brief Retrieves the total balance of all accounts created by this manager.
+    /// @return The sum of the initial balances of the managed accounts and the balance adjustments since.
+    double getTotalManagedBalance() const;
+    
+    /// @brief Retrieves the allocations made for the account index.
+    /// @return The allocation statistics of the account storage.
+    AllocationStats getAllocationStats() const;
+    
+    /// @brief Retrieves the number of accounts held by this manager.
+    /// @return The account count.
+    int getAccountCount() const;
+    
+    /// @brief Retrieves the number of accounts an owner holds in this manager.
+    /// @param [in] ownerId The owner.
+    /// @return The account count of the owner.
+    int getOwnerAccountCount(std::uint32_t ownerId) const;
+    
+    /// @brief Retrieves the maximum number of accounts a single owner may hold.
+    /// @return The per-owner account limit.
+    static int getMaxAccountsPerUser();
 };
 
 #endif // ACCOUNT_MANAGER_HPP
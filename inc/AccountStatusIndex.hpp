@@ -0,0 +1,107 @@
+#ifndef ACCOUNT_STATUS_INDEX_HPP
+#define ACCOUNT_STATUS_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include "Account.hpp"
+
+/// @brief Secondary indexes of accounts by status, fraud alert and risk score, maintained incrementally.
+/// @details Every indexed account sits in exactly one member list per index: one list per status and
+///          fraud alert flag, and one list per risk bucket of RISK_BUCKET_WIDTH points. Each node
+///          remembers its slot in both lists, so moving an account is two swap-with-last removals
+///          and two appends, and a query walks only the lists it asks for. Member order is
+///          unspecified. Nodes and lists are allocated from the memory resource given at construction.
+class AccountStatusIndex {
+private:
+    static const std::size_t STATUS_COUNT = 5;
+    static const std::size_t STATUS_LIST_COUNT = STATUS_COUNT * 2;
+
+    struct Node {
+        int accountId;
+        int riskScore;
+        std::uint32_t statusSlot;
+        std::uint32_t riskSlot;
+        std::uint8_t statusList;
+        std::uint8_t riskBucket;
+    };
+
+    std::pmr::vector<Node> nodes;
+    std::pmr::unordered_map<int, std::uint32_t> nodeOf;
+    std::pmr::vector<std::pmr::vector<std::uint32_t>> statusMembers;
+    std::pmr::vector<std::pmr::vector<std::uint32_t>> riskMembers;
+
+    /// @brief Computes the status list of a status and fraud alert flag.
+    /// @param [in] status The account status.
+    /// @param [in] hasFraudAlert The fraud alert flag.
+    /// @return The list position, in [0, STATUS_LIST_COUNT).
+    static std::uint8_t statusListOf(AccountStatus status, bool hasFraudAlert);
+
+    /// @brief Removes a node from a member list, moving the last member into its slot.
+    /// @param [in,out] members The member list.
+    /// @param [in] slot The slot of the node.
+    /// @param [in] riskList Whether the list is a risk bucket rather than a status list.
+    void unlink(std::pmr::vector<std::uint32_t>& members, std::uint32_t slot, bool riskList);
+
+public:
+    // Risk scores per bucket; the last bucket holds every score from its lower bound up
+    static const int RISK_BUCKET_WIDTH = 25;
+    static const std::size_t RISK_BUCKET_COUNT = 5;
+
+    /// @brief Constructs an empty AccountStatusIndex instance.
+    /// @param [in] resource The memory resource of the nodes and lists; must outlive the index.
+    explicit AccountStatusIndex(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    AccountStatusIndex(const AccountStatusIndex&) = delete;
+    AccountStatusIndex& operator=(const AccountStatusIndex&) = delete;
+
+    /// @brief Computes the risk bucket of a score.
+    /// @param [in] riskScore The risk score; negative scores fall in the first bucket.
+    /// @return The bucket, in [0, RISK_BUCKET_COUNT).
+    static std::size_t riskBucketOf(int riskScore);
+
+    /// @brief Indexes an account, or moves it to the lists matching its current fields.
+    /// @param [in] accountId The numeric account id.
+    /// @param [in] status The account status.
+    /// @param [in] hasFraudAlert The fraud alert flag.
+    /// @param [in] riskScore The stored risk score.
+    void update(int accountId, AccountStatus status, bool hasFraudAlert, int riskScore);
+
+    /// @brief Pre-sizes the index for the given number of accounts.
+    /// @param [in] accountCount The expected number of accounts.
+    void reserve(std::size_t accountCount);
+
+    /// @brief Removes all accounts.
+    void clear();
+
+    /// @brief Retrieves the number of indexed accounts.
+    /// @return The account count.
+    std::size_t size() const;
+
+    /// @brief Retrieves the number of accounts in a status.
+    /// @param [in] status The account status.
+    /// @return The account count.
+    std::size_t countWithStatus(AccountStatus status) const;
+
+    /// @brief Appends the ids of the accounts in a status.
+    /// @param [in] status The account status.
+    /// @param [out] accountIds Receives one id per matching account.
+    void collectWithStatus(AccountStatus status, std::vector<int>& accountIds) const;
+
+    /// @brief Appends the ids of the accounts in a status with the given fraud alert flag.
+    /// @param [in] status The account status.
+    /// @param [in] hasFraudAlert The fraud alert flag.
+    /// @param [out] accountIds Receives one id per matching account.
+    void collectWithStatus(AccountStatus status, bool hasFraudAlert, std::vector<int>& accountIds) const;
+
+    /// @brief Appends the ids of the accounts whose risk score is at least a minimum.
+    /// @details Whole buckets above the minimum are copied; only the bucket holding it is filtered.
+    /// @param [in] minimumScore The lowest matching risk score.
+    /// @param [out] accountIds Receives one id per matching account.
+    void collectWithRiskAtLeast(int minimumScore, std::vector<int>& accountIds) const;
+};
+
+#endif // ACCOUNT_STATUS_INDEX_HPP
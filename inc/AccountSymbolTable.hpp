@@ -0,0 +1,89 @@
+#ifndef ACCOUNT_SYMBOL_TABLE_HPP
+#define ACCOUNT_SYMBOL_TABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+/// @brief Compact handle of an interned account number.
+using AccountSymbol = std::uint32_t;
+
+/// @brief Interning table mapping account numbers to 32-bit handles.
+/// @details Names are copied once into append-only arena chunks, so the views returned by
+///          name stay valid for the lifetime of the table. Looking up an account that is
+///          already interned never allocates. Symbols are released only with the table, so each
+///          TransactionProcessor owns one and memory is bounded by the distinct account numbers
+///          of its accepted transactions. Not thread-safe; the owner serializes access.
+class AccountSymbolTable {
+private:
+    static const std::uint32_t EMPTY_SLOT;
+
+    struct Slot {
+        std::uint32_t hashTag;
+        std::uint32_t symbol;
+    };
+
+    std::vector<Slot> slots;
+    std::size_t slotMask;
+    std::vector<std::string_view> names;
+    std::vector<std::unique_ptr<char[]>> chunks;
+    std::size_t chunkUsed;
+    std::size_t chunkSize;
+
+    /// @brief Hashes an account number.
+    /// @param [in] accountNumber The account number.
+    /// @return The 64-bit hash of the account number.
+    static std::uint64_t hashName(std::string_view accountNumber);
+
+    /// @brief Probes for an account number.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] hash The hash of the account number.
+    /// @param [out] position The slot holding the account number, or the empty slot ending the probe.
+    /// @return The symbol of the account number, or NO_SYMBOL if not interned.
+    AccountSymbol probe(std::string_view accountNumber, std::uint64_t hash, std::size_t& position) const;
+
+    /// @brief Copies an account number into the arena.
+    /// @param [in] accountNumber The account number.
+    /// @return View of the stored copy.
+    std::string_view store(std::string_view accountNumber);
+
+    /// @brief Rebuilds the slot table with the given capacity.
+    /// @param [in] slotCount The new slot count, a power of two.
+    void rehash(std::size_t slotCount);
+
+public:
+    /// @brief Symbol of the empty account number, used for transactions without a counterparty.
+    static const AccountSymbol EMPTY_ACCOUNT;
+
+    /// @brief Value returned by find for account numbers that are not interned.
+    static const AccountSymbol NO_SYMBOL;
+
+    /// @brief Constructs an AccountSymbolTable holding only the empty account number.
+    AccountSymbolTable();
+
+    AccountSymbolTable(const AccountSymbolTable&) = delete;
+    AccountSymbolTable& operator=(const AccountSymbolTable&) = delete;
+
+    /// @brief Retrieves the symbol of an account number, interning it on first use.
+    /// @param [in] accountNumber The account number.
+    /// @return The symbol of the account number.
+    AccountSymbol intern(std::string_view accountNumber);
+
+    /// @brief Retrieves the symbol of an account number without interning it.
+    /// @param [in] accountNumber The account number.
+    /// @return The symbol of the account number, or NO_SYMBOL if not interned.
+    AccountSymbol find(std::string_view accountNumber) const;
+
+    /// @brief Retrieves the account number of a symbol.
+    /// @param [in] symbol The symbol.
+    /// @return View of the account number, or an empty view for unknown symbols.
+    std::string_view name(AccountSymbol symbol) const;
+
+    /// @brief Retrieves the number of interned account numbers, including the empty one.
+    /// @return The symbol count.
+    std::size_t size() const;
+};
+
+#endif // ACCOUNT_SYMBOL_TABLE_HPP
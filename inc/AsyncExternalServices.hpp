@@ -0,0 +1,105 @@
+#ifndef ASYNC_EXTERNAL_SERVICES_HPP
+#define ASYNC_EXTERNAL_SERVICES_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+#include "ExternalServices.hpp"
+#include "ServiceCallExecutor.hpp"
+
+class AsyncExternalDataService {
+public:
+    /// @brief Destructor for AsyncExternalDataService.
+    virtual ~AsyncExternalDataService() = default;
+
+    /// @brief Starts retrieving the credit score for an account.
+    /// @param [in] accountNumber The account number.
+    /// @return Future receiving the credit score as a string.
+    virtual std::future<std::string> getCreditScoreAsync(const std::string& accountNumber) = 0;
+
+    /// @brief Starts retrieving the identity verification status for an account.
+    /// @param [in] accountNumber The account number.
+    /// @return Future receiving the identity verification status as a string.
+    virtual std::future<std::string> getIdentityVerificationStatusAsync(const std::string& accountNumber) = 0;
+
+    /// @brief Starts retrieving the accounts linked to a primary account.
+    /// @param [in] primaryAccount The primary account number.
+    /// @return Future receiving the linked account numbers.
+    virtual std::future<std::vector<std::string>> getLinkedAccountsAsync(const std::string& primaryAccount) = 0;
+};
+
+class AsyncNotificationService {
+public:
+    /// @brief Destructor for AsyncNotificationService.
+    virtual ~AsyncNotificationService() = default;
+
+    /// @brief Queues an email notification and returns without waiting for delivery.
+    /// @param [in] email The recipient email address.
+    /// @param [in] subject The email subject line.
+    /// @param [in] body The email body content.
+    virtual void sendEmailNotificationAsync(const std::string& email,
+                                            const std::string& subject,
+                                            const std::string& body) = 0;
+
+    /// @brief Queues the email of a notification template and returns without waiting for delivery.
+    /// @details The default implementation renders the template and forwards it to sendEmailNotificationAsync.
+    /// @param [in] email The recipient email address.
+    /// @param [in] notificationTemplate The message to send.
+    virtual void sendTemplateNotificationAsync(const std::string& email, NotificationTemplate notificationTemplate) {
+        const NotificationTemplateText text = notificationTemplateText(notificationTemplate);
+        sendEmailNotificationAsync(email, std::string(text.subject), std::string(text.body));
+    }
+};
+
+/// @brief Runs the calls of a blocking ExternalDataService on a ServiceCallExecutor.
+/// @details The wrapped service is called from several workers at once and must be thread-safe
+///          unless the executor has a single worker.
+class ExecutorExternalDataService : public AsyncExternalDataService {
+private:
+    ExternalDataService& service;
+    ServiceCallExecutor& executor;
+
+public:
+    /// @brief Constructs an ExecutorExternalDataService instance.
+    /// @param [in] service The blocking service to call.
+    /// @param [in] executor The executor running the calls.
+    ExecutorExternalDataService(ExternalDataService& service, ServiceCallExecutor& executor);
+
+    /// @brief Waits for the calls still queued on the executor.
+    ~ExecutorExternalDataService() override;
+
+    std::future<std::string> getCreditScoreAsync(const std::string& accountNumber) override;
+    std::future<std::string> getIdentityVerificationStatusAsync(const std::string& accountNumber) override;
+    std::future<std::vector<std::string>> getLinkedAccountsAsync(const std::string& primaryAccount) override;
+};
+
+/// @brief Sends the notifications of a blocking NotificationService from a ServiceCallExecutor.
+/// @details Delivery failures cannot reach the caller; they are counted in getFailedCount.
+class ExecutorNotificationService : public AsyncNotificationService {
+private:
+    NotificationService& service;
+    ServiceCallExecutor& executor;
+    std::atomic<std::size_t> failedCount;
+
+public:
+    /// @brief Constructs an ExecutorNotificationService instance.
+    /// @param [in] service The blocking service to call.
+    /// @param [in] executor The executor running the calls.
+    ExecutorNotificationService(NotificationService& service, ServiceCallExecutor& executor);
+
+    /// @brief Waits for the notifications still queued on the executor.
+    ~ExecutorNotificationService() override;
+
+    void sendEmailNotificationAsync(const std::string& email,
+                                    const std::string& subject,
+                                    const std::string& body) override;
+
+    /// @brief Retrieves the number of notifications the wrapped service failed to send.
+    /// @return The failed notification count.
+    std::size_t getFailedCount() const;
+};
+
+#endif // ASYNC_EXTERNAL_SERVICES_HPP
@@ -0,0 +1,168 @@
+#ifndef BATCHED_AUDIT_WRITER_HPP
+#define BATCHED_AUDIT_WRITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ExternalServices.hpp"
+#include "Transaction.hpp"
+
+/// @brief How soon a submitted audit record must reach the audit service.
+enum class AuditDurability {
+    THROUGHPUT,     // buffered and written by the flush thread
+    DURABLE         // written before submit returns, together with everything buffered before it on the thread
+};
+
+/// @brief Unformatted audit fields of one processed transaction.
+/// @details The source account travels next to the record, so its length is not bounded by the record.
+struct AuditRecord {
+    int transactionId;
+    TransactionType type;
+    TransactionStatus status;
+    Money amount;
+    std::time_t loggedAt;           // wall-clock time the transaction was audited
+};
+
+/// @brief Counters of one BatchedAuditWriter.
+struct BatchedAuditWriterStats {
+    std::size_t submittedCount;
+    std::size_t writtenCount;       // records in batches the service accepted
+    std::size_t failedCount;        // records in batches the service refused or threw on
+    std::size_t batchCount;         // logTransactionBatch calls
+    std::size_t durableCount;       // records submitted with AuditDurability::DURABLE
+};
+
+/// @brief Buffers structured audit records per thread and writes them to an AuditLoggingService in batches.
+/// @details submit only appends the record to a buffer owned by the calling thread, so producers
+///          never contend with each other and nothing is formatted on their path. The source account
+///          is copied into account text owned by the same buffer, whatever its length. A flush thread
+///          drains every buffer once one of them holds batchSize records or flushInterval has
+///          passed, formats the records into AuditEntry views and hands them to
+///          AuditLoggingService::logTransactionBatch, at most batchSize at a time. The records of one
+///          thread reach the service in submission order. Only one call into the service runs at a
+///          time, so the service need not be thread-safe.
+class BatchedAuditWriter {
+private:
+    /// @brief A record and the place of its source account in the account text of its buffer.
+    struct BufferedRecord {
+        AuditRecord record;
+        std::size_t accountOffset;
+        std::size_t accountLength;
+    };
+
+    /// @brief Records submitted by one thread and not yet taken by a flush.
+    struct ThreadBuffer {
+        std::thread::id owner;
+        std::mutex mutex;
+        std::vector<BufferedRecord> records;
+        std::string accounts;
+    };
+
+    AuditLoggingService& service;
+    std::size_t batchSize;
+    std::chrono::milliseconds flushInterval;
+    // Tells the per-thread buffer cache of a destroyed writer apart from one at the same address
+    const std::uint64_t instanceId;
+
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    // Held while buffers are taken and written, which keeps the order of each thread; guards the scratch below
+    std::mutex writeMutex;
+    std::vector<BufferedRecord> pending;
+    std::string pendingAccounts;
+    std::vector<char> text;
+    std::vector<AuditEntry> entries;
+
+    std::mutex flushMutex;
+    std::condition_variable flushRequested;
+    bool flushPending;
+    bool stopRequested;
+    std::thread flusher;
+
+    std::atomic<std::size_t> submittedCount;
+    std::atomic<std::size_t> writtenCount;
+    std::atomic<std::size_t> failedCount;
+    std::atomic<std::size_t> batchCount;
+    std::atomic<std::size_t> durableCount;
+
+    /// @brief Finds or creates the buffer of the calling thread.
+    /// @return Reference to the buffer; it lives as long as the writer.
+    ThreadBuffer& localBuffer();
+
+    /// @brief Moves the records of a buffer to the end of the pending scratch; the caller holds writeMutex.
+    /// @param [in,out] buffer The buffer to empty.
+    void takeRecords(ThreadBuffer& buffer);
+
+    /// @brief Formats the pending records and writes them in batches; the caller holds writeMutex.
+    /// @return True if the service accepted every batch, false otherwise.
+    bool writePending();
+
+    /// @brief Wakes the flush thread.
+    void requestFlush();
+
+    /// @brief Flushes on request or every flushInterval until the writer is destroyed.
+    void flushLoop();
+
+public:
+    static const std::size_t DEFAULT_BATCH_SIZE = 256;
+    static const int DEFAULT_FLUSH_INTERVAL_MS = 20;
+
+    // Bytes of formatted text behind the views of one AuditEntry
+    static const std::size_t ENTRY_TEXT_SIZE = 96;
+
+    /// @brief Constructs a BatchedAuditWriter instance and starts its flush thread.
+    /// @param [in] service The audit service receiving the batches; must outlive the writer.
+    /// @param [in] batchSize The maximum number of records per batch and the buffer size that triggers a flush (at least 1).
+    /// @param [in] flushInterval The longest time a buffered record waits for a flush.
+    explicit BatchedAuditWriter(AuditLoggingService& service,
+                                std::size_t batchSize = DEFAULT_BATCH_SIZE,
+                                std::chrono::milliseconds flushInterval = std::chrono::milliseconds(DEFAULT_FLUSH_INTERVAL_MS));
+
+    /// @brief Stops the flush thread and writes everything still buffered.
+    ~BatchedAuditWriter();
+
+    BatchedAuditWriter(const BatchedAuditWriter&) = delete;
+    BatchedAuditWriter& operator=(const BatchedAuditWriter&) = delete;
+
+    /// @brief Submits one audit record.
+    /// @param [in] record The record; it is copied, not formatted.
+    /// @param [in] sourceAccount The source account number of the record; it is copied in full.
+    /// @param [in] durability Whether to return before or after the record is written.
+    /// @return True if the record was buffered, or for DURABLE written and accepted; false if the service refused it.
+    bool submit(const AuditRecord& record, std::string_view sourceAccount,
+                AuditDurability durability = AuditDurability::THROUGHPUT);
+
+    /// @brief Writes the records of every thread on the calling thread.
+    /// @return True if the service accepted every batch, false otherwise.
+    bool flush();
+
+    /// @brief Retrieves the counters of this writer.
+    /// @return The counters at some moment during the call.
+    BatchedAuditWriterStats getStats() const;
+
+    /// @brief Formats a record into the text the audit service receives.
+    /// @param [in] record The record.
+    /// @param [in] sourceAccount The source account number; the entry views it as it is.
+    /// @param [out] text ENTRY_TEXT_SIZE bytes receiving the formatted fields.
+    /// @return The entry; its views point into text and sourceAccount.
+    static AuditEntry formatEntry(const AuditRecord& record, std::string_view sourceAccount, char* text);
+
+    /// @brief Builds the audit record of a transaction.
+    /// @param [in] transaction The transaction.
+    /// @param [in] loggedAt The wall-clock time the transaction is audited.
+    /// @return The record.
+    static AuditRecord makeRecord(const Transaction& transaction, std::time_t loggedAt);
+};
+
+#endif // BATCHED_AUDIT_WRITER_HPP
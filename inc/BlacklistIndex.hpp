@@ -0,0 +1,139 @@
+#ifndef BLACKLIST_INDEX_HPP
+#define BLACKLIST_INDEX_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+class ComplianceCheckService;
+
+/// @brief Local index over a ComplianceCheckService::getBlacklist snapshot.
+/// @details A blocked Bloom filter answers almost every clean account from a single 32-byte
+///          block; only filter hits probe the exact, sorted id set. The filter costs
+///          bitsPerKey / 8 bytes per blacklisted id (2 MB per million at the default 16 bits,
+///          about 0.1% false positives), the exact set about 32 bytes per id of up to 15
+///          characters plus the id length beyond that. Refreshes build a new snapshot off to the
+///          side and publish it by swapping a pointer, so lookups never wait for the back end.
+class BlacklistIndex {
+private:
+    static const std::size_t WORDS_PER_BLOCK = 8;
+
+    struct Block {
+        std::uint32_t words[WORDS_PER_BLOCK];
+    };
+
+    struct Snapshot {
+        std::vector<Block> blocks;
+        std::vector<std::string> ids;
+        std::size_t capacity;
+    };
+
+    std::size_t bitsPerKey;
+
+    mutable std::shared_mutex mutex;
+    std::shared_ptr<const Snapshot> snapshot;
+
+    // Serializes refreshes, which run outside the snapshot lock
+    mutable std::mutex refreshMutex;
+    std::size_t refreshCount;
+    std::size_t rebuildCount;
+
+    std::mutex backgroundMutex;
+    std::condition_variable backgroundWake;
+    std::thread backgroundThread;
+    bool stopRequested;
+
+    /// @brief Hashes an account number for the filter.
+    /// @param [in] accountNumber The account number.
+    /// @return The 64-bit hash of the account number.
+    static std::uint64_t hashId(std::string_view accountNumber);
+
+    /// @brief Sets the bits of one id in the filter.
+    /// @param [in,out] blocks The filter blocks.
+    /// @param [in] hash The hash of the id.
+    static void insertHash(std::vector<Block>& blocks, std::uint64_t hash);
+
+    /// @brief Tests the bits of one id in the filter.
+    /// @param [in] blocks The filter blocks.
+    /// @param [in] hash The hash of the id.
+    /// @return True if every bit of the id is set.
+    static bool testHash(const std::vector<Block>& blocks, std::uint64_t hash);
+
+    /// @brief Builds a snapshot with a filter sized for the ids plus growth headroom.
+    /// @param [in] ids The sorted, unique ids.
+    /// @return The new snapshot.
+    std::shared_ptr<const Snapshot> buildSnapshot(std::vector<std::string> ids) const;
+
+    /// @brief Calls refresh every interval until stopBackgroundRefresh is called.
+    /// @param [in] service The compliance back end.
+    /// @param [in] interval Time between two refreshes.
+    void backgroundLoop(ComplianceCheckService& service, std::chrono::milliseconds interval);
+
+public:
+    /// @brief Default filter bits per blacklisted id.
+    static const std::size_t DEFAULT_BITS_PER_KEY = 16;
+
+    /// @brief Constructs an empty BlacklistIndex instance.
+    /// @param [in] bitsPerKey Filter bits per blacklisted id; more bits mean fewer false positives.
+    explicit BlacklistIndex(std::size_t bitsPerKey = DEFAULT_BITS_PER_KEY);
+
+    /// @brief Stops the background refresh, if running.
+    ~BlacklistIndex();
+
+    BlacklistIndex(const BlacklistIndex&) = delete;
+    BlacklistIndex& operator=(const BlacklistIndex&) = delete;
+
+    /// @brief Replaces the indexed ids.
+    /// @details Ids that only add to the current snapshot are inserted into a copy of its filter
+    ///          while the filter has headroom; removals or exhausted headroom rebuild it.
+    /// @param [in] ids The blacklisted account numbers, in any order and possibly with duplicates.
+    void load(std::vector<std::string> ids);
+
+    /// @brief Fetches getBlacklist from the back end and loads it.
+    /// @param [in] service The compliance back end.
+    void refresh(ComplianceCheckService& service);
+
+    /// @brief Starts a thread that refreshes the index periodically; restarts it if already running.
+    /// @param [in] service The compliance back end; must outlive the background refresh.
+    /// @param [in] interval Time between two refreshes; the first one runs immediately.
+    void startBackgroundRefresh(ComplianceCheckService& service, std::chrono::milliseconds interval);
+
+    /// @brief Stops the background refresh thread and waits for it to exit.
+    void stopBackgroundRefresh();
+
+    /// @brief Checks the filter only.
+    /// @param [in] accountNumber The account number.
+    /// @return False if the account is certainly not blacklisted, true if it may be.
+    bool mayContain(std::string_view accountNumber) const;
+
+    /// @brief Checks whether an account is in the indexed blacklist.
+    /// @param [in] accountNumber The account number.
+    /// @return True if the account is blacklisted, false otherwise.
+    bool contains(std::string_view accountNumber) const;
+
+    /// @brief Retrieves the number of indexed ids.
+    /// @return The id count.
+    std::size_t size() const;
+
+    /// @brief Retrieves the memory held by the filter and the exact set.
+    /// @return The approximate byte count.
+    std::size_t getMemoryUsage() const;
+
+    /// @brief Retrieves the number of loads so far.
+    /// @return The refresh count.
+    std::size_t getRefreshCount() const;
+
+    /// @brief Retrieves the number of loads that had to rebuild the filter from scratch.
+    /// @return The rebuild count.
+    std::size_t getRebuildCount() const;
+};
+
+#endif // BLACKLIST_INDEX_HPP
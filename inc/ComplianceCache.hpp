@@ -0,0 +1,110 @@
+#ifndef COMPLIANCE_CACHE_HPP
+#define COMPLIANCE_CACHE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ExternalServices.hpp"
+
+/// @brief Caches the compliance decisions of a ComplianceCheckService per account.
+/// @details A decorator: set it on the TransactionProcessor in place of the back end. Decisions
+///          expire after their TTL, BLOCKED decisions use their own TTL, and the least recently used
+///          entry is evicted once the cache is full. reportSuspiciousActivity drops the cached
+///          decision of the reported account so its next transaction asks the back end again.
+class CachingComplianceCheckService : public ComplianceCheckService {
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+private:
+    struct Entry {
+        ComplianceLevel level;
+        std::chrono::steady_clock::time_point expiresAt;
+        std::list<std::string>::iterator recency;
+    };
+
+    ComplianceCheckService& service;
+    std::chrono::steady_clock::duration ttl;
+    std::chrono::steady_clock::duration blockedTtl;
+    std::size_t maxEntries;
+    Clock clock;
+
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    // Most recently used account first
+    std::list<std::string> recencyOrder;
+    // Bumped by every invalidation, so a back-end answer fetched before it is not cached afterwards
+    std::size_t invalidationEpoch;
+
+    std::atomic<std::size_t> hitCount;
+    std::atomic<std::size_t> missCount;
+
+    /// @brief Stores a decision fetched from the back end, evicting the least recently used entry if full.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] level The decision to cache.
+    /// @param [in] now The current time of the cache clock.
+    /// @param [in] epoch The invalidation epoch observed before the back end was asked.
+    void store(const std::string& accountNumber, ComplianceLevel level,
+               std::chrono::steady_clock::time_point now, std::size_t epoch);
+
+public:
+    /// @brief Constructs a CachingComplianceCheckService instance.
+    /// @param [in] service The compliance back end; must outlive the cache.
+    /// @param [in] ttl How long LOW_RISK, MEDIUM_RISK and HIGH_RISK decisions are served from the cache.
+    /// @param [in] blockedTtl How long BLOCKED decisions are served from the cache.
+    /// @param [in] maxEntries The maximum number of cached accounts (at least 1).
+    /// @param [in] clock Time source; defaults to std::chrono::steady_clock::now.
+    CachingComplianceCheckService(ComplianceCheckService& service,
+                                  std::chrono::steady_clock::duration ttl,
+                                  std::chrono::steady_clock::duration blockedTtl,
+                                  std::size_t maxEntries,
+                                  Clock clock = Clock());
+
+    /// @brief Returns the cached decision, or asks the back end on a miss or expired entry.
+    /// @param [in] accountNumber The account number to check.
+    /// @return The compliance level of the account.
+    ComplianceLevel checkComplianceLevel(const std::string& accountNumber) override;
+
+    /// @brief Forwards the report to the back end and invalidates the cached decision of the account.
+    /// @param [in] accountNumber The account number with suspicious activity.
+    /// @param [in] description The description of the suspicious activity.
+    /// @return The result of the back end.
+    bool reportSuspiciousActivity(const std::string& accountNumber,
+                                  const std::string& description) override;
+
+    /// @brief Forwards to the back end; the blacklist is not cached.
+    /// @return A vector of blacklisted account numbers.
+    std::vector<std::string> getBlacklist() override;
+
+    /// @brief Forwards to the back end; the blacklist is not cached.
+    /// @param [in] accountNumber The account number to check.
+    /// @return True if the account is blacklisted, false otherwise.
+    bool isAccountBlacklisted(const std::string& accountNumber) override;
+
+    /// @brief Drops the cached decision of an account.
+    /// @param [in] accountNumber The account number.
+    void invalidate(const std::string& accountNumber);
+
+    /// @brief Drops every cached decision; the counters are kept.
+    void clear();
+
+    /// @brief Retrieves the number of decisions served from the cache.
+    /// @return The hit count.
+    std::size_t getHitCount() const;
+
+    /// @brief Retrieves the number of decisions fetched from the back end.
+    /// @return The miss count.
+    std::size_t getMissCount() const;
+
+    /// @brief Retrieves the number of cached accounts, including expired entries not yet replaced.
+    /// @return The entry count.
+    std::size_t size() const;
+};
+
+#endif // COMPLIANCE_CACHE_HPP
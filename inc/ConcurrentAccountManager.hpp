@@ -0,0 +1,205 @@
+#ifndef CONCURRENT_ACCOUNT_MANAGER_HPP
+#define CONCURRENT_ACCOUNT_MANAGER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "AccountManager.hpp"
+
+/// @brief Read-only view of an account that keeps its shard locked for reading.
+/// @details The account cannot be modified or invalidated while the handle is alive.
+///          Release the handle before calling a mutating method on the same manager.
+class AccountHandle {
+private:
+    std::shared_lock<std::shared_mutex> lock;
+    const Account* account;
+
+public:
+    /// @brief Constructs an empty handle.
+    AccountHandle();
+
+    /// @brief Constructs a handle owning a shared shard lock.
+    /// @param [in] lock The shared lock of the shard holding the account.
+    /// @param [in] account Pointer to the account, or nullptr if not found.
+    AccountHandle(std::shared_lock<std::shared_mutex>&& lock, const Account* account);
+
+    /// @brief Checks whether the handle refers to an account.
+    /// @return True if the account was found, false otherwise.
+    explicit operator bool() const;
+
+    /// @brief Accesses the account.
+    /// @return Pointer to the account, or nullptr if not found.
+    const Account* get() const;
+
+    /// @brief Accesses the account.
+    /// @return Pointer to the account.
+    const Account* operator->() const;
+
+    /// @brief Accesses the account.
+    /// @return Reference to the account.
+    const Account& operator*() const;
+};
+
+class ConcurrentAccountManager {
+private:
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        AccountManager manager;
+    };
+
+    std::size_t shardCount;
+    std::unique_ptr<Shard[]> shards;
+    std::atomic<int> accountCount;
+    
+    // Accounts held per owner across all shards, since the accounts of one owner land on different shards
+    std::mutex ownerMutex;
+    std::unordered_map<std::uint32_t, int> ownerAccountCounts;
+
+    /// @brief Selects the shard that owns an account number.
+    /// @param [in] accountNumber The account number.
+    /// @return Reference to the owning shard.
+    Shard& shardFor(const std::string& accountNumber) const;
+
+    /// @brief Selects the shard that owns a numeric account id.
+    /// @param [in] accountId The account id.
+    /// @return Reference to the owning shard.
+    Shard& shardFor(int accountId) const;
+
+public:
+    /// @brief Constructs a ConcurrentAccountManager instance.
+    /// @param [in] shardCount The number of independently locked shards.
+    explicit ConcurrentAccountManager(std::size_t shardCount = 16);
+
+    /// @brief Destructs the ConcurrentAccountManager instance.
+    ~ConcurrentAccountManager();
+
+    /// @brief Sets the authentication service on every shard.
+    /// @param [in] service Pointer to the AuthenticationService implementation.
+    void setAuthenticationService(AuthenticationService* service);
+
+    /// @brief Sets the notification service on every shard.
+    /// @param [in] service Pointer to the NotificationService implementation; must be thread-safe.
+    void setNotificationService(NotificationService* service);
+
+    /// @brief Sets the external data service on every shard.
+    /// @param [in] service Pointer to the ExternalDataService implementation; must be thread-safe.
+    void setExternalDataService(ExternalDataService* service);
+
+    /// @brief Sets the asynchronous external data service on every shard.
+    /// @param [in] service Pointer to the AsyncExternalDataService implementation; must be thread-safe.
+    void setAsyncExternalDataService(AsyncExternalDataService* service);
+
+    /// @brief Sets the asynchronous notification service on every shard.
+    /// @param [in] service Pointer to the AsyncNotificationService implementation; must be thread-safe.
+    void setAsyncNotificationService(AsyncNotificationService* service);
+
+    /// @brief Binds every shard to a processing context; see AccountManager::setProcessingContext.
+    /// @param [in] processingContext Pointer to the context; nullptr restores the process-wide one.
+    void setProcessingContext(ProcessingContext* processingContext);
+
+    /// @brief Creates a new account; see AccountManager::createAccount.
+    /// @param [in] type The type of account to create.
+    /// @param [in] initialBalance The initial balance for the account.
+    /// @param [in] ownerId The owner, who may hold at most AccountManager::getMaxAccountsPerUser() accounts.
+    /// @return A unique account number, or an empty string if creation failed.
+    std::string createAccount(AccountType type, double initialBalance,
+                              std::uint32_t ownerId = AccountManager::DEFAULT_OWNER_ID);
+
+    /// @brief Activates an account; see AccountManager::activateAccount.
+    /// @param [in] accountNumber The account number to activate.
+    /// @return True if activation succeeded, false otherwise.
+    bool activateAccount(const std::string& accountNumber);
+
+    /// @brief Suspends an account; see AccountManager::suspendAccount.
+    /// @param [in] accountNumber The account number to suspend.
+    /// @param [in] reason The reason for suspension.
+    /// @return True if suspension succeeded, false otherwise.
+    bool suspendAccount(const std::string& accountNumber, const std::string& reason);
+
+    /// @brief Deactivates an account; see AccountManager::deactivateAccount.
+    /// @param [in] accountNumber The account number to deactivate.
+    /// @return True if deactivation succeeded, false otherwise.
+    bool deactivateAccount(const std::string& accountNumber);
+
+    /// @brief Evaluates the risk level of an account; see AccountManager::evaluateAccountRisk.
+    /// @param [in] accountNumber The account number to evaluate.
+    /// @param [in] transactionCount The number of transactions in the evaluation period.
+    /// @param [in] volumeLastDay The transaction volume from the last day.
+    /// @return The evaluated account status based on risk assessment.
+    AccountStatus evaluateAccountRisk(const std::string& accountNumber,
+                                      int transactionCount,
+                                      double volumeLastDay);
+
+    /// @brief Updates the status of an account; see AccountManager::updateAccountStatus.
+    /// @param [in] accountNumber The account number to update.
+    /// @param [in] newStatus The new account status.
+    /// @return True if the status update succeeded, false otherwise.
+    bool updateAccountStatus(const std::string& accountNumber, AccountStatus newStatus);
+
+    /// @brief Retrieves a read-only handle to an account.
+    /// @param [in] accountNumber The account number to retrieve.
+    /// @return A handle that is empty if the account was not found.
+    AccountHandle getAccount(const std::string& accountNumber) const;
+
+    /// @brief Verifies an account; see AccountManager::verifyAccount.
+    /// @param [in] accountNumber The account number to verify.
+    /// @param [in] verificationResult The verification result.
+    /// @return True if verification update succeeded, false otherwise.
+    bool verifyAccount(const std::string& accountNumber, bool verificationResult);
+
+    /// @brief Verifies an account; see AccountManager::verifyAccountAsync.
+    /// @details The shard is locked only while the account is updated, not while the lookups run.
+    /// @param [in] accountNumber The account number to verify.
+    /// @param [in] verificationResult The verification result.
+    /// @return Future receiving the result verifyAccount would return.
+    std::future<bool> verifyAccountAsync(const std::string& accountNumber, bool verificationResult);
+
+    /// @brief Evaluates the risk level of an account; see AccountManager::evaluateAccountRiskAsync.
+    /// @details The shard is unlocked between the call and the wait; the returned future locks it again
+    ///          to finish the lookup and update the account.
+    /// @param [in] accountNumber The account number to evaluate.
+    /// @param [in] transactionCount The number of transactions in the evaluation period.
+    /// @param [in] volumeLastDay The transaction volume from the last day.
+    /// @return Future receiving the status evaluateAccountRisk would return.
+    std::future<AccountStatus> evaluateAccountRiskAsync(const std::string& accountNumber,
+                                                        int transactionCount,
+                                                        double volumeLastDay);
+
+    /// @brief Moves an amount from one active account to another as one atomic step.
+    /// @details Only the shards holding the two accounts are locked, in shard order, so transfers between
+    ///          accounts of disjoint shards run in parallel and two transfers can never deadlock. All
+    ///          transfers touching a hot account queue on its shard lock, together with every other
+    ///          operation on that shard; more shards spread the other accounts away from it, but the hot
+    ///          account itself stays serialized.
+    /// @param [in] source The account to debit.
+    /// @param [in] destination The account to credit.
+    /// @param [in] amount The amount; must be a positive whole number of cents.
+    /// @return True if both balances changed, false if either account refused the change and nothing changed.
+    bool transferBalance(const std::string& source, const std::string& destination, double amount);
+
+    /// @brief Retrieves the current balance of an account.
+    /// @param [in] accountNumber The account number.
+    /// @return The account balance, or -1.0 if not found.
+    double getAccountBalance(const std::string& accountNumber) const;
+
+    /// @brief Retrieves the count of suspended accounts summed over all shards.
+    /// @return The number of suspended accounts.
+    int getSuspendedAccountCount() const;
+
+    /// @brief Retrieves the managed balance summed over all shards.
+    /// @details Every shard is locked for reading at once, so no transfer is seen half applied.
+    /// @return The total managed balance.
+    double getTotalManagedBalance() const;
+
+    /// @brief Retrieves the number of accounts held by the manager.
+    /// @return The account count.
+    int getAccountCount() const;
+};
+
+#endif // CONCURRENT_ACCOUNT_MANAGER_HPP
@@ -0,0 +1,112 @@
+#ifndef DAILY_USAGE_COUNTER_HPP
+#define DAILY_USAGE_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+/// @brief Transactions and volume counted against the daily limits so far.
+struct DailyUsage {
+    int transactionCount;
+    std::int64_t volumeCents;
+};
+
+/// @brief Lock-free daily usage counter: transaction count and volume packed into one atomic word.
+/// @details Callers decide on a loaded DailyUsage and publish the result with compareExchange, so a
+///          limit check and the matching update take effect together; when another thread got there
+///          first the exchange fails and the caller decides again on the fresh usage. The count uses
+///          the low COUNT_BITS bits and the volume, in cents, the remaining ones.
+class DailyUsageCounter {
+private:
+    static const int COUNT_BITS = 24;
+
+    std::atomic<std::uint64_t> state;
+
+    /// @brief Packs a usage into the state word; the usage must fit.
+    /// @param [in] usage The usage to pack.
+    /// @return The state word.
+    static std::uint64_t pack(const DailyUsage& usage);
+
+    /// @brief Unpacks a state word.
+    /// @param [in] word The state word.
+    /// @return The usage it holds.
+    static DailyUsage unpack(std::uint64_t word);
+
+public:
+    static const int MAX_TRANSACTION_COUNT = (1 << COUNT_BITS) - 1;
+    static const std::int64_t MAX_VOLUME_CENTS = (static_cast<std::int64_t>(1) << (64 - COUNT_BITS)) - 1;
+
+    /// @brief Constructs a DailyUsageCounter instance with zero usage.
+    DailyUsageCounter();
+
+    DailyUsageCounter(const DailyUsageCounter&) = delete;
+    DailyUsageCounter& operator=(const DailyUsageCounter&) = delete;
+
+    /// @brief Reads the current usage.
+    /// @return A consistent snapshot of count and volume.
+    DailyUsage load() const;
+
+    /// @brief Replaces the usage if it still equals expected.
+    /// @param [in,out] expected The usage the decision was based on; refreshed on failure.
+    /// @param [in] desired The new usage; must satisfy fits.
+    /// @return True if the usage was replaced, false if it had changed in the meantime.
+    bool compareExchange(DailyUsage& expected, const DailyUsage& desired);
+
+    /// @brief Clears the usage; safe while other threads update it.
+    void reset();
+
+    /// @brief Checks whether a usage can be stored.
+    /// @param [in] usage The usage to check.
+    /// @return True if count and volume are within the packed field widths, false otherwise.
+    static bool fits(const DailyUsage& usage);
+};
+
+/// @brief Tumbling one-day window of DailyUsageCounter slots keyed by transaction timestamp (UTC days).
+/// @details The first transaction of a new day rolls its slot over, so no reset job is needed at the
+///          day boundary. Two slots are kept, so stragglers stamped just before midnight still count
+///          against their own day while the next one has started.
+class DailyUsageWindow {
+private:
+    static const std::size_t SLOT_COUNT = 2;
+    // Day tag of a slot whose usage is being cleared by the thread that rolls it over
+    static const std::int64_t ROLLING_OVER = -1;
+
+    struct Slot {
+        std::atomic<std::int64_t> day;
+        DailyUsageCounter usage;
+    };
+
+    Slot slots[SLOT_COUNT];
+
+public:
+    static const std::int64_t SECONDS_PER_DAY = 86400;
+
+    /// @brief Constructs a DailyUsageWindow instance with no day started.
+    DailyUsageWindow();
+
+    DailyUsageWindow(const DailyUsageWindow&) = delete;
+    DailyUsageWindow& operator=(const DailyUsageWindow&) = delete;
+
+    /// @brief Retrieves the counter of the day a timestamp falls in, rolling its slot over if needed.
+    /// @details A timestamp older than the days kept has no counter; its slot already belongs to a
+    ///          later day, which it must not be counted against.
+    /// @param [in] timestamp The transaction timestamp.
+    /// @return Pointer to the counter of that day, or nullptr if the day is no longer kept.
+    DailyUsageCounter* counterFor(std::time_t timestamp);
+
+    /// @brief Reads the usage of the day a timestamp falls in.
+    /// @param [in] timestamp Any time of the day.
+    /// @return The usage of that day, or zero usage if the day has not started or is no longer kept.
+    DailyUsage load(std::time_t timestamp) const;
+
+    /// @brief Clears the usage of every kept day; safe while other threads update it.
+    void reset();
+
+    /// @brief Converts a timestamp to its day number.
+    /// @param [in] timestamp The timestamp.
+    /// @return Days since the epoch; timestamps before the epoch map to day 0.
+    static std::int64_t dayOf(std::time_t timestamp);
+};
+
+#endif // DAILY_USAGE_COUNTER_HPP
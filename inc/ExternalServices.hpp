@@ -2,6 +2,7 @@
 #define EXTERNAL_SERVICES_HPP
 
 #include <string>
+#include <string_view>
 #include <vector>
 
 enum class VerificationResult {
@@ -75,6 +76,16 @@ public:
     virtual bool isAccountBlacklisted(const std::string& accountNumber) = 0;
 };
 
+/// @brief Audit fields of one processed transaction.
+/// @details The views are only valid for the duration of the AuditLoggingService call receiving them.
+struct AuditEntry {
+    std::string_view accountNumber;
+    std::string_view transactionDetails;
+    std::string_view timestamp;
+    std::string_view eventType;
+    std::string_view eventDetails;
+};
+
 class AuditLoggingService {
 public:
     /// @brief Destructor for AuditLoggingService.
@@ -98,6 +109,35 @@ public:
                                 const std::string& eventType,
                                 const std::string& eventDetails) = 0;
     
+    /// @brief Logs the transaction and account events of one processed transaction.
+    /// @details The default implementation copies the views into strings and forwards them to
+    ///          logTransaction and logAccountEvent; back ends that can consume views directly
+    ///          should override it to keep the transaction path free of allocations.
+    /// @param [in] entry The audit entry.
+    /// @return True if both events were recorded successfully, false otherwise.
+    virtual bool logTransactionEntry(const AuditEntry& entry) {
+        bool transactionLogged = logTransaction(std::string(entry.accountNumber),
+                                                std::string(entry.transactionDetails),
+                                                std::string(entry.timestamp));
+        bool eventLogged = logAccountEvent(std::string(entry.accountNumber),
+                                           std::string(entry.eventType),
+                                           std::string(entry.eventDetails));
+        return transactionLogged && eventLogged;
+    }
+    
+    /// @brief Logs the transaction and account events of a whole batch in one emit.
+    /// @details The default implementation forwards every entry to logTransactionEntry;
+    ///          back ends with a bulk endpoint should override it.
+    /// @param [in] entries The audit entries in processing order.
+    /// @return True if every entry was recorded successfully, false otherwise.
+    virtual bool logTransactionBatch(const std::vector<AuditEntry>& entries) {
+        bool allLogged = true;
+        for (const AuditEntry& entry : entries) {
+            allLogged = logTransactionEntry(entry) && allLogged;
+        }
+        return allLogged;
+    }
+    
     /// @brief Retrieves the audit trail for an account.
     /// @param [in] accountNumber The account number.
     /// @return A vector of audit log entries for the account.
@@ -109,6 +149,35 @@ public:
     virtual bool archiveAuditLogs(const std::string& archiveDate) = 0;
 };
 
+/// @brief Messages sent to customers; the text of each lives in notificationTemplateText.
+enum class NotificationTemplate {
+    ACCOUNT_VERIFIED
+};
+
+/// @brief Subject and body of a notification template.
+struct NotificationTemplateText {
+    std::string_view subject;
+    std::string_view body;
+};
+
+/// @brief Looks up the text of a notification template.
+/// @param [in] notificationTemplate The template.
+/// @return The subject and body; empty for an unknown template.
+inline NotificationTemplateText notificationTemplateText(NotificationTemplate notificationTemplate) {
+    switch (notificationTemplate) {
+        case NotificationTemplate::ACCOUNT_VERIFIED:
+            return {"Account Verified", "Your account has been verified successfully."};
+    }
+    return {};
+}
+
+/// @brief One email of a bulk send.
+struct EmailNotification {
+    std::string email;
+    std::string subject;
+    std::string body;
+};
+
 class NotificationService {
 public:
     /// @brief Destructor for NotificationService.
@@ -123,6 +192,20 @@ public:
                                       const std::string& subject,
                                       const std::string& body) = 0;
     
+    /// @brief Sends several email notifications in one call.
+    /// @details The default implementation forwards every email to sendEmailNotification;
+    ///          gateways with a bulk endpoint should override it.
+    /// @param [in] notifications The emails to send.
+    /// @return One entry per email, true if that email was sent successfully.
+    virtual std::vector<bool> sendEmailNotificationBatch(const std::vector<EmailNotification>& notifications) {
+        std::vector<bool> sent;
+        sent.reserve(notifications.size());
+        for (const EmailNotification& notification : notifications) {
+            sent.push_back(sendEmailNotification(notification.email, notification.subject, notification.body));
+        }
+        return sent;
+    }
+    
     /// @brief Sends an SMS notification.
     /// @param [in] phoneNumber The recipient phone number.
     /// @param [in] message The SMS message content.
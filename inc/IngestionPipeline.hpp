@@ -0,0 +1,130 @@
+#ifndef INGESTION_PIPELINE_HPP
+#define INGESTION_PIPELINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "SpscQueue.hpp"
+#include "Transaction.hpp"
+#include "TransactionProcessor.hpp"
+
+enum class IngestionFormat {
+    CSV,        // one "type,amount,source,destination[,accountType]" row per line, names as in the enums
+    BINARY      // packed TransactionHistoryRecord array, as exported from a history segment
+};
+
+/// @brief Stages fed by a bounded queue; indexes the queue depths of a pipeline.
+enum class IngestionStage {
+    VALIDATE,
+    SCREEN,
+    EXECUTE
+};
+
+static const std::size_t INGESTION_QUEUE_COUNT = 3;
+
+/// @brief Totals of one ingestion run.
+struct IngestionReport {
+    std::size_t rowCount;                                           // rows handed to the processor
+    std::size_t malformedCount;                                     // rows the parser skipped
+    std::size_t batchCount;
+    std::array<std::size_t, 5> statusCounts;                        // indexed by TransactionStatus
+    std::array<std::size_t, INGESTION_QUEUE_COUNT> peakQueueDepths; // indexed by IngestionStage
+};
+
+/// @brief Streams a mapped CSV or binary transaction file through a TransactionProcessor.
+/// @details The calling thread parses rows straight out of the mapping into recycled batches;
+///          one thread each then runs TransactionProcessor::validateBatch, screenBatch and
+///          executeBatch. The stages are connected by bounded SpscQueues and a fixed set of batches
+///          circulates from the executor back to the parser, so a slow stage stalls the ones before it
+///          instead of letting memory grow. Batches are executed in file order, so the daily limits
+///          cut off as in processBatch over the same batches. One ingestion runs at a time.
+class IngestionPipeline {
+private:
+    /// @brief Reusable unit of work; the request strings keep their storage between batches.
+    struct Batch {
+        std::vector<TransactionRequest> requests;
+        std::size_t count;
+        TransactionBatchState state;
+    };
+
+    TransactionProcessor& processor;
+    std::size_t batchSize;
+    std::vector<std::unique_ptr<Batch>> batches;
+
+    // Empty batches returning from the executor to the parser
+    SpscQueue<Batch*> freeBatches;
+    // Input queue of every stage, indexed by IngestionStage; nullptr marks the end of the stream
+    std::array<std::unique_ptr<SpscQueue<Batch*>>, INGESTION_QUEUE_COUNT> stageQueues;
+
+    /// @brief Forwards batches from one queue to the next, applying a stage to each, until the end of the stream.
+    /// @param [in] stage The stage to apply.
+    /// @param [in,out] report Receives the peak depth of the output queue, or the statuses after execution.
+    void runStage(IngestionStage stage, IngestionReport& report);
+
+    /// @brief Parses CSV rows into batches and feeds them to the first stage.
+    /// @param [in] data The first byte of the CSV text.
+    /// @param [in] size The number of bytes.
+    /// @param [in,out] report Receives the row, malformed and batch counts and the validate queue peak.
+    void parseCsv(const char* data, std::size_t size, IngestionReport& report);
+
+    /// @brief Parses binary records into batches and feeds them to the first stage.
+    /// @param [in] data The first byte of the records.
+    /// @param [in] size The number of bytes.
+    /// @param [in,out] report Receives the row, malformed and batch counts and the validate queue peak.
+    void parseBinary(const char* data, std::size_t size, IngestionReport& report);
+
+    /// @brief Sends a filled batch to the first stage.
+    /// @param [in] batch The batch; an empty one only counts towards the queue depth.
+    /// @param [in,out] report Receives the batch count and the validate queue peak.
+    void submitBatch(Batch* batch, IngestionReport& report);
+
+public:
+    static const std::size_t DEFAULT_BATCH_SIZE = 1024;
+    static const std::size_t DEFAULT_QUEUE_CAPACITY = 8;
+
+    /// @brief Constructs an IngestionPipeline instance.
+    /// @param [in] processor The processor executing the rows; its services are used as configured.
+    /// @param [in] batchSize The maximum number of rows per batch (at least 1).
+    /// @param [in] queueCapacity The capacity of every stage queue (at least 1).
+    explicit IngestionPipeline(TransactionProcessor& processor,
+                               std::size_t batchSize = DEFAULT_BATCH_SIZE,
+                               std::size_t queueCapacity = DEFAULT_QUEUE_CAPACITY);
+
+    IngestionPipeline(const IngestionPipeline&) = delete;
+    IngestionPipeline& operator=(const IngestionPipeline&) = delete;
+
+    /// @brief Ingests transactions from memory.
+    /// @param [in] data The first byte of the input; read in place, never copied.
+    /// @param [in] size The number of bytes.
+    /// @param [in] format The input format.
+    /// @return The totals of the run.
+    IngestionReport ingest(const char* data, std::size_t size, IngestionFormat format);
+
+    /// @brief Maps a file read-only and ingests it.
+    /// @param [in] path The file to ingest.
+    /// @param [in] format The input format.
+    /// @param [out] report The totals of the run.
+    /// @return True if the file was ingested, false if it could not be mapped or is empty.
+    bool ingestFile(const std::string& path, IngestionFormat format, IngestionReport& report);
+
+    /// @brief Parses one CSV row.
+    /// @details A missing or empty account type selects DEFAULT_TRANSACTION_PRODUCT; the destination may be empty.
+    /// @param [in] row The row without its line terminator.
+    /// @param [out] request Receives the fields; its strings are reused.
+    /// @return True if the row is well formed, false otherwise.
+    static bool parseCsvRow(std::string_view row, TransactionRequest& request);
+
+    /// @brief Retrieves the current depth of every stage queue; may be called during an ingestion.
+    /// @return The queued batch counts, indexed by IngestionStage.
+    std::array<std::size_t, INGESTION_QUEUE_COUNT> getQueueDepths() const;
+
+    /// @brief Retrieves the maximum number of rows per batch.
+    /// @return The batch size.
+    std::size_t getBatchSize() const;
+};
+
+#endif // INGESTION_PIPELINE_HPP
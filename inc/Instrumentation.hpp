@@ -0,0 +1,257 @@
+#ifndef INSTRUMENTATION_HPP
+#define INSTRUMENTATION_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "Account.hpp"
+#include "Transaction.hpp"
+
+/// @brief Operations with a latency histogram.
+/// @details The first group times our own entry points, including the dependencies they call;
+///          the second group times every call into an ExternalServices.hpp interface on its own,
+///          so a slow dependency can be told apart from time spent in this code.
+enum class LatencyMetric : std::uint8_t {
+    PROCESS_TRANSACTION,
+    EXECUTE_TRANSFER,
+    EVALUATE_ACCOUNT_RISK,
+    VERIFY_ACCOUNT,
+    COMPLIANCE_CHECK,        // ComplianceCheckService::checkComplianceLevel
+    RATE_LIMIT_INCREMENT,    // RateLimitingService::incrementRateCounter
+    AUDIT_LOG,               // AuditLoggingService::logTransactionEntry / logTransactionBatch
+    LINKED_ACCOUNTS,         // ExternalDataService::getLinkedAccounts
+    IDENTITY_STATUS,         // ExternalDataService::getIdentityVerificationStatus
+    CREDIT_SCORE,            // ExternalDataService::getCreditScore
+    EMAIL_NOTIFICATION       // NotificationService::sendEmailNotification / sendEmailNotificationBatch
+};
+
+/// @brief Counted events of the notification dispatchers.
+enum class NotificationEvent : std::uint8_t {
+    ENQUEUED,       // accepted into a queue
+    COALESCED,      // folded into an identical queued message
+    DROPPED,        // refused because the queue was full
+    DISPATCHED,     // taken off a queue for a send attempt
+    SENT,
+    RETRIED,        // put back on a queue after a failed attempt
+    FAILED          // given up after the last attempt
+};
+
+inline constexpr std::size_t LATENCY_METRIC_COUNT = 11;
+inline constexpr std::size_t NOTIFICATION_EVENT_COUNT = 7;
+inline constexpr std::size_t TRANSACTION_STATUS_COUNT = 5;
+inline constexpr std::size_t ACCOUNT_STATUS_COUNT = 5;
+
+/// @brief Bucket layout of the latency histograms.
+/// @details Log-linear like an HDR histogram: values below 2 * LATENCY_SUB_BUCKET_COUNT nanoseconds
+///          get one bucket each, and every further power of two is split into LATENCY_SUB_BUCKET_COUNT
+///          buckets, so a bucket is never wider than 1/16 of its lower bound. Values at or above
+///          LATENCY_MAX_NANOSECONDS (about 68 seconds) land in the last bucket.
+inline constexpr unsigned LATENCY_SUB_BUCKET_BITS = 4;
+inline constexpr std::uint64_t LATENCY_SUB_BUCKET_COUNT = 1ULL << LATENCY_SUB_BUCKET_BITS;
+inline constexpr unsigned LATENCY_MAX_EXPONENT = 36;
+inline constexpr std::uint64_t LATENCY_MAX_NANOSECONDS = 1ULL << LATENCY_MAX_EXPONENT;
+inline constexpr std::size_t LATENCY_BUCKET_COUNT =
+    (LATENCY_MAX_EXPONENT - LATENCY_SUB_BUCKET_BITS + 1) * LATENCY_SUB_BUCKET_COUNT;
+
+/// @brief Maps a latency to its histogram bucket.
+/// @param [in] nanoseconds The latency.
+/// @return The bucket index, in [0, LATENCY_BUCKET_COUNT).
+constexpr std::size_t latencyBucketIndex(std::uint64_t nanoseconds) {
+    if (nanoseconds >= LATENCY_MAX_NANOSECONDS) {
+        return LATENCY_BUCKET_COUNT - 1;
+    }
+    if (nanoseconds < 2 * LATENCY_SUB_BUCKET_COUNT) {
+        return static_cast<std::size_t>(nanoseconds);
+    }
+    unsigned exponent = 0;
+    for (std::uint64_t value = nanoseconds; value > 1; value >>= 1) {
+        ++exponent;
+    }
+    const unsigned shift = exponent - LATENCY_SUB_BUCKET_BITS;
+    return static_cast<std::size_t>((shift + 1) * LATENCY_SUB_BUCKET_COUNT +
+                                    ((nanoseconds >> shift) - LATENCY_SUB_BUCKET_COUNT));
+}
+
+/// @brief Smallest latency that maps to a bucket.
+/// @param [in] bucket The bucket index.
+/// @return The lower bound in nanoseconds.
+constexpr std::uint64_t latencyBucketLowerBound(std::size_t bucket) {
+    if (bucket < 2 * LATENCY_SUB_BUCKET_COUNT) {
+        return bucket;
+    }
+    const std::size_t shift = bucket / LATENCY_SUB_BUCKET_COUNT - 1;
+    return (LATENCY_SUB_BUCKET_COUNT + bucket % LATENCY_SUB_BUCKET_COUNT) << shift;
+}
+
+static_assert(latencyBucketIndex(LATENCY_MAX_NANOSECONDS - 1) == LATENCY_BUCKET_COUNT - 1,
+              "the last bucket ends at the maximum latency");
+static_assert(latencyBucketLowerBound(latencyBucketIndex(1000)) <= 1000 &&
+              latencyBucketLowerBound(latencyBucketIndex(1000) + 1) > 1000,
+              "the bucket bounds invert the index");
+
+/// @brief Merged latency histogram of one operation.
+struct LatencyHistogramSnapshot {
+    std::array<std::uint64_t, LATENCY_BUCKET_COUNT> buckets;
+    std::uint64_t count;
+    std::uint64_t totalNanoseconds;
+    std::uint64_t maxNanoseconds;
+
+    /// @brief Estimates a percentile from the buckets.
+    /// @param [in] percentile The percentile, in [0, 100].
+    /// @return The lower bound of the bucket holding the percentile, capped at maxNanoseconds; 0 if empty.
+    std::uint64_t valueAtPercentile(double percentile) const;
+
+    /// @brief Computes the mean latency.
+    /// @return The mean in nanoseconds; 0 if empty.
+    double meanNanoseconds() const;
+};
+
+/// @brief Everything the instrumentation collected, merged across threads.
+struct InstrumentationSnapshot {
+    std::array<LatencyHistogramSnapshot, LATENCY_METRIC_COUNT> latencies;
+    std::array<std::uint64_t, TRANSACTION_STATUS_COUNT> transactionOutcomes;  // indexed by TransactionStatus
+    std::array<std::uint64_t, ACCOUNT_STATUS_COUNT> accountOutcomes;          // indexed by AccountStatus
+    std::array<std::uint64_t, NOTIFICATION_EVENT_COUNT> notificationEvents;   // indexed by NotificationEvent
+
+    /// @brief Retrieves the histogram of an operation.
+    /// @param [in] metric The operation.
+    /// @return Reference to the histogram.
+    const LatencyHistogramSnapshot& latency(LatencyMetric metric) const;
+
+    /// @brief Retrieves how often a transaction call returned a status.
+    /// @param [in] status The status.
+    /// @return The count.
+    std::uint64_t transactionOutcome(TransactionStatus status) const;
+
+    /// @brief Retrieves how often a risk evaluation returned a status.
+    /// @param [in] status The status.
+    /// @return The count.
+    std::uint64_t accountOutcome(AccountStatus status) const;
+
+    /// @brief Retrieves how often a notification event occurred.
+    /// @param [in] event The event.
+    /// @return The count.
+    std::uint64_t notificationCount(NotificationEvent event) const;
+
+    /// @brief Computes the number of notifications queued in all dispatchers.
+    /// @return Enqueued plus retried minus dispatched notifications, at least 0.
+    std::uint64_t notificationQueueDepth() const;
+};
+
+/// @brief Process-wide latency histograms and outcome counters.
+/// @details Every thread records into its own shard with relaxed single-writer updates, so the
+///          hot paths never contend; snapshot merges the live shards with those of threads that
+///          have exited. Built with the CMake option ENABLE_INSTRUMENTATION=OFF, the recording
+///          helpers below are empty inline functions and the instrumented classes compile to the
+///          same code as without them; snapshot then returns zeros.
+class Instrumentation {
+public:
+#if defined(INSTRUMENTATION_ENABLED)
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    /// @brief Records one latency sample on the calling thread.
+    /// @param [in] metric The operation.
+    /// @param [in] nanoseconds The latency.
+    static void recordLatency(LatencyMetric metric, std::uint64_t nanoseconds);
+
+    /// @brief Counts one transaction result on the calling thread.
+    /// @param [in] status The status returned.
+    static void countTransactionOutcome(TransactionStatus status);
+
+    /// @brief Counts one risk evaluation result on the calling thread.
+    /// @param [in] status The status returned.
+    static void countAccountOutcome(AccountStatus status);
+
+    /// @brief Counts notification events on the calling thread.
+    /// @param [in] event The event.
+    /// @param [in] count The number of notifications it applies to.
+    static void countNotification(NotificationEvent event, std::uint64_t count = 1);
+
+    /// @brief Merges the shards of all threads.
+    /// @return The collected values.
+    static InstrumentationSnapshot snapshot();
+
+    /// @brief Zeroes every shard.
+    /// @details Samples recorded concurrently with the reset may be kept or lost.
+    static void reset();
+};
+
+#if defined(INSTRUMENTATION_ENABLED)
+
+/// @brief Records the time from construction to destruction into a latency histogram.
+class ScopedLatencyTimer {
+private:
+    LatencyMetric metric;
+    std::chrono::steady_clock::time_point start;
+
+public:
+    /// @brief Starts the timer.
+    /// @param [in] metric The operation being timed.
+    explicit ScopedLatencyTimer(LatencyMetric metric)
+        : metric(metric), start(std::chrono::steady_clock::now()) {
+    }
+
+    /// @brief Stops the timer and records the sample.
+    ~ScopedLatencyTimer() {
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        Instrumentation::recordLatency(metric, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+};
+
+/// @brief Counts a transaction result and passes it through.
+/// @param [in] status The status being returned.
+/// @return status.
+inline TransactionStatus countedOutcome(TransactionStatus status) {
+    Instrumentation::countTransactionOutcome(status);
+    return status;
+}
+
+/// @brief Counts a risk evaluation result and passes it through.
+/// @param [in] status The status being returned.
+/// @return status.
+inline AccountStatus countedOutcome(AccountStatus status) {
+    Instrumentation::countAccountOutcome(status);
+    return status;
+}
+
+#else
+
+class ScopedLatencyTimer {
+public:
+    explicit ScopedLatencyTimer(LatencyMetric) {
+    }
+
+    ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+    ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+};
+
+inline TransactionStatus countedOutcome(TransactionStatus status) {
+    return status;
+}
+
+inline AccountStatus countedOutcome(AccountStatus status) {
+    return status;
+}
+
+#endif // INSTRUMENTATION_ENABLED
+
+/// @brief Times one call into an external service.
+/// @param [in] metric The histogram of the service method.
+/// @param [in] call Callable performing the service call.
+/// @return What the call returned.
+template <typename Call>
+decltype(auto) timedServiceCall(LatencyMetric metric, Call&& call) {
+    const ScopedLatencyTimer timer(metric);
+    return call();
+}
+
+#endif // INSTRUMENTATION_HPP
@@ -0,0 +1,70 @@
+#ifndef MAPPED_ACCOUNT_BOOK_HPP
+#define MAPPED_ACCOUNT_BOOK_HPP
+
+#include <cstddef>
+#include <string>
+
+#include "AccountJournal.hpp"
+#include "MappedFile.hpp"
+
+/// @brief Read-only view of an account snapshot served straight from a file mapping.
+/// @details Opening validates only the header, so readiness does not depend on the account count;
+///          record pages fault in when first looked up. Records are found by an interpolation search
+///          over the id-sorted images, which lands on the right page in one probe for the dense ids
+///          the account counter hands out. The account number is not stored: it is "ACC<accountId>".
+class MappedAccountBook {
+private:
+    MappedFile file;
+    const AccountSnapshotHeader* header;
+    const AccountLogRecord* records;
+    std::size_t recordCount;
+
+public:
+    /// @brief Constructs a MappedAccountBook instance with no snapshot mapped.
+    MappedAccountBook();
+
+    MappedAccountBook(const MappedAccountBook&) = delete;
+    MappedAccountBook& operator=(const MappedAccountBook&) = delete;
+
+    /// @brief Maps a snapshot written by AccountSnapshot::write.
+    /// @details Checks the header and the file size but not the checksum; see verify.
+    /// @param [in] path The snapshot file path.
+    /// @return True if the snapshot is mapped, false if missing or not an id-sorted snapshot.
+    bool open(const std::string& path);
+
+    /// @brief Unmaps the snapshot.
+    void close();
+
+    /// @brief Checks whether a snapshot is mapped.
+    /// @return True if mapped, false otherwise.
+    bool isOpen() const;
+
+    /// @brief Recomputes the snapshot checksum; touches every page of the file.
+    /// @return True if the mapped snapshot is intact, false otherwise.
+    bool verify() const;
+
+    /// @brief Finds the image of an account by numeric id.
+    /// @param [in] accountId The account id.
+    /// @return Pointer into the mapping, or nullptr if not found.
+    const AccountLogRecord* find(int accountId) const;
+
+    /// @brief Finds the image of an account by account number.
+    /// @param [in] accountNumber The account number.
+    /// @return Pointer into the mapping, or nullptr if not found or not canonical.
+    const AccountLogRecord* find(const std::string& accountNumber) const;
+
+    /// @brief Accesses an image by position in id order.
+    /// @param [in] position The position, in [0, size()).
+    /// @return Reference to the image.
+    const AccountLogRecord& recordAt(std::size_t position) const;
+
+    /// @brief Accesses the snapshot header.
+    /// @return Reference to the mapped header; only valid while open.
+    const AccountSnapshotHeader& getHeader() const;
+
+    /// @brief Retrieves the number of accounts in the snapshot.
+    /// @return The account count, or 0 if nothing is mapped.
+    std::size_t size() const;
+};
+
+#endif // MAPPED_ACCOUNT_BOOK_HPP
@@ -0,0 +1,80 @@
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+/// @brief Portable memory mapping of a whole file (POSIX mmap or Win32 file mappings).
+class MappedFile {
+private:
+    char* mappedData;
+    std::size_t mappedSize;
+    bool writable;
+
+#if defined(_WIN32)
+    void* fileHandle;
+    void* mappingHandle;
+#else
+    int fileDescriptor;
+#endif
+
+    /// @brief Maps the currently open file with the given size.
+    /// @param [in] size The number of bytes to map.
+    /// @return True if the mapping succeeded, false otherwise.
+    bool mapOpenFile(std::size_t size);
+
+    /// @brief Removes the current mapping while keeping the file open.
+    void unmap();
+
+public:
+    /// @brief Constructs a MappedFile instance with no file attached.
+    MappedFile();
+
+    /// @brief Unmaps and closes the file.
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /// @brief Maps an existing file read-only.
+    /// @param [in] path The file to map.
+    /// @return True if the file was mapped, false otherwise.
+    bool openReadOnly(const std::string& path);
+
+    /// @brief Opens or creates a file for reading and writing and maps at least the given size.
+    /// @details The file is extended with zero bytes if it is shorter than minimumSize.
+    /// @param [in] path The file to map.
+    /// @param [in] minimumSize The minimum mapped size in bytes.
+    /// @return True if the file was mapped, false otherwise.
+    bool openReadWrite(const std::string& path, std::size_t minimumSize);
+
+    /// @brief Extends a writable file and remaps it; pointers into the old mapping become invalid.
+    /// @param [in] newSize The new file size in bytes.
+    /// @return True if the file was extended and remapped, false otherwise.
+    bool resize(std::size_t newSize);
+
+    /// @brief Writes dirty pages back to the file.
+    /// @return True if the pages were written, false otherwise.
+    bool sync();
+
+    /// @brief Unmaps and closes the file.
+    void close();
+
+    /// @brief Checks whether a file is mapped.
+    /// @return True if a file is mapped, false otherwise.
+    bool isOpen() const;
+
+    /// @brief Accesses the mapped bytes.
+    /// @return Pointer to the first mapped byte, or nullptr if nothing is mapped.
+    char* data();
+
+    /// @brief Accesses the mapped bytes.
+    /// @return Pointer to the first mapped byte, or nullptr if nothing is mapped.
+    const char* data() const;
+
+    /// @brief Retrieves the mapped size.
+    /// @return The number of mapped bytes.
+    std::size_t size() const;
+};
+
+#endif // MAPPED_FILE_HPP
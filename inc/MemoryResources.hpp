@@ -0,0 +1,67 @@
+#ifndef MEMORY_RESOURCES_HPP
+#define MEMORY_RESOURCES_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+/// @brief Allocation counters of a memory resource.
+struct AllocationStats {
+    std::size_t allocationCount;
+    std::size_t deallocationCount;
+    std::size_t bytesAllocated;
+    std::size_t bytesInUse;
+    std::size_t peakBytesInUse;
+};
+
+/// @brief Memory resource that forwards to an upstream resource and counts what passes through.
+/// @details The counters are atomic, so one instance may sit below resources used by several threads.
+///          Components own one in front of the resource they are given and report it as their
+///          allocation statistics; a monotonic or pool resource upstream shows up as fewer, larger requests.
+class CountingMemoryResource : public std::pmr::memory_resource {
+private:
+    std::pmr::memory_resource* upstream;
+    std::atomic<std::size_t> allocationCount;
+    std::atomic<std::size_t> deallocationCount;
+    std::atomic<std::size_t> bytesAllocated;
+    std::atomic<std::size_t> bytesInUse;
+    std::atomic<std::size_t> peakBytesInUse;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    /// @brief Constructs a CountingMemoryResource instance.
+    /// @param [in] upstream The resource that serves the allocations; nullptr means std::pmr::get_default_resource().
+    explicit CountingMemoryResource(std::pmr::memory_resource* upstream = nullptr);
+
+    CountingMemoryResource(const CountingMemoryResource&) = delete;
+    CountingMemoryResource& operator=(const CountingMemoryResource&) = delete;
+
+    /// @brief Retrieves the resource the allocations are forwarded to.
+    /// @return Pointer to the upstream resource.
+    std::pmr::memory_resource* getUpstream() const;
+
+    /// @brief Retrieves the counters.
+    /// @return The allocation statistics since construction.
+    AllocationStats getStats() const;
+};
+
+/// @brief Per-thread pool for scratch memory that does not outlive the call that allocates it.
+/// @details Each thread gets an unsynchronized pool, so hot paths allocate without taking a lock
+///          and reuse the blocks of earlier calls on the same thread. The pools take their memory
+///          from one shared CountingMemoryResource, whose counters getStats reports. Memory from
+///          the pool of a thread must be released on that thread before it exits.
+class ThreadScratchPool {
+public:
+    /// @brief Retrieves the pool of the calling thread.
+    /// @return Pointer to the pool resource.
+    static std::pmr::memory_resource* local();
+
+    /// @brief Retrieves what the pools of all threads took from the heap.
+    /// @return The allocation statistics of the shared upstream resource.
+    static AllocationStats getStats();
+};
+
+#endif // MEMORY_RESOURCES_HPP
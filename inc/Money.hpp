@@ -0,0 +1,187 @@
+#ifndef MONEY_HPP
+#define MONEY_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+/// @brief Amount of money as a signed 64-bit count of cents.
+/// @details Comparisons and sums are exact integer operations, so aggregates never drift and fit in
+///          one atomic word. Conversion from double rounds to the nearest cent (halves away from zero),
+///          saturates at the limits and maps NaN to zero; it is implicit so existing double call sites
+///          and literals keep working. Arithmetic saturates as well; the checked variants report overflow.
+class Money {
+private:
+    struct CentsTag {};
+
+    std::int64_t cents;
+
+    /// @brief Constructs a Money instance from a count of cents.
+    /// @param [in] cents The amount in cents.
+    constexpr Money(std::int64_t cents, CentsTag) : cents(cents) {
+    }
+
+public:
+    static constexpr std::int64_t CENTS_PER_UNIT = 100;
+
+
+    /// @brief Constructs a zero amount.
+    constexpr Money() : cents(0) {
+    }
+
+    /// @brief Constructs a Money instance from an amount in currency units, rounding to the nearest cent.
+    /// @param [in] amount The amount; NaN is zero, out-of-range values saturate.
+    constexpr Money(double amount) : cents(0) {
+        const double scaled = amount * static_cast<double>(CENTS_PER_UNIT);
+        if (scaled != scaled) {
+            cents = 0;
+        } else if (scaled >= 9223372036854775807.0) {
+            cents = std::numeric_limits<std::int64_t>::max();
+        } else if (scaled <= -9223372036854775807.0) {
+            cents = -std::numeric_limits<std::int64_t>::max();
+        } else if (scaled >= 0.0) {
+            cents = static_cast<std::int64_t>(scaled + 0.5);
+        } else {
+            cents = -static_cast<std::int64_t>(0.5 - scaled);
+        }
+    }
+
+    /// @brief Creates an amount from a count of cents.
+    /// @param [in] cents The amount in cents.
+    /// @return The amount.
+    static constexpr Money fromCents(std::int64_t cents) {
+        return Money(cents, CentsTag());
+    }
+
+    /// @brief Converts a double only if it denotes a whole number of cents.
+    /// @details The amount is rounded to cents and accepted only if those cents convert back to the very
+    ///          same double. That holds for the nearest double of every decimal with two places, at any
+    ///          magnitude, and fails for every other double, NaN and infinities.
+    /// @param [in] amount The amount in currency units.
+    /// @param [out] result The amount; unchanged on failure.
+    /// @return True if the amount was converted, false otherwise.
+    static bool fromExactAmount(double amount, Money& result) {
+        const double scaled = amount * static_cast<double>(CENTS_PER_UNIT);
+        const double rounded = std::nearbyint(scaled);
+        if (!(rounded > -9223372036854775808.0 && rounded < 9223372036854775808.0)) {
+            return false;
+        }
+        const std::int64_t cents = static_cast<std::int64_t>(rounded);
+        if (static_cast<double>(cents) / static_cast<double>(CENTS_PER_UNIT) != amount) {
+            return false;
+        }
+        result = Money(cents, CentsTag());
+        return true;
+    }
+
+    /// @brief Retrieves the largest representable amount.
+    /// @return The amount.
+    static constexpr Money max() {
+        return Money(std::numeric_limits<std::int64_t>::max(), CentsTag());
+    }
+
+    /// @brief Retrieves the smallest amount; its negation is max().
+    /// @return The amount.
+    static constexpr Money min() {
+        return Money(-std::numeric_limits<std::int64_t>::max(), CentsTag());
+    }
+
+    /// @brief Retrieves the amount in cents.
+    /// @return The count of cents.
+    constexpr std::int64_t toCents() const {
+        return cents;
+    }
+
+    /// @brief Retrieves the amount in currency units, for display and double-based interfaces.
+    /// @return The nearest double.
+    constexpr double toDouble() const {
+        return static_cast<double>(cents) / static_cast<double>(CENTS_PER_UNIT);
+    }
+
+    /// @brief Adds two amounts unless the sum overflows.
+    /// @param [in] left The first amount.
+    /// @param [in] right The second amount.
+    /// @param [out] result The sum; unchanged on failure.
+    /// @return True if the sum is representable, false otherwise.
+    static constexpr bool checkedAdd(Money left, Money right, Money& result) {
+        if (right.cents > 0 ? left.cents > max().cents - right.cents : left.cents < min().cents - right.cents) {
+            return false;
+        }
+        result = Money(left.cents + right.cents, CentsTag());
+        return true;
+    }
+
+    /// @brief Subtracts two amounts unless the difference overflows.
+    /// @param [in] left The amount to subtract from.
+    /// @param [in] right The amount to subtract.
+    /// @param [out] result The difference; unchanged on failure.
+    /// @return True if the difference is representable, false otherwise.
+    static constexpr bool checkedSubtract(Money left, Money right, Money& result) {
+        if (right.cents > 0 ? left.cents < min().cents + right.cents : left.cents > max().cents + right.cents) {
+            return false;
+        }
+        result = Money(left.cents - right.cents, CentsTag());
+        return true;
+    }
+
+    constexpr Money& operator+=(Money other) {
+        if (!checkedAdd(*this, other, *this)) {
+            *this = other.cents > 0 ? max() : min();
+        }
+        return *this;
+    }
+
+    constexpr Money& operator-=(Money other) {
+        if (!checkedSubtract(*this, other, *this)) {
+            *this = other.cents > 0 ? min() : max();
+        }
+        return *this;
+    }
+
+    friend constexpr Money operator+(Money left, Money right) {
+        return left += right;
+    }
+
+    friend constexpr Money operator-(Money left, Money right) {
+        return left -= right;
+    }
+
+    friend constexpr Money operator-(Money amount) {
+        return Money(-amount.cents, CentsTag());
+    }
+
+    friend constexpr bool operator==(Money left, Money right) {
+        return left.cents == right.cents;
+    }
+
+    friend constexpr bool operator!=(Money left, Money right) {
+        return left.cents != right.cents;
+    }
+
+    friend constexpr bool operator<(Money left, Money right) {
+        return left.cents < right.cents;
+    }
+
+    friend constexpr bool operator<=(Money left, Money right) {
+        return left.cents <= right.cents;
+    }
+
+    friend constexpr bool operator>(Money left, Money right) {
+        return left.cents > right.cents;
+    }
+
+    friend constexpr bool operator>=(Money left, Money right) {
+        return left.cents >= right.cents;
+    }
+
+    /// @brief Writes the amount with two decimals, e.g. "-12.05".
+    friend std::ostream& operator<<(std::ostream& stream, Money amount) {
+        const std::int64_t magnitude = amount.cents < 0 ? -amount.cents : amount.cents;
+        const std::int64_t fraction = magnitude % CENTS_PER_UNIT;
+        stream << (amount.cents < 0 ? "-" : "") << magnitude / CENTS_PER_UNIT << (fraction < 10 ? ".0" : ".") << fraction;
+        return stream;
+    }
+};
+
+#endif // MONEY_HPP
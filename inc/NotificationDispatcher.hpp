@@ -0,0 +1,128 @@
+#ifndef NOTIFICATION_DISPATCHER_HPP
+#define NOTIFICATION_DISPATCHER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "AsyncExternalServices.hpp"
+#include "ExternalServices.hpp"
+
+/// @brief Counters of one NotificationDispatcher.
+struct NotificationDispatcherStats {
+    std::size_t queueDepth;        // queued messages, including those waiting to be retried
+    std::size_t enqueuedCount;
+    std::size_t coalescedCount;    // requests folded into an identical queued message
+    std::size_t droppedCount;      // requests refused because the queue was full
+    std::size_t sentCount;
+    std::size_t retriedCount;      // failed attempts that were queued again
+    std::size_t failedCount;       // messages given up after the last attempt
+    std::size_t batchCount;        // sendEmailNotificationBatch calls
+};
+
+/// @brief Queues email notifications and sends them in batches from its own workers.
+/// @details A request only takes a short lock and never waits for the gateway: while a message
+///          for the same recipient and template is still queued, further requests are folded into
+///          it, and once the queue is full new messages are dropped and counted. Workers take up to
+///          batchSize messages at a time and hand them to NotificationService::sendEmailNotificationBatch.
+///          A failed message is queued again after an exponential backoff until its attempts run out.
+///          Every event is also counted in Instrumentation. The dispatcher is thread-safe; the
+///          wrapped service must be too unless the dispatcher has a single worker.
+class NotificationDispatcher : public AsyncNotificationService {
+private:
+    /// @brief A message waiting in the queue.
+    struct PendingNotification {
+        std::string key;               // recipient and template; identical keys are coalesced
+        EmailNotification message;
+        int attempts;
+        std::chrono::steady_clock::time_point readyAt;
+    };
+
+    NotificationService& service;
+    std::size_t queueCapacity;
+    std::size_t batchSize;
+    int maxAttempts;
+    std::chrono::milliseconds initialBackoff;
+
+    mutable std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable idle;
+    // Messages due for sending, oldest first
+    std::deque<PendingNotification> ready;
+    // Messages waiting out their backoff, a min-heap on readyAt
+    std::vector<PendingNotification> retrying;
+    std::unordered_set<std::string> queuedKeys;
+    std::size_t inFlightCount;
+    bool stopRequested;
+    NotificationDispatcherStats stats;
+    std::vector<std::thread> workers;
+
+    /// @brief Queues a message unless an identical one is queued or the queue is full.
+    /// @param [in] key The coalescing key.
+    /// @param [in] message The message.
+    void enqueue(std::string key, EmailNotification message);
+
+    /// @brief Sends batches until the dispatcher is destroyed and nothing is left to send.
+    void workerLoop();
+
+    /// @brief Moves the retries whose backoff has passed to the ready queue; the lock must be held.
+    /// @param [in] now The current time.
+    void promoteDueRetries(std::chrono::steady_clock::time_point now);
+
+    /// @brief Counts the outcome of one attempt and queues a failed message again; the lock must be held.
+    /// @param [in] notification The message that was attempted.
+    /// @param [in] sent Whether the attempt succeeded.
+    /// @param [in] now The time the attempt finished.
+    void completeAttempt(PendingNotification& notification, bool sent, std::chrono::steady_clock::time_point now);
+
+public:
+    static const std::size_t DEFAULT_WORKER_COUNT = 2;
+    static const std::size_t DEFAULT_QUEUE_CAPACITY = 4096;
+    static const std::size_t DEFAULT_BATCH_SIZE = 32;
+    static const int DEFAULT_MAX_ATTEMPTS = 4;
+    static const int DEFAULT_INITIAL_BACKOFF_MS = 50;
+
+    /// @brief Constructs a NotificationDispatcher instance and starts its workers.
+    /// @param [in] service The gateway sending the emails.
+    /// @param [in] workerCount The number of worker threads (at least 1).
+    /// @param [in] queueCapacity The maximum number of queued messages (at least 1).
+    /// @param [in] batchSize The maximum number of messages per send (at least 1).
+    explicit NotificationDispatcher(NotificationService& service,
+                                    std::size_t workerCount = DEFAULT_WORKER_COUNT,
+                                    std::size_t queueCapacity = DEFAULT_QUEUE_CAPACITY,
+                                    std::size_t batchSize = DEFAULT_BATCH_SIZE);
+
+    /// @brief Sends everything still queued, retries included, then stops and joins the workers.
+    ~NotificationDispatcher() override;
+
+    NotificationDispatcher(const NotificationDispatcher&) = delete;
+    NotificationDispatcher& operator=(const NotificationDispatcher&) = delete;
+
+    /// @brief Sets the retry policy; it applies to every attempt finishing from now on.
+    /// @param [in] maxAttempts The number of send attempts per message (at least 1).
+    /// @param [in] initialBackoff The delay before the first retry; it doubles with every further retry.
+    void setRetryPolicy(int maxAttempts, std::chrono::milliseconds initialBackoff);
+
+    /// @brief Queues an email; identical queued emails to the same recipient are coalesced.
+    void sendEmailNotificationAsync(const std::string& email,
+                                    const std::string& subject,
+                                    const std::string& body) override;
+
+    /// @brief Queues the email of a template; queued emails of the same template to the same recipient are coalesced.
+    void sendTemplateNotificationAsync(const std::string& email, NotificationTemplate notificationTemplate) override;
+
+    /// @brief Blocks until the queue is empty and no batch is being sent.
+    void flush();
+
+    /// @brief Retrieves the counters of this dispatcher.
+    /// @return The counters at some moment during the call.
+    NotificationDispatcherStats getStats() const;
+};
+
+#endif // NOTIFICATION_DISPATCHER_HPP
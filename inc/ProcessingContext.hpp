@@ -0,0 +1,31 @@
+#ifndef PROCESSING_CONTEXT_HPP
+#define PROCESSING_CONTEXT_HPP
+
+#include <atomic>
+#include <cstdint>
+
+/// @brief System-wide switches and totals shared by the processors and managers bound to it.
+/// @details Every TransactionProcessor and AccountManager starts bound to global(); giving a group of
+///          them their own context isolates their totals and flags from the rest of the process,
+///          as the replay engine does for each of its shards. All fields may be read and written
+///          from any thread.
+struct ProcessingContext {
+    std::atomic<int> totalTransactionsProcessed;
+    std::atomic<std::int64_t> totalVolumeProcessedCents;   // deposits only
+    std::atomic<int> totalAccountsCreated;
+    std::atomic<std::int64_t> systemTotalBalanceCents;     // initial balances of created accounts
+    std::atomic<bool> systemLocked;                        // transfers wait (PENDING) unless urgent
+    std::atomic<bool> complianceAuditMode;                 // high-risk accounts are frozen, not suspended
+
+    /// @brief Constructs a ProcessingContext instance with zero totals and both switches off.
+    ProcessingContext();
+
+    ProcessingContext(const ProcessingContext&) = delete;
+    ProcessingContext& operator=(const ProcessingContext&) = delete;
+
+    /// @brief Accesses the context of the process, used by default.
+    /// @return Reference to the process-wide context.
+    static ProcessingContext& global();
+};
+
+#endif // PROCESSING_CONTEXT_HPP
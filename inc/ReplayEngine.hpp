@@ -0,0 +1,74 @@
+#ifndef REPLAY_ENGINE_HPP
+#define REPLAY_ENGINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Money.hpp"
+#include "Transaction.hpp"
+#include "TransactionHistory.hpp"
+#include "WorkStealingPool.hpp"
+
+/// @brief Statuses and merged totals of one replay.
+struct ReplayResult {
+    std::vector<TransactionStatus> statuses;                // one per input record, in input order
+    std::array<std::size_t, 5> statusCounts;                // indexed by TransactionStatus
+    int totalTransactionsProcessed;
+    Money totalVolumeProcessed;
+};
+
+/// @brief Replays historical transactions, validating and screening them in parallel.
+/// @details The records are partitioned by a stable hash of the source account. Each partition
+///          runs TransactionProcessor::validateBatch and screenBatch over its records on its own
+///          processor, as tasks of a WorkStealingPool; that work depends on the record and its
+///          source account only. The daily limits are instance-wide, so a merge pass then runs
+///          executeBatch on one processor and one ProcessingContext for every admitted record in
+///          input order, with the clock set to the timestamp of the record, so the limits count and
+///          roll over exactly as they did in the recorded run. The result equals that of a single
+///          processor for any thread and partition count.
+class ReplayEngine {
+private:
+    WorkStealingPool pool;
+    std::size_t partitionCount;
+    bool systemLocked;
+
+public:
+    static const std::size_t DEFAULT_PARTITION_COUNT = 64;
+
+    /// @brief Constructs a ReplayEngine instance.
+    /// @param [in] threadCount The number of replay threads; 0 uses the hardware concurrency.
+    /// @param [in] partitionCount The number of source account partitions (at least 1).
+    explicit ReplayEngine(std::size_t threadCount = 0, std::size_t partitionCount = DEFAULT_PARTITION_COUNT);
+
+    /// @brief Sets the system lock every shard replays with.
+    /// @param [in] locked True to replay with the system locked.
+    void setSystemLocked(bool locked);
+
+    /// @brief Maps a source account to its partition.
+    /// @param [in] sourceAccount The NUL-terminated source account of a record.
+    /// @return The partition index, in [0, getPartitionCount()).
+    std::size_t partitionOf(const char* sourceAccount) const;
+
+    /// @brief Replays records.
+    /// @param [in] records The records, oldest first.
+    /// @return The statuses and merged totals.
+    ReplayResult replay(const std::vector<TransactionHistoryRecord>& records);
+
+    /// @brief Replays every record of a history segment file.
+    /// @param [in] path The segment written by TransactionHistory.
+    /// @param [out] result The statuses and merged totals.
+    /// @return True if the segment was read, false if it does not exist or is not a history segment.
+    bool replayFile(const std::string& path, ReplayResult& result);
+
+    /// @brief Retrieves the number of source account partitions.
+    /// @return The partition count.
+    std::size_t getPartitionCount() const;
+
+    /// @brief Retrieves the number of replay threads.
+    /// @return The thread count.
+    std::size_t getThreadCount() const;
+};
+
+#endif // REPLAY_ENGINE_HPP
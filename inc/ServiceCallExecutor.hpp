@@ -0,0 +1,65 @@
+#ifndef SERVICE_CALL_EXECUTOR_HPP
+#define SERVICE_CALL_EXECUTOR_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Fixed pool of worker threads that runs blocking external-service calls.
+/// @details Lets one caller thread keep many service round-trips in flight: submit returns a
+///          future immediately and the call runs on the next idle worker.
+class ServiceCallExecutor {
+private:
+    mutable std::mutex mutex;
+    std::condition_variable taskAvailable;
+    std::condition_variable idle;
+    std::deque<std::function<void()>> tasks;
+    std::vector<std::thread> workers;
+    std::size_t runningCount;
+    bool stopRequested;
+
+    /// @brief Runs queued tasks until the executor is destroyed.
+    void workerLoop();
+
+public:
+    /// @brief Constructs a ServiceCallExecutor instance and starts its workers.
+    /// @param [in] workerCount The number of worker threads (at least 1).
+    explicit ServiceCallExecutor(std::size_t workerCount = 4);
+
+    /// @brief Runs every queued task, then stops and joins the workers.
+    ~ServiceCallExecutor();
+
+    ServiceCallExecutor(const ServiceCallExecutor&) = delete;
+    ServiceCallExecutor& operator=(const ServiceCallExecutor&) = delete;
+
+    /// @brief Queues a task whose result nobody waits for.
+    /// @param [in] task The task to run on a worker.
+    void post(std::function<void()> task);
+
+    /// @brief Queues a call and returns a future for its result.
+    /// @param [in] call The callable to run on a worker.
+    /// @return Future receiving the result, or the exception thrown by the call.
+    template <typename Call>
+    auto submit(Call call) -> std::future<decltype(call())> {
+        using Result = decltype(call());
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::move(call));
+        std::future<Result> result = task->get_future();
+        post([task]() { (*task)(); });
+        return result;
+    }
+
+    /// @brief Blocks until the queue is empty and no task is running.
+    void drain();
+
+    /// @brief Retrieves the number of queued or running tasks.
+    /// @return The pending task count.
+    std::size_t getPendingCount() const;
+};
+
+#endif // SERVICE_CALL_EXECUTOR_HPP
@@ -0,0 +1,127 @@
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+/// @brief Bounded lock-free queue between exactly one producer thread and one consumer thread.
+/// @details A ring of a power-of-two number of slots indexed by two monotonic counters. Each side
+///          caches the last counter it read from the other side and only reloads it when the ring
+///          looks full or empty, so a steady stream costs one shared cache line per side. The blocking
+///          push and pop spin briefly and then yield, which gives the backpressure between stages.
+template <typename T>
+class SpscQueue {
+private:
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+    static constexpr int SPIN_COUNT = 64;
+
+    std::vector<T> slots;
+    std::size_t mask;
+
+    // Next position to pop; written by the consumer only
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head;
+    std::size_t cachedTail;
+
+    // Next position to push; written by the producer only
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail;
+    std::size_t cachedHead;
+
+    /// @brief Rounds a capacity up to the next power of two.
+    /// @param [in] capacity The requested capacity.
+    /// @return The slot count, at least 1.
+    static std::size_t roundUpCapacity(std::size_t capacity) {
+        std::size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+
+    /// @brief Backs off while the queue is full or empty.
+    /// @param [in,out] spins The number of attempts so far.
+    static void backOff(int& spins) {
+        if (++spins > SPIN_COUNT) {
+            std::this_thread::yield();
+        }
+    }
+
+public:
+    /// @brief Constructs an empty SpscQueue instance.
+    /// @param [in] capacity The minimum number of queued elements; rounded up to a power of two.
+    explicit SpscQueue(std::size_t capacity)
+        : slots(roundUpCapacity(capacity)), mask(slots.size() - 1), head(0), cachedTail(0), tail(0), cachedHead(0) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// @brief Appends an element if there is room; producer thread only.
+    /// @param [in] value The element to append.
+    /// @return True if the element was appended, false if the queue is full.
+    bool tryPush(const T& value) {
+        const std::size_t position = tail.load(std::memory_order_relaxed);
+        if (position - cachedHead == slots.size()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (position - cachedHead == slots.size()) {
+                return false;
+            }
+        }
+        slots[position & mask] = value;
+        tail.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Removes the oldest element if there is one; consumer thread only.
+    /// @param [out] value Receives the element.
+    /// @return True if an element was removed, false if the queue is empty.
+    bool tryPop(T& value) {
+        const std::size_t position = head.load(std::memory_order_relaxed);
+        if (position == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (position == cachedTail) {
+                return false;
+            }
+        }
+        value = slots[position & mask];
+        head.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Appends an element, waiting while the queue is full; producer thread only.
+    /// @param [in] value The element to append.
+    void push(const T& value) {
+        int spins = 0;
+        while (!tryPush(value)) {
+            backOff(spins);
+        }
+    }
+
+    /// @brief Removes the oldest element, waiting while the queue is empty; consumer thread only.
+    /// @return The element.
+    T pop() {
+        T value{};
+        int spins = 0;
+        while (!tryPop(value)) {
+            backOff(spins);
+        }
+        return value;
+    }
+
+    /// @brief Retrieves the number of queued elements; may be called from any thread.
+    /// @return The queue depth at some moment during the call.
+    std::size_t size() const {
+        // Head first: it never passes the tail read after it, so the difference cannot wrap
+        const std::size_t position = head.load(std::memory_order_acquire);
+        const std::size_t depth = tail.load(std::memory_order_acquire) - position;
+        return depth < slots.size() ? depth : slots.size();
+    }
+
+    /// @brief Retrieves the number of slots.
+    /// @return The capacity.
+    std::size_t capacity() const {
+        return slots.size();
+    }
+};
+
+#endif // SPSC_QUEUE_HPP
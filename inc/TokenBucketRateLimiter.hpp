@@ -0,0 +1,136 @@
+#ifndef TOKEN_BUCKET_RATE_LIMITER_HPP
+#define TOKEN_BUCKET_RATE_LIMITER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "ExternalServices.hpp"
+
+/// @brief In-process RateLimitingService with one token bucket per account and a lock-free hot path.
+/// @details Each bucket is a single atomic word holding its theoretical arrival time (the generic cell
+///          rate algorithm): the bucket is refilled lazily from the elapsed time whenever it is read, so
+///          no timer thread is needed, and taking a token is one compare-and-swap. Buckets live in a
+///          fixed open-addressing table keyed by a 64-bit hash of the account number; an account probes
+///          at most MAX_PROBES slots. Buckets that have been full for idleTimeout are idle and evicted,
+///          either by evictIdle or when an insertion finds no free slot in its probe window.
+///          Two accounts whose hashes collide share a bucket, which only makes both stricter.
+class TokenBucketRateLimiter : public RateLimitingService {
+public:
+    using Clock = std::function<std::chrono::steady_clock::time_point()>;
+
+    static const std::size_t MAX_PROBES = 16;
+
+private:
+    struct alignas(16) Slot {
+        std::atomic<std::uint64_t> key;
+        // Theoretical arrival time in nanoseconds since origin; the bucket is full when it is not after now
+        std::atomic<std::int64_t> arrivalTime;
+    };
+
+    static const std::uint64_t EMPTY_KEY = 0;
+    static const std::int64_t EVICTING = -1;
+
+    std::size_t slotMask;
+    std::unique_ptr<Slot[]> slots;
+    int capacity;
+    std::int64_t emissionInterval;
+    std::int64_t burstTolerance;
+    std::int64_t idleTimeout;
+    Clock clock;
+    std::chrono::steady_clock::time_point origin;
+    std::atomic<std::size_t> rejectedInsertCount;
+
+    /// @brief Hashes an account number; never returns EMPTY_KEY.
+    /// @param [in] accountNumber The account number.
+    /// @return The 64-bit key of the account.
+    static std::uint64_t hashKey(std::string_view accountNumber);
+
+    /// @brief Reads the clock.
+    /// @return Nanoseconds since origin.
+    std::int64_t now() const;
+
+    /// @brief Finds the bucket of an account.
+    /// @param [in] key The account key.
+    /// @return Pointer to the slot, or nullptr if the account has no bucket.
+    Slot* find(std::uint64_t key) const;
+
+    /// @brief Finds the bucket of an account, claiming a free or idle slot if it has none.
+    /// @param [in] key The account key.
+    /// @param [in] currentTime The current time in nanoseconds since origin.
+    /// @return Pointer to the slot, or nullptr if the probe window has no free or idle slot.
+    Slot* findOrInsert(std::uint64_t key, std::int64_t currentTime);
+
+    /// @brief Frees a slot whose bucket has been idle for idleTimeout.
+    /// @param [in,out] slot The slot.
+    /// @param [in] currentTime The current time in nanoseconds since origin.
+    /// @return True if the slot was freed, false if it is in use or not idle.
+    bool evictIfIdle(Slot& slot, std::int64_t currentTime);
+
+    /// @brief Takes one token from the bucket of an account.
+    /// @param [in] slot The slot of the account.
+    /// @param [in] key The account key.
+    /// @param [in] currentTime The current time in nanoseconds since origin.
+    /// @param [out] moved True if the slot was evicted or reassigned meanwhile; the caller looks again.
+    /// @return True if a token was taken, false if the bucket is empty.
+    bool consume(Slot& slot, std::uint64_t key, std::int64_t currentTime, bool& moved);
+
+    /// @brief Computes the tokens left in a bucket.
+    /// @param [in] arrivalTime The theoretical arrival time of the bucket.
+    /// @param [in] currentTime The current time in nanoseconds since origin.
+    /// @return The number of tokens that can be taken now.
+    int tokensAt(std::int64_t arrivalTime, std::int64_t currentTime) const;
+
+public:
+    /// @brief Constructs a TokenBucketRateLimiter instance.
+    /// @param [in] capacity The tokens a full bucket holds, i.e. the largest burst (at least 1).
+    /// @param [in] refillPerSecond The tokens added per second (greater than 0).
+    /// @param [in] maxAccounts The accounts the table is sized for; it gets twice as many slots, rounded up to a power of two.
+    /// @param [in] idleTimeout How long a bucket must have been full before it may be evicted.
+    /// @param [in] clock Time source; defaults to std::chrono::steady_clock::now.
+    TokenBucketRateLimiter(int capacity, double refillPerSecond, std::size_t maxAccounts,
+                           std::chrono::steady_clock::duration idleTimeout = std::chrono::seconds(60),
+                           Clock clock = Clock());
+
+    TokenBucketRateLimiter(const TokenBucketRateLimiter&) = delete;
+    TokenBucketRateLimiter& operator=(const TokenBucketRateLimiter&) = delete;
+
+    /// @brief Checks if an account has a token left, without taking it.
+    /// @param [in] accountNumber The account number to check.
+    /// @return True if the account is within rate limits, false if exceeded.
+    bool checkRateLimit(const std::string& accountNumber) override;
+
+    /// @brief Takes one token from the bucket of an account.
+    /// @details Fails closed: false as well if the table has no room for a new account.
+    /// @param [in] accountNumber The account number to increment.
+    /// @return True if a token was taken, false if the bucket is empty.
+    bool incrementRateCounter(const std::string& accountNumber) override;
+
+    /// @brief Refills the bucket of an account.
+    /// @param [in] accountNumber The account number to reset.
+    void resetRateLimits(const std::string& accountNumber) override;
+
+    /// @brief Retrieves the tokens left in the bucket of an account.
+    /// @param [in] accountNumber The account number.
+    /// @return The number of remaining requests allowed.
+    int getRemainingRequests(const std::string& accountNumber) override;
+
+    /// @brief Evicts every bucket that has been idle for idleTimeout.
+    /// @return The number of buckets evicted.
+    std::size_t evictIdle();
+
+    /// @brief Retrieves the number of accounts with a bucket; scans the table.
+    /// @return The account count.
+    std::size_t size() const;
+
+    /// @brief Retrieves how many new accounts were refused for lack of a free slot.
+    /// @return The refused insertion count.
+    std::size_t getRejectedInsertCount() const;
+};
+
+#endif // TOKEN_BUCKET_RATE_LIMITER_HPP
@@ -0,0 +1,35 @@
+#ifndef TRANSACTION_HPP
+#define TRANSACTION_HPP
+
+#include <ctime>
+
+#include "AccountSymbolTable.hpp"
+#include "Money.hpp"
+
+enum class TransactionStatus {
+    PENDING,
+    APPROVED,
+    REJECTED,
+    CANCELLED,
+    COMPLETED
+};
+
+enum class TransactionType {
+    DEPOSIT,
+    WITHDRAWAL,
+    TRANSFER,
+    REFUND
+};
+
+/// @brief Accepted transaction; account numbers are handles into the AccountSymbolTable of its processor.
+struct Transaction {
+    int id;
+    TransactionType type;
+    Money amount;
+    AccountSymbol sourceAccount;
+    AccountSymbol destAccount;
+    time_t timestamp;
+    TransactionStatus status;
+};
+
+#endif // TRANSACTION_HPP
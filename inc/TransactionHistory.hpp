@@ -0,0 +1,133 @@
+#ifndef TRANSACTION_HISTORY_HPP
+#define TRANSACTION_HISTORY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "MappedFile.hpp"
+#include "Money.hpp"
+#include "Transaction.hpp"
+
+/// @brief Fixed-width history record, shared by the in-memory ring and the segment file.
+/// @details Account numbers of up to MAX_ACCOUNT_LENGTH characters, enough for any IBAN, are stored
+///          in full and NUL-terminated; transactions with longer ones are refused, never truncated.
+struct TransactionHistoryRecord {
+    static const std::size_t ACCOUNT_FIELD_SIZE = 40;
+    static const std::size_t MAX_ACCOUNT_LENGTH = ACCOUNT_FIELD_SIZE - 1;
+
+    std::int32_t id;
+    std::int32_t type;
+    std::int32_t status;
+    std::int32_t reserved;
+    Money amount;
+    std::int64_t timestamp;
+    char sourceAccount[ACCOUNT_FIELD_SIZE];
+    char destAccount[ACCOUNT_FIELD_SIZE];
+};
+
+/// @brief Bounded transaction history: a fixed ring of recent records that spills to a mapped segment.
+/// @details Records evicted from the ring are appended to the segment file when one is open and
+///          dropped otherwise, so memory use is fixed at ring capacity times sizeof(TransactionHistoryRecord).
+///          Not thread-safe; the owning TransactionProcessor serializes access.
+class TransactionHistory {
+private:
+    std::pmr::vector<TransactionHistoryRecord> ring;
+    std::size_t ringHead;
+    std::size_t ringCount;
+    std::size_t droppedCount;
+    std::size_t refusedCount;
+
+    MappedFile segment;
+    std::size_t segmentCapacity;
+
+    /// @brief Retrieves the number of records in the open segment.
+    /// @return The record count stored in the segment header, or 0 if no segment is open.
+    std::size_t segmentRecordCount() const;
+
+    /// @brief Appends a record evicted from the ring to the segment, or drops it.
+    /// @param [in] record The evicted record.
+    void spill(const TransactionHistoryRecord& record);
+
+public:
+    static const std::size_t DEFAULT_RING_CAPACITY = 4096;
+
+    /// @brief Constructs a TransactionHistory instance.
+    /// @param [in] ringCapacity The number of recent records kept in memory (at least 1).
+    /// @param [in] resource The memory resource of the ring; must outlive the history.
+    explicit TransactionHistory(std::size_t ringCapacity = DEFAULT_RING_CAPACITY,
+                                std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+    /// @brief Destructs the TransactionHistory instance and closes the segment.
+    ~TransactionHistory();
+
+    TransactionHistory(const TransactionHistory&) = delete;
+    TransactionHistory& operator=(const TransactionHistory&) = delete;
+
+    /// @brief Opens or creates the append-only segment that receives records evicted from the ring.
+    /// @details Records already in an existing segment become the oldest part of the history.
+    /// @param [in] path The segment file path.
+    /// @return True if the segment was opened, false if it cannot be mapped or has a foreign layout.
+    bool openSegment(const std::string& path);
+
+    /// @brief Flushes and closes the segment; later evictions are dropped.
+    void closeSegment();
+
+    /// @brief Writes the mapped segment pages back to the file.
+    /// @return True if the segment was flushed, false if none is open or the flush failed.
+    bool sync();
+
+    /// @brief Appends a transaction to the history.
+    /// @param [in] transaction The transaction to append.
+    /// @param [in] symbols The table the account handles of the transaction refer to.
+    /// @return True if the transaction was appended, false if an account is too long for its record.
+    bool append(const Transaction& transaction, const AccountSymbolTable& symbols);
+
+    /// @brief Visits, oldest first, every record with since <= timestamp < until.
+    /// @details Records are passed by reference straight from the segment mapping or the ring;
+    ///          the references are valid only during the callback and the history must not be
+    ///          appended to from inside it.
+    /// @param [in] since The first timestamp to include.
+    /// @param [in] until The first timestamp to exclude.
+    /// @param [in] callback The visitor invoked for each matching record.
+    void forEachTransaction(time_t since, time_t until,
+                            const std::function<void(const TransactionHistoryRecord&)>& callback) const;
+
+    /// @brief Converts a transaction into its fixed-width record.
+    /// @param [in] transaction The transaction to convert.
+    /// @param [in] symbols The table the account handles of the transaction refer to.
+    /// @param [out] record The record receiving the fields; unspecified on failure.
+    /// @return True if both accounts fit, false if one is longer than MAX_ACCOUNT_LENGTH.
+    static bool toRecord(const Transaction& transaction, const AccountSymbolTable& symbols,
+                         TransactionHistoryRecord& record);
+
+    /// @brief Retrieves the capacity of the in-memory ring.
+    /// @return The maximum number of records held in memory.
+    std::size_t getRingCapacity() const;
+
+    /// @brief Retrieves the number of records currently held in memory.
+    /// @return The in-memory record count.
+    std::size_t getInMemoryCount() const;
+
+    /// @brief Retrieves the number of records stored in the segment.
+    /// @return The spilled record count.
+    std::size_t getSpilledCount() const;
+
+    /// @brief Retrieves the number of records evicted while no segment was open.
+    /// @return The dropped record count.
+    std::size_t getDroppedCount() const;
+
+    /// @brief Retrieves the number of transactions append refused for an account that does not fit.
+    /// @return The refused transaction count.
+    std::size_t getRefusedCount() const;
+
+    /// @brief Retrieves the number of retained records.
+    /// @return The in-memory plus spilled record count.
+    std::size_t size() const;
+};
+
+#endif // TRANSACTION_HISTORY_HPP
@@ -0,0 +1,111 @@
+#ifndef TRANSACTION_LOG_SINK_HPP
+#define TRANSACTION_LOG_SINK_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+#include "TransactionProcessor.hpp"
+
+enum class TransactionLogFormat {
+    TEXT,
+    BINARY
+};
+
+/// @brief Fixed-width record written by the binary log format.
+struct TransactionLogRecord {
+    std::int32_t id;
+    std::int32_t type;
+    std::int32_t status;
+    std::int32_t reserved;
+    Money amount;
+    std::int64_t timestamp;
+};
+
+class TransactionLogSink {
+public:
+    /// @brief Destructor for TransactionLogSink.
+    virtual ~TransactionLogSink() = default;
+
+    /// @brief Writes one accepted transaction to the log.
+    /// @param [in] transaction The transaction to log.
+    virtual void write(const Transaction& transaction) = 0;
+
+    /// @brief Blocks until every transaction written so far has reached the output.
+    virtual void flush() = 0;
+};
+
+class ConsoleTransactionLogSink : public TransactionLogSink {
+public:
+    /// @brief Writes the transaction line to std::cout and flushes it.
+    /// @param [in] transaction The transaction to log.
+    void write(const Transaction& transaction) override;
+
+    /// @brief Flushes std::cout.
+    void flush() override;
+
+    /// @brief Retrieves the process-wide console sink used by default.
+    /// @return Reference to the shared console sink.
+    static ConsoleTransactionLogSink& instance();
+};
+
+class AsyncTransactionLogSink : public TransactionLogSink {
+private:
+    struct Slot {
+        std::atomic<std::size_t> sequence;
+        TransactionLogRecord record;
+    };
+
+    std::vector<Slot> slots;
+    std::size_t mask;
+    alignas(64) std::atomic<std::size_t> writeIndex;
+    alignas(64) std::atomic<std::size_t> readIndex;
+    alignas(64) std::atomic<std::size_t> droppedCount;
+    std::atomic<std::size_t> flushTarget;      // highest write index a flush call waits for
+    std::atomic<std::size_t> flushedThrough;   // read index at the last stream flush
+    std::atomic<bool> stopRequested;
+
+    std::ostream& output;
+    TransactionLogFormat format;
+    std::thread drainThread;
+
+    /// @brief Background loop that drains the ring into the output stream.
+    void drainLoop();
+
+    /// @brief Writes all records currently available in the ring.
+    /// @return The number of records written.
+    std::size_t drainAvailable();
+
+    /// @brief Formats one record to the output stream.
+    /// @param [in] record The record to write.
+    void writeRecord(const TransactionLogRecord& record);
+
+public:
+    /// @brief Constructs the sink and starts its drain thread.
+    /// @param [in] output The stream the drain thread writes to; must outlive the sink.
+    /// @param [in] format Text lines or fixed-width binary records.
+    /// @param [in] capacity Ring capacity in records, rounded up to a power of two.
+    AsyncTransactionLogSink(std::ostream& output, TransactionLogFormat format, std::size_t capacity = 8192);
+
+    /// @brief Drains the remaining records and stops the drain thread.
+    ~AsyncTransactionLogSink();
+
+    AsyncTransactionLogSink(const AsyncTransactionLogSink&) = delete;
+    AsyncTransactionLogSink& operator=(const AsyncTransactionLogSink&) = delete;
+
+    /// @brief Enqueues the transaction without blocking; drops it if the ring is full.
+    /// @param [in] transaction The transaction to log.
+    void write(const Transaction& transaction) override;
+
+    /// @brief Waits until the drain thread has written every enqueued record, then flushes the stream.
+    void flush() override;
+
+    /// @brief Retrieves the number of records dropped because the ring was full.
+    /// @return The dropped record count.
+    std::size_t getDroppedCount() const;
+};
+
+#endif // TRANSACTION_LOG_SINK_HPP
@@ -0,0 +1,122 @@
+#ifndef TRANSACTION_POLICY_HPP
+#define TRANSACTION_POLICY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "Account.hpp"
+#include "Money.hpp"
+#include "Transaction.hpp"
+
+/// @brief How an accepted transaction of a type is decided against the daily limits.
+enum class TransactionHandling : std::uint8_t {
+    TRANSFER,       // decided by the transfer rules
+    DAILY_LIMITED,  // rejected once the daily transaction count is reached
+    UNLIMITED,      // completed regardless of the daily limits
+    UNSUPPORTED     // cancelled
+};
+
+/// @brief Limits and handling of one transaction type.
+struct TransactionRule {
+    Money minAmount;
+    Money maxAmount;
+    TransactionHandling handling;
+    bool addsDailyVolume;
+};
+
+/// @brief Number of rows of a rule table: one per TransactionType and a last one for unknown types.
+inline constexpr std::size_t TRANSACTION_RULE_COUNT = 5;
+inline constexpr std::size_t ACCOUNT_TYPE_COUNT = 4;
+
+/// @brief Product whose rules apply when the caller does not name the account type.
+inline constexpr AccountType DEFAULT_TRANSACTION_PRODUCT = AccountType::CHECKING;
+
+using TransactionRuleTable = std::array<TransactionRule, TRANSACTION_RULE_COUNT>;
+
+/// @brief Maps a transaction type to its row; values outside the enum share the last row.
+/// @param [in] type The transaction type.
+/// @return The row index.
+constexpr std::size_t transactionRuleIndex(TransactionType type) {
+    const std::uint32_t index = static_cast<std::uint32_t>(type);
+    return index < TRANSACTION_RULE_COUNT - 1 ? index : TRANSACTION_RULE_COUNT - 1;
+}
+
+/// @brief Maps an account type to its rule table; values outside the enum use DEFAULT_TRANSACTION_PRODUCT.
+/// @param [in] product The account type.
+/// @return The table index.
+constexpr std::size_t accountRuleIndex(AccountType product) {
+    const std::uint32_t index = static_cast<std::uint32_t>(product);
+    return index < ACCOUNT_TYPE_COUNT ? index : static_cast<std::size_t>(DEFAULT_TRANSACTION_PRODUCT);
+}
+
+/// @brief The rules every product starts from.
+/// @return The default rule table.
+constexpr TransactionRuleTable defaultTransactionRules() {
+    return TransactionRuleTable{{
+        {Money::fromCents(1), Money(1000000.0), TransactionHandling::DAILY_LIMITED, true},  // DEPOSIT
+        {Money::fromCents(1), Money(50000.0), TransactionHandling::DAILY_LIMITED, true},    // WITHDRAWAL
+        {Money::fromCents(1), Money(1000000.0), TransactionHandling::TRANSFER, false},      // TRANSFER
+        {Money::fromCents(1), Money(10000.0), TransactionHandling::UNLIMITED, false},       // REFUND
+        {Money::fromCents(1), Money(1000000.0), TransactionHandling::UNSUPPORTED, false}    // unknown types
+    }};
+}
+
+/// @brief Returns a rule table with the amount cap of one transaction type replaced.
+/// @param [in] rules The table to start from.
+/// @param [in] type The transaction type to change.
+/// @param [in] maxAmount The new cap.
+/// @return The changed table.
+constexpr TransactionRuleTable withMaxAmount(TransactionRuleTable rules, TransactionType type, Money maxAmount) {
+    rules[transactionRuleIndex(type)].maxAmount = maxAmount;
+    return rules;
+}
+
+/// @brief Compile-time transaction rules of a product.
+/// @details The primary template holds the default rules. A deployment configures a product by
+///          specializing the template for its AccountType, usually starting from
+///          defaultTransactionRules() and adjusting it with withMaxAmount.
+template <AccountType Product>
+struct TransactionPolicy {
+    static constexpr TransactionRuleTable rules = defaultTransactionRules();
+};
+
+/// @brief Business accounts move larger amounts.
+template <>
+struct TransactionPolicy<AccountType::BUSINESS> {
+    static constexpr TransactionRuleTable rules =
+        withMaxAmount(withMaxAmount(defaultTransactionRules(), TransactionType::WITHDRAWAL, Money(250000.0)),
+                      TransactionType::REFUND, Money(50000.0));
+};
+
+/// @brief Investment accounts withdraw more at a time but take smaller refunds.
+template <>
+struct TransactionPolicy<AccountType::INVESTMENT> {
+    static constexpr TransactionRuleTable rules =
+        withMaxAmount(withMaxAmount(defaultTransactionRules(), TransactionType::WITHDRAWAL, Money(100000.0)),
+                      TransactionType::REFUND, Money(5000.0));
+};
+
+/// @brief Rule tables of every product, indexed by accountRuleIndex.
+inline constexpr std::array<TransactionRuleTable, ACCOUNT_TYPE_COUNT> TRANSACTION_POLICIES = {{
+    TransactionPolicy<AccountType::CHECKING>::rules,
+    TransactionPolicy<AccountType::SAVINGS>::rules,
+    TransactionPolicy<AccountType::INVESTMENT>::rules,
+    TransactionPolicy<AccountType::BUSINESS>::rules
+}};
+
+/// @brief Looks up the rule of a transaction type for a product.
+/// @param [in] product The account type of the source account.
+/// @param [in] type The transaction type.
+/// @return The rule.
+constexpr const TransactionRule& transactionRule(AccountType product, TransactionType type) {
+    return TRANSACTION_POLICIES[accountRuleIndex(product)][transactionRuleIndex(type)];
+}
+
+static_assert(transactionRule(AccountType::CHECKING, TransactionType::WITHDRAWAL).maxAmount == Money(50000.0),
+              "the default product keeps the documented withdrawal cap");
+static_assert(static_cast<int>(AccountType::CHECKING) == 0 && static_cast<int>(AccountType::BUSINESS) == 3 &&
+              static_cast<int>(TransactionType::DEPOSIT) == 0 && static_cast<int>(TransactionType::REFUND) == 3,
+              "the policy tables are indexed by the enum values");
+
+#endif // TRANSACTION_POLICY_HPP
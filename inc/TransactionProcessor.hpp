@@ -1,57 +1,313 @@
 #ifndef TRANSACTION_PROCESSOR_HPP
 #define TRANSACTION_PROCESSOR_HPP
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <ctime>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "AccountSymbolTable.hpp"
+#include "DailyUsageCounter.hpp"
+#include "MemoryResources.hpp"
+#include "Money.hpp"
+#include "Transaction.hpp"
+#include "TransactionPolicy.hpp"
+#include "TransactionHistory.hpp"
 
 class ComplianceCheckService;
+class BlacklistIndex;
+class WindowedRateLimiter;
 class AuditLoggingService;
+class BatchedAuditWriter;
+class RateLimitingService;
+class TransactionLogSink;
+struct ProcessingContext;
+struct AuditEntry;
+struct AuditRecord;
+enum class AuditDurability;
+enum class ComplianceLevel;
 
-enum class TransactionStatus {
-    PENDING,
-    APPROVED,
-    REJECTED,
-    CANCELLED,
-    COMPLETED
-};
-
-enum class TransactionType {
-    DEPOSIT,
-    WITHDRAWAL,
-    TRANSFER,
-    REFUND
+enum class ValidationKernel {
+    SCALAR,
+    AVX2,
+    NEON
 };
 
-struct Transaction {
-    int id;
+struct TransactionRequest {
     TransactionType type;
     double amount;
     std::string sourceAccount;
     std::string destAccount;
-    time_t timestamp;
-    TransactionStatus status;
+    // Selects the TransactionPolicy rules; requests that leave it out get the default product
+    AccountType sourceAccountType = DEFAULT_TRANSACTION_PRODUCT;
+};
+
+/// @brief Per-request working state of a batch passing through the TransactionProcessor stages.
+/// @details Sized by validateBatch; a state reused for further batches keeps its storage.
+struct TransactionBatchState {
+    std::pmr::vector<Money> amounts;
+    std::pmr::vector<bool> admitted;                // still eligible for execution
+    std::vector<TransactionStatus> statuses;        // REJECTED unless executed
+
+    /// @brief Constructs a TransactionBatchState instance.
+    /// @param [in] resource The memory resource of the amounts and admission flags.
+    explicit TransactionBatchState(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 };
 
 class TransactionProcessor {
+public:
+    using Clock = std::function<std::time_t()>;
+    using TransferApplier = std::function<bool()>;
+
 private:
-    static int transactionCounter;
-    static const double MIN_TRANSACTION_AMOUNT;
-    static const double MAX_TRANSACTION_AMOUNT;
+    static std::atomic<int> transactionCounter;
     static const int MAX_DAILY_TRANSACTIONS;
+    static constexpr Money MAX_DAILY_VOLUME = Money(5000000.0);
+    
+    // Largest amount a HIGH_RISK source may move, and the transfer size that triggers the urgent checks
+    static constexpr Money HIGH_RISK_LIMIT = Money(50000.0);
+    static constexpr Money URGENT_TRANSFER_THRESHOLD = Money(100000.0);
     
-    std::vector<Transaction> transactionHistory;
-    double dailyVolume;
-    int dailyTransactionCount;
+    // Decisions against the daily limits and their updates are published together by CAS;
+    // the day is taken from the transaction timestamp and rolls over by itself
+    DailyUsageWindow dailyUsage;
+    Clock clock;
+    
+    // Counts the allocations of the history and the audit scratch; declared before them so it outlives them
+    CountingMemoryResource processorMemory;
+    
+    // Serializes the account symbols, the history and the log sink, which are not thread-safe
+    mutable std::mutex historyMutex;
+    AccountSymbolTable accountSymbols;
+    TransactionHistory transactionHistory;
     
     // External service pointers (stub/mock for testing)
     ComplianceCheckService* complianceService;
     AuditLoggingService* auditService;
+    
+    // Buffered audit path; takes the place of auditService when set
+    BatchedAuditWriter* auditWriter;
+    
+    // Local blacklist consulted before the compliance service; optional
+    const BlacklistIndex* blacklistIndex;
+    
+    // Per-account windowed limits checked before the instance limits; optional
+    WindowedRateLimiter* accountLimiter;
+    
+    // Request-rate pre-check consulted before the compliance service; optional
+    RateLimitingService* rateLimitingService;
+    
+    // Destination of the per-transaction log line
+    TransactionLogSink* logSink;
+    
+    // Totals and the system lock; the process-wide context unless another one is injected
+    ProcessingContext* context;
+    
+    // Reused audit scratch, so accepted transactions do not allocate in steady state; guarded by auditMutex
+    std::mutex auditMutex;
+    std::pmr::vector<char> auditText;
+    std::vector<AuditEntry> auditEntries;
+    
+    /// @brief Rejects a transaction the compliance level does not allow.
+    /// @param [in] complianceLevel The compliance level of the source account.
+    /// @param [in] amount The transaction amount.
+    /// @return True if the transaction must be rejected, false otherwise.
+    bool isBlockedByCompliance(ComplianceLevel complianceLevel, Money amount) const;
+    
+    /// @brief Decides a fund transfer against a snapshot of the daily usage.
+    /// @param [in] amount The amount to transfer.
+    /// @param [in] source The source account number.
+    /// @param [in] destination The destination account number.
+    /// @param [in] isUrgent Whether the transfer is marked as urgent.
+    /// @param [in] usage The daily usage the decision is based on.
+    /// @return The status of the transfer.
+    TransactionStatus decideTransfer(Money amount, 
+                                     const std::string& source,
+                                     const std::string& destination,
+                                     bool isUrgent,
+                                     const DailyUsage& usage) const;
+    
+    /// @brief Decides a validated transaction against a snapshot of the daily usage.
+    /// @param [in] rule The policy rule of the transaction type and product.
+    /// @param [in] amount The transaction amount.
+    /// @param [in] sourceAccount The source account number.
+    /// @param [in] destAccount The destination account number.
+    /// @param [in] isUrgent Whether a transfer is marked as urgent.
+    /// @param [in] usage The daily usage the decision is based on.
+    /// @param [out] addsVolume Whether an accepted transaction counts towards the daily volume.
+    /// @return The status of the transaction.
+    TransactionStatus decideTransaction(const TransactionRule& rule, 
+                                        Money amount, 
+                                        const std::string& sourceAccount,
+                                        const std::string& destAccount,
+                                        bool isUrgent,
+                                        const DailyUsage& usage,
+                                        bool& addsVolume) const;
+    
+    /// @brief Applies the per-type processing rules to a validated transaction.
+    /// @details Accepted transactions are counted against the limits of the day of their timestamp
+    ///          in the same atomic step that decided them, so concurrent callers never exceed a limit.
+    /// @param [in] type The type of transaction to process.
+    /// @param [in] rule The policy rule of the transaction type and product.
+    /// @param [in] amount The transaction amount.
+    /// @param [in] sourceAccount The source account number.
+    /// @param [in] destAccount The destination account number.
+    /// @param [in] timestamp The transaction timestamp.
+    /// @param [in] isUrgent Whether a transfer is marked as urgent.
+    /// @param [in] apply Applies a COMPLETED transaction once it is counted; nullptr for none.
+    ///             If it returns false the counted usage is given back and the result is REJECTED.
+    /// @return The status of the processed transaction.
+    TransactionStatus dispatchTransaction(TransactionType type, 
+                                         const TransactionRule& rule,
+                                         Money amount, 
+                                         const std::string& sourceAccount,
+                                         const std::string& destAccount,
+                                         std::time_t timestamp,
+                                         bool isUrgent = false,
+                                         const TransferApplier* apply = nullptr);
+    
+    /// @brief Gives back usage counted by dispatchTransaction for a transaction that did not happen.
+    /// @details Nothing is given back once the counter was cleared for a new day.
+    /// @param [in,out] counter The counter the usage was counted against.
+    /// @param [in] counted The transaction count and volume to give back.
+    static void releaseDailyUsage(DailyUsageCounter& counter, const DailyUsage& counted);
+    
+    /// @brief Validates, screens, dispatches and records one transaction.
+    /// @param [in] type The type of transaction to process.
+    /// @param [in] amount The transaction amount.
+    /// @param [in] sourceAccount The source account number.
+    /// @param [in] destAccount The destination account number.
+    /// @param [in] sourceAccountType The product of the source account.
+    /// @param [in] isUrgent Whether a transfer is marked as urgent.
+    /// @param [in] apply Passed on to dispatchTransaction; nullptr for none.
+    /// @return The status of the processed transaction, not yet counted as an outcome.
+    TransactionStatus runTransaction(TransactionType type, 
+                                     double amount, 
+                                     const std::string& sourceAccount,
+                                     const std::string& destAccount,
+                                     AccountType sourceAccountType,
+                                     bool isUrgent,
+                                     const TransferApplier* apply);
+    
+    /// @brief Interns the accounts of a transaction, appends it to the history and writes it to the log sink.
+    /// @details An account too long for the history record leaves the transaction out of the history,
+    ///          counted by TransactionHistory::getRefusedCount; the log sink still receives it.
+    /// @param [in,out] transaction The transaction to record; receives the account symbols.
+    /// @param [in] sourceAccount The source account number.
+    /// @param [in] destAccount The destination account number.
+    void recordTransaction(Transaction& transaction, std::string_view sourceAccount, std::string_view destAccount);
+    
+    /// @brief Appends a transaction whose accounts are already interned to the history and the log sink.
+    /// @param [in] transaction The transaction to record.
+    /// @return The source account number of the transaction.
+    std::string_view recordTransaction(const Transaction& transaction);
+    
+    /// @brief Hands a recorded transaction to the audit writer or the audit service, if either is set.
+    /// @param [in] transaction The transaction to audit.
+    /// @param [in] sourceAccount The source account number of the transaction.
+    void auditTransaction(const Transaction& transaction, std::string_view sourceAccount);
+    
+    /// @brief Makes room in the audit scratch buffers for the given number of entries; the caller holds auditMutex.
+    /// @param [in] entryCount The number of audit entries about to be built.
+    void reserveAuditText(std::size_t entryCount);
+    
+    /// @brief Builds the audit entry reported for a transaction; the caller holds auditMutex.
+    /// @details The entry views text formatted into the given slot of the audit scratch buffer, and
+    ///          the source account as given, so the account must outlive the audit call.
+    /// @param [in] transaction The transaction to audit.
+    /// @param [in] sourceAccount The source account number of the transaction.
+    /// @param [in] textSlot The scratch slot receiving the formatted fields.
+    /// @return The audit entry for the transaction.
+    AuditEntry makeAuditEntry(const Transaction& transaction, std::string_view sourceAccount, std::size_t textSlot);
+    
+    /// @brief Builds the unformatted audit record of a transaction.
+    /// @param [in] transaction The transaction to audit.
+    /// @return The audit record, stamped with the current wall-clock time.
+    static AuditRecord makeAuditRecord(const Transaction& transaction);
+    
+    /// @brief Decides how soon the audit of a transaction must be written.
+    /// @details Transactions above URGENT_TRANSFER_THRESHOLD are reportable and are written through.
+    /// @param [in] transaction The transaction to audit.
+    /// @return The durability of its audit record.
+    static AuditDurability auditDurability(const Transaction& transaction);
+    
+    /// @brief Portable batch validation kernel; also handles the tails of the SIMD kernels.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] begin The first position to validate.
+    /// @param [in] end One past the last position to validate.
+    /// @param [in,out] validMask Bitmask receiving the results of positions [begin, end).
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchScalar(const double* amounts, const TransactionType* types, 
+                                    std::size_t begin, std::size_t end, std::uint64_t* validMask,
+                                    const TransactionRuleTable& rules);
+    
+    /// @brief AVX2 batch validation kernel, four amounts per step.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [in,out] validMask Zeroed bitmask receiving the results.
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchAvx2(const double* amounts, const TransactionType* types, 
+                                  std::size_t count, std::uint64_t* validMask,
+                                  const TransactionRuleTable& rules);
+    
+    /// @brief NEON batch validation kernel, two amounts per step.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [in,out] validMask Zeroed bitmask receiving the results.
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchNeon(const double* amounts, const TransactionType* types, 
+                                  std::size_t count, std::uint64_t* validMask,
+                                  const TransactionRuleTable& rules);
+    
+    /// @brief Portable batch validation kernel for amounts already in cents.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] begin The first position to validate.
+    /// @param [in] end One past the last position to validate.
+    /// @param [in,out] validMask Bitmask receiving the results of positions [begin, end).
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchScalar(const Money* amounts, const TransactionType* types, 
+                                    std::size_t begin, std::size_t end, std::uint64_t* validMask,
+                                    const TransactionRuleTable& rules);
+    
+    /// @brief AVX2 batch validation kernel for amounts in cents, four 64-bit integer compares per step.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [in,out] validMask Zeroed bitmask receiving the results.
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchAvx2(const Money* amounts, const TransactionType* types, 
+                                  std::size_t count, std::uint64_t* validMask,
+                                  const TransactionRuleTable& rules);
+    
+    /// @brief NEON batch validation kernel for amounts in cents, two 64-bit integer compares per step.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [in,out] validMask Zeroed bitmask receiving the results.
+    /// @param [in] rules The rule table of the product.
+    static void validateBatchNeon(const Money* amounts, const TransactionType* types, 
+                                  std::size_t count, std::uint64_t* validMask,
+                                  const TransactionRuleTable& rules);
 
 public:
     /// @brief Constructs a TransactionProcessor instance.
     /// @details Initializes the transaction processor with empty history and zero counters.
-    TransactionProcessor();
+    ///          Processing and the daily counters are thread-safe; the setters are not and must be
+    ///          called before traffic starts. The history and the audit scratch are allocated from
+    ///          upstream; a short-lived processor can be given a std::pmr::monotonic_buffer_resource
+    ///          so that all of its storage is released at once when the arena is destroyed.
+    /// @param [in] upstream The memory resource of the processor storage; nullptr means the default resource.
+    ///                      Must outlive the processor.
+    explicit TransactionProcessor(std::pmr::memory_resource* upstream = nullptr);
     
     /// @brief Destructs the TransactionProcessor instance.
     ~TransactionProcessor();
@@ -64,24 +320,183 @@ public:
     /// @param [in] service Pointer to the AuditLoggingService implementation.
     void setAuditService(AuditLoggingService* service);
     
+    /// @brief Sets the buffered writer that audits transactions in place of the audit service.
+    /// @details Processing then only submits unformatted records; large transactions are written
+    ///          before the call returns, the rest by the writer's flush thread. nullptr (the default)
+    ///          audits through the audit service.
+    /// @param [in] writer Pointer to the BatchedAuditWriter; must outlive its use by the processor.
+    void setAuditWriter(BatchedAuditWriter* writer);
+    
+    /// @brief Sets the local blacklist that rejects source accounts without a compliance call.
+    /// @details nullptr (the default) disables the local blacklist check.
+    /// @param [in] index Pointer to the BlacklistIndex; must outlive its use by the processor.
+    void setBlacklistIndex(const BlacklistIndex* index);
+    
+    /// @brief Sets the per-account limiter every transaction is counted against before the daily limits.
+    /// @details nullptr (the default) disables the per-account limits. A transaction the daily limits
+    ///          reject is given back to the limiter.
+    /// @param [in] limiter Pointer to the WindowedRateLimiter; must outlive its use by the processor.
+    void setAccountLimiter(WindowedRateLimiter* limiter);
+    
+    /// @brief Sets the rate limiter that every valid transaction must get past before the compliance check.
+    /// @details Each check takes one request from the source account via incrementRateCounter;
+    ///          nullptr (the default) disables the rate limit pre-check.
+    /// @param [in] service Pointer to the RateLimitingService implementation.
+    void setRateLimitingService(RateLimitingService* service);
+    
+    /// @brief Sets the time source that stamps transactions and selects their day.
+    /// @details An empty clock (the default) uses time(nullptr).
+    /// @param [in] clock The time source.
+    void setClock(Clock clock);
+    
+    /// @brief Sets the sink that receives the log line of every accepted transaction.
+    /// @details Defaults to the console sink; nullptr disables the transaction log output.
+    /// @param [in] sink Pointer to the TransactionLogSink implementation.
+    void setTransactionLogSink(TransactionLogSink* sink);
+    
+    /// @brief Binds the processor to the context holding the processed totals and the system lock.
+    /// @details nullptr restores ProcessingContext::global(), the default.
+    /// @param [in] processingContext Pointer to the context; must outlive the processor.
+    void setProcessingContext(ProcessingContext* processingContext);
+    
+    /// @brief Accesses the context the processor is bound to.
+    /// @return Reference to the processing context.
+    ProcessingContext& getProcessingContext() const;
+    
     /// @brief Processes a transaction with the specified parameters.
     /// @param [in] type The type of transaction to process.
     /// @param [in] amount The transaction amount.
     /// @param [in] sourceAccount The source account number.
     /// @param [in] destAccount The destination account number.
+    /// @param [in] sourceAccountType The product of the source account, which selects its TransactionPolicy rules.
     /// @return The status of the processed transaction.
     TransactionStatus processTransaction(TransactionType type, 
                                         double amount, 
                                         const std::string& sourceAccount,
-                                        const std::string& destAccount);
+                                        const std::string& destAccount,
+                                        AccountType sourceAccountType = DEFAULT_TRANSACTION_PRODUCT);
+    
+    /// @brief Processes a batch of transactions.
+    /// @details Runs validateBatch, screenBatch and executeBatch on scratch from ThreadScratchPool.
+    ///          The statuses equal those of calling processTransaction on each request in order.
+    /// @param [in] requests Pointer to the first request of the batch.
+    /// @param [in] count The number of requests in the batch.
+    /// @return The status of every request, in input order.
+    std::vector<TransactionStatus> processBatch(const TransactionRequest* requests, std::size_t count);
+    
+    /// @brief Processes a batch of transactions.
+    /// @param [in] requests The requests of the batch.
+    /// @return The status of every request, in input order.
+    std::vector<TransactionStatus> processBatch(const std::vector<TransactionRequest>& requests);
+    
+    /// @brief First batch stage: checks every amount and the policy bounds of its type and product.
+    /// @details Touches no processor state, so it may run concurrently with the other stages of other batches.
+    /// @param [in] requests Pointer to the first request of the batch.
+    /// @param [in] count The number of requests in the batch.
+    /// @param [out] state Receives the amounts; a request is admitted exactly when it is valid.
+    void validateBatch(const TransactionRequest* requests, std::size_t count, TransactionBatchState& state) const;
+    
+    /// @brief Second batch stage: drops admitted requests the blacklist, rate limit or compliance level refuse.
+    /// @details The rate limiting service is called in input order and the compliance service once per
+    ///          distinct source account.
+    /// @param [in] requests Pointer to the first request of the batch.
+    /// @param [in] count The number of requests in the batch.
+    /// @param [in,out] state The state left by validateBatch.
+    void screenBatch(const TransactionRequest* requests, std::size_t count, TransactionBatchState& state);
+    
+    /// @brief Last batch stage: executes the admitted requests in input order and audits them in one call.
+    /// @details Batches must be executed in the order they are meant to count against the daily limits.
+    /// @param [in] requests Pointer to the first request of the batch.
+    /// @param [in] count The number of requests in the batch.
+    /// @param [in,out] state The state left by screenBatch; receives the statuses.
+    void executeBatch(const TransactionRequest* requests, std::size_t count, TransactionBatchState& state);
     
     /// @brief Validates a transaction amount and type.
+    /// @details The amount is compared as given against the bounds of the rule, so amounts between two
+    ///          cents are judged by their exact value and NaN, which is outside no bound, passes. Accepted
+    ///          amounts are processed rounded to the nearest cent (NaN as zero), which stays within the
+    ///          bounds because they are whole cents.
+    /// @param [in] amount The transaction amount to validate.
+    /// @param [in] type The transaction type to validate.
+    /// @param [in] product The product whose TransactionPolicy bounds apply.
+    /// @return True if the transaction is valid, false otherwise.
+    bool validateTransaction(double amount, TransactionType type, AccountType product = DEFAULT_TRANSACTION_PRODUCT) const;
+    
+    /// @brief Validates a transaction amount in cents and type.
     /// @param [in] amount The transaction amount to validate.
     /// @param [in] type The transaction type to validate.
+    /// @param [in] product The product whose TransactionPolicy bounds apply.
     /// @return True if the transaction is valid, false otherwise.
-    bool validateTransaction(double amount, TransactionType type);
+    bool validateTransaction(Money amount, TransactionType type, AccountType product = DEFAULT_TRANSACTION_PRODUCT) const;
+    
+    /// @brief Validates a batch of transactions of the default product with the fastest kernel the CPU supports.
+    /// @details Bit i of the mask (word i / 64, bit i % 64) is set exactly when
+    ///          validateTransaction(amounts[i], types[i]) returns true.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [out] validMask Bitmask of (count + 63) / 64 words receiving the results.
+    static void validateTransactionBatch(const double* amounts, const TransactionType* types, 
+                                         std::size_t count, std::uint64_t* validMask);
+    
+    /// @brief Validates a batch of transactions of one product with a specific kernel.
+    /// @details Falls back to the scalar kernel if the requested one is not available.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [out] validMask Bitmask of (count + 63) / 64 words receiving the results.
+    /// @param [in] kernel The kernel to use.
+    /// @param [in] product The product whose TransactionPolicy bounds apply.
+    static void validateTransactionBatch(const double* amounts, const TransactionType* types, 
+                                         std::size_t count, std::uint64_t* validMask,
+                                         ValidationKernel kernel, AccountType product = DEFAULT_TRANSACTION_PRODUCT);
+    
+    /// @brief Validates a batch of amounts in cents of the default product with the fastest kernel the CPU supports.
+    /// @details Bit i of the mask is set exactly when validateTransaction(amounts[i], types[i]) returns true.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [out] validMask Bitmask of (count + 63) / 64 words receiving the results.
+    static void validateTransactionBatch(const Money* amounts, const TransactionType* types, 
+                                         std::size_t count, std::uint64_t* validMask);
+    
+    /// @brief Validates a batch of amounts in cents of one product with a specific kernel.
+    /// @details Falls back to the scalar kernel if the requested one is not available.
+    /// @param [in] amounts The transaction amounts.
+    /// @param [in] types The transaction types, parallel to amounts.
+    /// @param [in] count The number of transactions.
+    /// @param [out] validMask Bitmask of (count + 63) / 64 words receiving the results.
+    /// @param [in] kernel The kernel to use.
+    /// @param [in] product The product whose TransactionPolicy bounds apply.
+    static void validateTransactionBatch(const Money* amounts, const TransactionType* types, 
+                                         std::size_t count, std::uint64_t* validMask,
+                                         ValidationKernel kernel, AccountType product = DEFAULT_TRANSACTION_PRODUCT);
+    
+    /// @brief Retrieves the kernel selected at runtime for batch validation.
+    /// @return The best kernel supported by the running CPU.
+    static ValidationKernel getValidationKernel();
+    
+    /// @brief Processes a fund transfer and applies it to the accounts if it completes.
+    /// @details Takes the path of processTransaction with TransactionType::TRANSFER: validation,
+    ///          screening, and the reserve-then-commit step against the daily limits. A COMPLETED
+    ///          transfer is applied while its usage is reserved; if apply refuses, the usage is given
+    ///          back, nothing is recorded and the transfer is REJECTED.
+    /// @param [in] amount The amount to transfer.
+    /// @param [in] source The source account number.
+    /// @param [in] destination The destination account number.
+    /// @param [in] isUrgent Whether the transfer is marked as urgent.
+    /// @param [in] apply Moves the balances; returns false if an account refuses.
+    /// @param [in] sourceAccountType The product of the source account, which selects its TransactionPolicy rules.
+    /// @return The status of the transfer.
+    TransactionStatus processTransfer(double amount, 
+                                      const std::string& source,
+                                      const std::string& destination,
+                                      bool isUrgent,
+                                      const TransferApplier& apply,
+                                      AccountType sourceAccountType = DEFAULT_TRANSACTION_PRODUCT);
     
     /// @brief Executes a fund transfer between accounts.
+    /// @details Decides against the current daily usage without counting the transfer.
     /// @param [in] amount The amount to transfer.
     /// @param [in] source The source account number.
     /// @param [in] destination The destination account number.
@@ -93,20 +508,58 @@ public:
                                      bool isUrgent);
     
     /// @brief Logs a transaction to the history.
-    /// @param [in] transaction The transaction to log.
+    /// @param [in] transaction The transaction to log; its account handles come from internAccount.
     void logTransaction(const Transaction& transaction);
+
     
     /// @brief Resets daily transaction limits and counters.
+    /// @details Not needed at the day boundary, where the counters roll over by themselves. Safe while
+    ///          transactions are processed; each one is counted on one side of the reset.
     /// @return True if the reset was successful, false otherwise.
     bool resetDailyLimits();
     
-    /// @brief Retrieves the current daily transaction volume.
+    /// @brief Retrieves the transaction volume of the current day.
     /// @return The total daily transaction volume.
     double getDailyVolume() const;
     
-    /// @brief Retrieves the number of transactions completed today.
+    /// @brief Retrieves the number of transactions counted on the current day.
     /// @return The count of daily transactions.
     int getTransactionCount() const;
+    
+    /// @brief Retrieves the number of transactions a day may count before limited types are rejected.
+    /// @return The daily transaction limit.
+    static int getMaxDailyTransactions();
+    
+    /// @brief Accesses the bounded history of accepted transactions.
+    /// @details Use it to open a spill segment or to scan with forEachTransaction while no
+    ///          transactions are processed.
+    /// @return Reference to the transaction history.
+    TransactionHistory& getTransactionHistory();
+    
+    /// @brief Accesses the bounded history of accepted transactions.
+    /// @return Reference to the transaction history.
+    const TransactionHistory& getTransactionHistory() const;
+    
+    /// @brief Retrieves the handle of an account number in the symbol table of this processor.
+    /// @details The table lives as long as the processor; Transaction handles of one processor mean
+    ///          nothing to another.
+    /// @param [in] accountNumber The account number.
+    /// @return The symbol of the account number, interned on first use.
+    AccountSymbol internAccount(std::string_view accountNumber);
+    
+    /// @brief Retrieves the account number behind a handle of this processor.
+    /// @param [in] symbol The symbol.
+    /// @return View of the account number, valid as long as the processor; empty for unknown symbols.
+    std::string_view getAccountName(AccountSymbol symbol) const;
+    
+    /// @brief Retrieves the number of account numbers interned by this processor, including the empty one.
+    /// @return The symbol count.
+    std::size_t getAccountSymbolCount() const;
+    
+    /// @brief Retrieves the allocations made for the history and the audit scratch.
+    /// @details Per-batch scratch comes from ThreadScratchPool and is reported there.
+    /// @return The allocation statistics of the processor storage.
+    AllocationStats getAllocationStats() const;
 };
 
 #endif // TRANSACTION_PROCESSOR_HPP
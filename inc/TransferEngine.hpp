@@ -0,0 +1,61 @@
+#ifndef TRANSFER_ENGINE_HPP
+#define TRANSFER_ENGINE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+
+#include "Transaction.hpp"
+
+class ConcurrentAccountManager;
+class TransactionProcessor;
+
+/// @brief Counters of one TransferEngine.
+struct TransferEngineStats {
+    std::size_t completedCount;    // transfers whose balances were moved
+    std::size_t declinedCount;     // transfers the processor did not complete; no balance changed
+    std::size_t refusedCount;      // completed decisions refused by an account, e.g. for insufficient funds
+};
+
+/// @brief Executes transfers end to end: the processor decides, then the balances move.
+/// @details TransactionProcessor::processTransfer validates and screens a transfer and counts it
+///          against the daily limits like processTransaction. Only a COMPLETED decision is applied,
+///          through ConcurrentAccountManager::transferBalance, which debits the source and credits the
+///          destination under the locks of their two shards; a refusal gives the counted usage back. There is no global lock, and the
+///          managed total stays unchanged. Transfers between accounts on disjoint shards run in
+///          parallel. Transfers touching one hot account are serialized on its shard. The engine is
+///          thread-safe.
+class TransferEngine {
+private:
+    ConcurrentAccountManager& accounts;
+    TransactionProcessor& processor;
+
+    std::atomic<std::size_t> completedCount;
+    std::atomic<std::size_t> declinedCount;
+    std::atomic<std::size_t> refusedCount;
+
+public:
+    /// @brief Constructs a TransferEngine instance.
+    /// @param [in] accounts The accounts to move balances between; must outlive the engine.
+    /// @param [in] processor The processor deciding every transfer; must outlive the engine.
+    TransferEngine(ConcurrentAccountManager& accounts, TransactionProcessor& processor);
+
+    TransferEngine(const TransferEngine&) = delete;
+    TransferEngine& operator=(const TransferEngine&) = delete;
+
+    /// @brief Decides a transfer and, if it completes, moves the amount between the two accounts.
+    /// @param [in] amount The amount to transfer; must be a whole number of cents.
+    /// @param [in] source The account to debit; must be ACTIVE and hold at least the amount.
+    /// @param [in] destination The account to credit; must be ACTIVE.
+    /// @param [in] isUrgent Whether the transfer is marked as urgent.
+    /// @return COMPLETED if the balances moved, REJECTED if an account refused a completed
+    ///         decision, otherwise the status decided by the processor.
+    TransactionStatus transfer(double amount, const std::string& source, const std::string& destination,
+                               bool isUrgent = false);
+
+    /// @brief Retrieves the counters of this engine.
+    /// @return The counters at some moment during the call.
+    TransferEngineStats getStats() const;
+};
+
+#endif // TRANSFER_ENGINE_HPP
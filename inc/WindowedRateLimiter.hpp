@@ -0,0 +1,136 @@
+#ifndef WINDOWED_RATE_LIMITER_HPP
+#define WINDOWED_RATE_LIMITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ExternalServices.hpp"
+
+/// @brief In-process RateLimitingService with a sliding window of transactions and volume per account.
+/// @details The window is split into up to MAX_BUCKETS time buckets kept in a fixed ring per account,
+///          so memory per active account is constant and updates are O(1) amortized: moving the window
+///          forward clears each expired bucket once. Accounts whose whole window has expired are idle
+///          and swept out when a shard grows, so idle accounts do not accumulate. The accounts are
+///          spread over mutex-guarded shards so concurrent callers rarely contend.
+class WindowedRateLimiter : public RateLimitingService {
+public:
+    using Clock = std::function<std::time_t()>;
+
+    static const std::size_t MAX_BUCKETS = 24;
+
+private:
+    struct Window {
+        std::int64_t newestBucket;
+        int transactionCount;
+        std::int64_t volumeCents;
+        std::uint32_t bucketCounts[MAX_BUCKETS];
+        std::int64_t bucketVolumes[MAX_BUCKETS];
+    };
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, Window> windows;
+        std::size_t sweepThreshold;
+    };
+
+    static const std::size_t SHARD_COUNT = 16;
+    static const std::size_t MIN_SWEEP_THRESHOLD = 64;
+
+    std::int64_t bucketSeconds;
+    std::size_t bucketCount;
+    int maxTransactions;
+    std::int64_t maxVolumeCents;
+    Clock clock;
+    std::unique_ptr<Shard[]> shards;
+
+    /// @brief Selects the shard that owns an account number.
+    /// @param [in] accountNumber The account number.
+    /// @return Reference to the owning shard.
+    Shard& shardFor(const std::string& accountNumber) const;
+
+    /// @brief Converts a timestamp to its bucket number.
+    /// @param [in] timestamp The timestamp.
+    /// @return Buckets since the epoch.
+    std::int64_t bucketOf(std::time_t timestamp) const;
+
+    /// @brief Moves a window forward so that its newest bucket is the given one.
+    /// @details Buckets that fall out of the window are cleared and subtracted from the totals;
+    ///          older buckets than the newest one leave the window unchanged.
+    /// @param [in,out] window The window to move.
+    /// @param [in] bucket The bucket number to move to.
+    void advance(Window& window, std::int64_t bucket) const;
+
+    /// @brief Checks whether every bucket of a window has expired.
+    /// @param [in] window The window.
+    /// @param [in] bucket The current bucket number.
+    /// @return True if the window holds nothing that still counts, false otherwise.
+    bool isIdle(const Window& window, std::int64_t bucket) const;
+
+    /// @brief Erases the idle windows of a shard; the caller holds the shard mutex.
+    /// @param [in,out] shard The shard to sweep.
+    /// @param [in] bucket The current bucket number.
+    /// @return The number of windows erased.
+    std::size_t sweep(Shard& shard, std::int64_t bucket) const;
+
+public:
+    /// @brief Constructs a WindowedRateLimiter instance.
+    /// @param [in] windowSeconds The length of the sliding window in seconds (at least 1).
+    /// @param [in] bucketCount The number of buckets the window is split into, in [1, MAX_BUCKETS].
+    /// @param [in] maxTransactions The transactions allowed per account and window.
+    /// @param [in] maxVolume The volume allowed per account and window.
+    /// @param [in] clock Time source of the RateLimitingService calls; defaults to time(nullptr).
+    WindowedRateLimiter(std::int64_t windowSeconds, std::size_t bucketCount,
+                        int maxTransactions, double maxVolume, Clock clock = Clock());
+
+    WindowedRateLimiter(const WindowedRateLimiter&) = delete;
+    WindowedRateLimiter& operator=(const WindowedRateLimiter&) = delete;
+
+    /// @brief Counts a transaction against the window of an account if both limits allow it.
+    /// @details A timestamp older than the newest bucket of the account is counted in that bucket.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] timestamp The transaction timestamp.
+    /// @param [in] amountCents The transaction amount in cents.
+    /// @return True if the transaction was counted, false if it would exceed a limit.
+    bool tryAcquire(const std::string& accountNumber, std::time_t timestamp, std::int64_t amountCents);
+
+    /// @brief Gives back a transaction counted by tryAcquire that was not executed after all.
+    /// @param [in] accountNumber The account number.
+    /// @param [in] timestamp The timestamp passed to tryAcquire.
+    /// @param [in] amountCents The amount passed to tryAcquire.
+    void release(const std::string& accountNumber, std::time_t timestamp, std::int64_t amountCents);
+
+    /// @brief Erases every account whose whole window has expired.
+    /// @return The number of accounts erased.
+    std::size_t evictIdle();
+
+    /// @brief Retrieves the number of accounts currently tracked.
+    /// @return The account count, idle accounts not yet swept included.
+    std::size_t size() const;
+
+    /// @brief Checks if an account has a transaction left in its window.
+    /// @param [in] accountNumber The account number to check.
+    /// @return True if the account is within rate limits, false if exceeded.
+    bool checkRateLimit(const std::string& accountNumber) override;
+
+    /// @brief Counts a zero-amount transaction at the current time.
+    /// @param [in] accountNumber The account number to increment.
+    /// @return True if the transaction was counted, false if the limit is reached.
+    bool incrementRateCounter(const std::string& accountNumber) override;
+
+    /// @brief Forgets the window of an account.
+    /// @param [in] accountNumber The account number to reset.
+    void resetRateLimits(const std::string& accountNumber) override;
+
+    /// @brief Retrieves the transactions left in the window of an account.
+    /// @param [in] accountNumber The account number.
+    /// @return The number of remaining transactions allowed.
+    int getRemainingRequests(const std::string& accountNumber) override;
+};
+
+#endif // WINDOWED_RATE_LIMITER_HPP
@@ -0,0 +1,88 @@
+#ifndef WORK_STEALING_POOL_HPP
+#define WORK_STEALING_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief Fixed pool of worker threads that runs indexed tasks with work stealing.
+/// @details run deals the task indices round-robin onto one queue per worker. A worker takes
+///          from the front of its own queue and, once it is empty, steals from the back of the
+///          others, so a few long tasks do not leave the other workers idle. The tasks of one
+///          run must not depend on which worker executes them or in which order.
+class WorkStealingPool {
+private:
+    using Task = std::function<void(std::size_t)>;
+
+    /// @brief One queued call: the task of its run and the index it is called with.
+    struct QueuedTask {
+        const Task* task;
+        std::size_t index;
+    };
+
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<QueuedTask> tasks;
+    };
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues;
+    std::vector<std::thread> workers;
+
+    // Serializes run; the state below is guarded by mutex
+    std::mutex runMutex;
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable runFinished;
+    std::size_t generation;
+    std::size_t remainingCount;
+    bool stopRequested;
+    // First exception thrown by a call of the current run
+    std::exception_ptr runException;
+
+    std::atomic<std::size_t> stolenCount;
+
+    /// @brief Waits for runs and executes their tasks until the pool is destroyed.
+    /// @param [in] worker The index of the own queue.
+    void workerLoop(std::size_t worker);
+
+    /// @brief Takes the next task for a worker, from its own queue or stolen from another one.
+    /// @param [in] worker The index of the own queue.
+    /// @param [out] next The task taken.
+    /// @return True if a task was taken, false if every queue is empty.
+    bool takeTask(std::size_t worker, QueuedTask& next);
+
+public:
+    /// @brief Constructs a WorkStealingPool instance and starts its workers.
+    /// @param [in] threadCount The number of worker threads; 0 uses the hardware concurrency.
+    explicit WorkStealingPool(std::size_t threadCount = 0);
+
+    /// @brief Stops and joins the workers.
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    /// @brief Calls task once for every index in [0, taskCount) and waits until all calls returned.
+    /// @details A call that throws does not stop the remaining calls; once all of them returned,
+    ///          the first exception thrown is rethrown. Concurrent runs are executed one after the other.
+    /// @param [in] taskCount The number of calls.
+    /// @param [in] task The task, called with the index; must be safe to call concurrently.
+    void run(std::size_t taskCount, const Task& task);
+
+    /// @brief Retrieves the number of worker threads.
+    /// @return The thread count.
+    std::size_t getThreadCount() const;
+
+    /// @brief Retrieves how many calls were executed by a worker other than the one they were dealt to.
+    /// @return The stolen call count since construction.
+    std::size_t getStolenCount() const;
+};
+
+#endif // WORK_STEALING_POOL_HPP
@@ -0,0 +1,559 @@
+#include "LoadGenerator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#include "../bench/BenchSupport.hpp"
+#include "../inc/ConcurrentAccountManager.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+#include "../inc/TransferEngine.hpp"
+
+namespace {
+
+const char* const OPERATION_NAMES[LOAD_OPERATION_COUNT] = {"deposit", "withdrawal", "transfer", "refund"};
+const char* const STATUS_NAMES[TRANSACTION_STATUS_COUNT] = {"pending", "approved", "rejected", "cancelled",
+                                                            "completed"};
+const TransactionType TRANSACTION_TYPES[LOAD_OPERATION_COUNT] = {
+    TransactionType::DEPOSIT, TransactionType::WITHDRAWAL, TransactionType::TRANSFER, TransactionType::REFUND};
+
+const double INITIAL_BALANCE = 1000.0;
+const int MIN_AMOUNT_CENTS = 100;
+const int MAX_AMOUNT_CENTS = 50000;
+const std::time_t SIMULATED_EPOCH = 1700000000;
+const std::time_t SECONDS_PER_DAY = 86400;
+
+// Answers MFA checks like a flaky identity provider; the draws use one engine per thread
+class FaultInjectingAuthenticationService : public StubAuthenticationService {
+private:
+    std::chrono::nanoseconds latency;
+    double timeoutRate;
+    double networkErrorRate;
+    std::uint64_t seed;
+
+public:
+    FaultInjectingAuthenticationService(std::chrono::nanoseconds latency, double timeoutRate,
+                                        double networkErrorRate, std::uint64_t seed)
+        : StubAuthenticationService(latency), latency(latency), timeoutRate(timeoutRate),
+          networkErrorRate(networkErrorRate), seed(seed) {}
+
+    VerificationResult verifyMultiFactorToken(const std::string&, const std::string&) override {
+        thread_local std::mt19937_64 engine(seed ^ std::hash<std::thread::id>()(std::this_thread::get_id()));
+        simulateLatency(latency);
+        const double draw = std::uniform_real_distribution<double>(0.0, 1.0)(engine);
+        if (draw < timeoutRate) {
+            return VerificationResult::TIMEOUT;
+        }
+        if (draw < timeoutRate + networkErrorRate) {
+            return VerificationResult::NETWORK_ERROR;
+        }
+        return VerificationResult::SUCCESS;
+    }
+};
+
+// Collected by one worker and merged after the run, so the workers share nothing while measuring
+struct WorkerResult {
+    std::uint64_t timeoutCount = 0;
+    std::uint64_t networkErrorCount = 0;
+    LatencyHistogramSnapshot latency{};
+    std::array<LoadOperationReport, LOAD_OPERATION_COUNT> operations{};
+};
+
+void recordLatency(LatencyHistogramSnapshot& histogram, std::uint64_t nanoseconds) {
+    histogram.buckets[latencyBucketIndex(nanoseconds)]++;
+    histogram.count++;
+    histogram.totalNanoseconds += nanoseconds;
+    histogram.maxNanoseconds = std::max(histogram.maxNanoseconds, nanoseconds);
+}
+
+void mergeLatency(LatencyHistogramSnapshot& into, const LatencyHistogramSnapshot& from) {
+    for (std::size_t bucket = 0; bucket < LATENCY_BUCKET_COUNT; ++bucket) {
+        into.buckets[bucket] += from.buckets[bucket];
+    }
+    into.count += from.count;
+    into.totalNanoseconds += from.totalNanoseconds;
+    into.maxNanoseconds = std::max(into.maxNanoseconds, from.maxNanoseconds);
+}
+
+long readPeakRssKilobytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if defined(__APPLE__)
+    return static_cast<long>(usage.ru_maxrss / 1024);
+#else
+    return static_cast<long>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+bool parseNumber(const std::string& text, double& value) {
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && end == text.c_str() + text.size() && std::isfinite(value);
+}
+
+bool parseMix(const std::string& text, std::array<unsigned, LOAD_OPERATION_COUNT>& mix) {
+    std::array<unsigned, LOAD_OPERATION_COUNT> parsed{};
+    std::stringstream entries(text);
+    std::string entry;
+    while (std::getline(entries, entry, ',')) {
+        const std::size_t colon = entry.find(':');
+        if (colon == std::string::npos) {
+            return false;
+        }
+        const std::string name = entry.substr(0, colon);
+        const auto found = std::find(std::begin(OPERATION_NAMES), std::end(OPERATION_NAMES), name);
+        double weight = 0.0;
+        if (found == std::end(OPERATION_NAMES) || !parseNumber(entry.substr(colon + 1), weight) || weight < 0.0 ||
+            weight != std::floor(weight) || weight > 1000000.0) {
+            return false;
+        }
+        parsed[static_cast<std::size_t>(found - std::begin(OPERATION_NAMES))] = static_cast<unsigned>(weight);
+    }
+    if (std::all_of(parsed.begin(), parsed.end(), [](unsigned weight) { return weight == 0; })) {
+        return false;
+    }
+    mix = parsed;
+    return true;
+}
+
+// Finds "key": <number> at its first occurrence; the reports put the summary keys first
+bool findJsonNumber(const std::string& json, const std::string& key, double& value) {
+    const std::size_t at = json.find("\"" + key + "\"");
+    if (at == std::string::npos) {
+        return false;
+    }
+    const std::size_t colon = json.find(':', at);
+    if (colon == std::string::npos) {
+        return false;
+    }
+    const char* begin = json.c_str() + colon + 1;
+    char* end = nullptr;
+    value = std::strtod(begin, &end);
+    return end != begin;
+}
+
+void writeLatencyJson(std::ostream& out, const LatencyHistogramSnapshot& latency) {
+    out << "{\"p50_ns\": " << latency.valueAtPercentile(50.0)
+        << ", \"p99_ns\": " << latency.valueAtPercentile(99.0)
+        << ", \"p999_ns\": " << latency.valueAtPercentile(99.9)
+        << ", \"max_ns\": " << latency.maxNanoseconds
+        << ", \"mean_ns\": " << static_cast<std::uint64_t>(latency.meanNanoseconds()) << "}";
+}
+
+void writeJsonString(std::ostream& out, const std::string& text) {
+    out << '"';
+    for (const char c : text) {
+        if (c == '"' || c == '\\') {
+            out << '\\';
+        }
+        out << c;
+    }
+    out << '"';
+}
+
+} // namespace
+
+LoadGenConfig::LoadGenConfig()
+    : durationSeconds(10.0), threadCount(4), accountCount(10000), mix{40, 30, 25, 5}, zipfExponent(1.0),
+      serviceLatencyMicros(0), timeoutRate(0.0), networkErrorRate(0.0), operationsPerSimulatedDay(900), singleDay(false),
+      seed(1),
+      maxThroughputDrop(0.10), maxLatencyGrowth(0.25), maxRssGrowth(0.25) {
+}
+
+ZipfSampler::ZipfSampler(std::size_t count, double exponent) : cumulative(count) {
+    double total = 0.0;
+    for (std::size_t rank = 0; rank < count; ++rank) {
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), exponent);
+        cumulative[rank] = total;
+    }
+    for (double& bound : cumulative) {
+        bound /= total;
+    }
+}
+
+std::size_t ZipfSampler::sample(std::mt19937_64& engine) const {
+    const double draw = std::uniform_real_distribution<double>(0.0, 1.0)(engine);
+    const auto found = std::upper_bound(cumulative.begin(), cumulative.end(), draw);
+    return std::min(static_cast<std::size_t>(found - cumulative.begin()), cumulative.size() - 1);
+}
+
+double LoadReport::throughput() const {
+    return elapsedSeconds > 0.0 ? static_cast<double>(operationCount) / elapsedSeconds : 0.0;
+}
+
+bool parseLoadGenArguments(int argc, const char* const* argv, LoadGenConfig& config, std::string& error) {
+    config = LoadGenConfig();
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const std::size_t equals = argument.find('=');
+        if (argument.compare(0, 2, "--") != 0 || equals == std::string::npos) {
+            error = "expected --name=value, got " + argument;
+            return false;
+        }
+        const std::string name = argument.substr(2, equals - 2);
+        const std::string text = argument.substr(equals + 1);
+        double value = 0.0;
+        const bool numeric = parseNumber(text, value);
+        bool valid = true;
+
+        if (name == "duration") {
+            valid = numeric && value > 0.0;
+            config.durationSeconds = value;
+        } else if (name == "threads") {
+            valid = numeric && value >= 1.0 && value <= 256.0 && value == std::floor(value);
+            config.threadCount = static_cast<int>(value);
+        } else if (name == "accounts") {
+            valid = numeric && value >= 2.0 && value <= 10000000.0 && value == std::floor(value);
+            config.accountCount = static_cast<int>(value);
+        } else if (name == "mix") {
+            valid = parseMix(text, config.mix);
+        } else if (name == "zipf") {
+            valid = numeric && value >= 0.0 && value <= 10.0;
+            config.zipfExponent = value;
+        } else if (name == "service-latency-us") {
+            valid = numeric && value >= 0.0 && value <= 1000000.0 && value == std::floor(value);
+            config.serviceLatencyMicros = static_cast<unsigned>(value);
+        } else if (name == "timeout-rate") {
+            valid = numeric && value >= 0.0 && value <= 1.0;
+            config.timeoutRate = value;
+        } else if (name == "network-error-rate") {
+            valid = numeric && value >= 0.0 && value <= 1.0;
+            config.networkErrorRate = value;
+        } else if (name == "ops-per-day") {
+            valid = numeric && value >= 1.0 && value <= 1000000000.0 && value == std::floor(value);
+            config.operationsPerSimulatedDay = static_cast<int>(value);
+        } else if (name == "single-day") {
+            valid = numeric && (value == 0.0 || value == 1.0);
+            config.singleDay = value == 1.0;
+        } else if (name == "seed") {
+            valid = numeric && value >= 0.0 && value == std::floor(value);
+            config.seed = static_cast<std::uint64_t>(value);
+        } else if (name == "output") {
+            config.outputPath = text;
+        } else if (name == "baseline") {
+            valid = !text.empty();
+            config.baselinePath = text;
+        } else if (name == "max-throughput-drop") {
+            valid = numeric && value >= 0.0 && value <= 1.0;
+            config.maxThroughputDrop = value;
+        } else if (name == "max-latency-growth") {
+            valid = numeric && value >= 0.0;
+            config.maxLatencyGrowth = value;
+        } else if (name == "max-rss-growth") {
+            valid = numeric && value >= 0.0;
+            config.maxRssGrowth = value;
+        } else {
+            error = "unknown argument --" + name;
+            return false;
+        }
+
+        if (!valid) {
+            error = "invalid value for --" + name + ": " + text;
+            return false;
+        }
+    }
+    if (config.timeoutRate + config.networkErrorRate > 1.0) {
+        error = "--timeout-rate and --network-error-rate add up to more than 1";
+        return false;
+    }
+    return true;
+}
+
+void printLoadGenUsage(std::ostream& out) {
+    const LoadGenConfig defaults;
+    out << "Usage: run_loadgen [--name=value ...]\n"
+        << "  --duration=<s>               run time (" << defaults.durationSeconds << ")\n"
+        << "  --threads=<n>                worker threads (" << defaults.threadCount << ")\n"
+        << "  --accounts=<n>               active accounts (" << defaults.accountCount << ")\n"
+        << "  --mix=<op:w,...>             weights of deposit, withdrawal, transfer, refund (40,30,25,5)\n"
+        << "  --zipf=<s>                   skew of the account choice, 0 is uniform (" << defaults.zipfExponent
+        << ")\n"
+        << "  --service-latency-us=<us>    latency of every external service call ("
+        << defaults.serviceLatencyMicros << ")\n"
+        << "  --timeout-rate=<f>           share of MFA checks answering TIMEOUT (" << defaults.timeoutRate << ")\n"
+        << "  --network-error-rate=<f>     share of MFA checks answering NETWORK_ERROR ("
+        << defaults.networkErrorRate << ")\n"
+        << "  --ops-per-day=<n>            operations per simulated day, under the daily limits ("
+        << defaults.operationsPerSimulatedDay << ")\n"
+        << "  --single-day=<0|1>           stay on one simulated day and check the daily transaction cap ("
+        << (defaults.singleDay ? 1 : 0) << ")\n"
+        << "  --seed=<n>                   random seed (" << defaults.seed << ")\n"
+        << "  --output=<path>              JSON report file (stdout)\n"
+        << "  --baseline=<path>            report of an earlier run to gate against (none)\n"
+        << "  --max-throughput-drop=<f>    tolerated throughput drop (" << defaults.maxThroughputDrop << ")\n"
+        << "  --max-latency-growth=<f>     tolerated p99 and p99.9 growth (" << defaults.maxLatencyGrowth << ")\n"
+        << "  --max-rss-growth=<f>         tolerated peak RSS growth (" << defaults.maxRssGrowth << ")\n";
+}
+
+LoadReport runLoadGenerator(const LoadGenConfig& config) {
+    const std::chrono::nanoseconds serviceLatency = std::chrono::microseconds(config.serviceLatencyMicros);
+    StubComplianceCheckService complianceService(serviceLatency);
+    StubAuditLoggingService auditService(serviceLatency);
+    StubRateLimitingService rateLimitingService(serviceLatency);
+    FaultInjectingAuthenticationService authenticationService(serviceLatency, config.timeoutRate,
+                                                              config.networkErrorRate, config.seed);
+
+    // The clock moves one simulated day every operationsPerSimulatedDay calls, so a long soak is
+    // measured against the daily limits of the processor instead of being refused by them; a
+    // single-day run keeps the clock still, so the limits saturate and can be checked
+    std::atomic<std::uint64_t> clockCalls{0};
+    const std::uint64_t operationsPerDay = static_cast<std::uint64_t>(config.operationsPerSimulatedDay);
+    const bool singleDay = config.singleDay;
+
+    ProcessingContext context;
+    ConcurrentAccountManager accounts;
+    TransactionProcessor processor;
+    accounts.setProcessingContext(&context);
+    processor.setProcessingContext(&context);
+    processor.setComplianceService(&complianceService);
+    processor.setAuditService(&auditService);
+    processor.setRateLimitingService(&rateLimitingService);
+    processor.setTransactionLogSink(nullptr);
+    processor.setClock([&clockCalls, operationsPerDay, singleDay]() {
+        const std::uint64_t calls = clockCalls.fetch_add(1, std::memory_order_relaxed);
+        const std::uint64_t day = singleDay ? 0 : calls / operationsPerDay;
+        return SIMULATED_EPOCH + static_cast<std::time_t>(day) * SECONDS_PER_DAY;
+    });
+    TransferEngine engine(accounts, processor);
+
+    std::vector<std::string> accountNumbers;
+    accountNumbers.reserve(static_cast<std::size_t>(config.accountCount));
+    const int accountsPerOwner = AccountManager::getMaxAccountsPerUser();
+    for (int i = 0; i < config.accountCount; ++i) {
+        const std::string number = accounts.createAccount(AccountType::CHECKING, INITIAL_BALANCE,
+                                                          static_cast<std::uint32_t>(i / accountsPerOwner + 1));
+        accounts.verifyAccount(number, true);
+        accountNumbers.push_back(number);
+    }
+    const double initialTotal = accounts.getTotalManagedBalance();
+    const ZipfSampler accountSampler(accountNumbers.size(), config.zipfExponent);
+
+    std::vector<WorkerResult> results(static_cast<std::size_t>(config.threadCount));
+    std::atomic<bool> stop{false};
+    const long allocationsBefore = benchAllocationCount();
+    const auto started = std::chrono::steady_clock::now();
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < config.threadCount; ++t) {
+        workers.emplace_back([&, t]() {
+            WorkerResult& result = results[static_cast<std::size_t>(t)];
+            std::mt19937_64 random(config.seed * 1000003 + static_cast<std::uint64_t>(t));
+            std::discrete_distribution<std::size_t> pickOperation(config.mix.begin(), config.mix.end());
+            std::uniform_int_distribution<int> pickCents(MIN_AMOUNT_CENTS, MAX_AMOUNT_CENTS);
+
+            while (!stop.load(std::memory_order_relaxed)) {
+                const std::size_t operation = pickOperation(random);
+                const std::string& source = accountNumbers[accountSampler.sample(random)];
+                const std::string* destination = &accountNumbers[accountSampler.sample(random)];
+                if (destination == &source) {
+                    destination = &accountNumbers[(static_cast<std::size_t>(destination - accountNumbers.data()) + 1) %
+                                                  accountNumbers.size()];
+                }
+                const double amount = pickCents(random) / 100.0;
+
+                const auto begin = std::chrono::steady_clock::now();
+                const VerificationResult authenticated = authenticationService.verifyMultiFactorToken(source, "");
+                bool answered = false;
+                TransactionStatus status = TransactionStatus::REJECTED;
+                if (authenticated == VerificationResult::SUCCESS) {
+                    answered = true;
+                    status = static_cast<LoadOperation>(operation) == LoadOperation::TRANSFER
+                                 ? engine.transfer(amount, source, *destination)
+                                 : processor.processTransaction(TRANSACTION_TYPES[operation], amount, source,
+                                                                *destination, AccountType::CHECKING);
+                }
+                const std::uint64_t nanoseconds = static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin)
+                        .count());
+
+                recordLatency(result.latency, nanoseconds);
+                if (!answered) {
+                    if (authenticated == VerificationResult::TIMEOUT) {
+                        result.timeoutCount++;
+                    } else {
+                        result.networkErrorCount++;
+                    }
+                    continue;
+                }
+                LoadOperationReport& report = result.operations[operation];
+                report.count++;
+                report.outcomes[static_cast<std::size_t>(status)]++;
+                recordLatency(report.latency, nanoseconds);
+            }
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(config.durationSeconds));
+    stop.store(true, std::memory_order_relaxed);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    LoadReport report{};
+    report.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    report.allocationCount = benchAllocationCount() - allocationsBefore;
+    for (const WorkerResult& result : results) {
+        report.timeoutCount += result.timeoutCount;
+        report.networkErrorCount += result.networkErrorCount;
+        mergeLatency(report.latency, result.latency);
+        for (std::size_t operation = 0; operation < LOAD_OPERATION_COUNT; ++operation) {
+            LoadOperationReport& into = report.operations[operation];
+            const LoadOperationReport& from = result.operations[operation];
+            into.count += from.count;
+            for (std::size_t status = 0; status < TRANSACTION_STATUS_COUNT; ++status) {
+                into.outcomes[status] += from.outcomes[status];
+            }
+            mergeLatency(into.latency, from.latency);
+        }
+    }
+    report.operationCount = report.latency.count;
+
+    // Refunds are counted too but never limited; every other counted outcome had to fit under the cap
+    for (std::size_t operation = 0; operation < LOAD_OPERATION_COUNT; ++operation) {
+        if (static_cast<LoadOperation>(operation) == LoadOperation::REFUND) {
+            continue;
+        }
+        for (std::size_t status = 0; status < TRANSACTION_STATUS_COUNT; ++status) {
+            if (status != static_cast<std::size_t>(TransactionStatus::REJECTED) &&
+                status != static_cast<std::size_t>(TransactionStatus::CANCELLED)) {
+                report.dailyLimitedCount += report.operations[operation].outcomes[status];
+            }
+        }
+    }
+    report.dailyCapHeld = !config.singleDay ||
+                          report.dailyLimitedCount <=
+                              static_cast<std::uint64_t>(TransactionProcessor::getMaxDailyTransactions());
+
+    report.balanceConserved = accounts.getTotalManagedBalance() == initialTotal;
+    for (const std::string& number : accountNumbers) {
+        if (accounts.getAccountBalance(number) < 0.0) {
+            report.negativeBalanceCount++;
+        }
+    }
+    report.peakRssKilobytes = readPeakRssKilobytes();
+    return report;
+}
+
+BaselineCheck checkAgainstBaseline(const LoadGenConfig& config, const LoadReport& report) {
+    BaselineCheck check{false, {}};
+    std::ifstream file(config.baselinePath);
+    if (!file) {
+        return check;
+    }
+    const std::string json((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    double throughput = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+    double peakRss = 0.0;
+    if (!findJsonNumber(json, "throughput_ops_per_sec", throughput) || !findJsonNumber(json, "p99_ns", p99) ||
+        !findJsonNumber(json, "p999_ns", p999) || !findJsonNumber(json, "peak_rss_kb", peakRss)) {
+        return check;
+    }
+    check.loaded = true;
+
+    const auto exceeds = [&check](const char* metric, double value, double baseline, double limit) {
+        if (value > limit) {
+            std::ostringstream line;
+            line << metric << " " << value << " exceeds " << limit << " (baseline " << baseline << ")";
+            check.regressions.push_back(line.str());
+        }
+    };
+    if (report.throughput() < throughput * (1.0 - config.maxThroughputDrop)) {
+        std::ostringstream line;
+        line << "throughput_ops_per_sec " << report.throughput() << " is below "
+             << throughput * (1.0 - config.maxThroughputDrop) << " (baseline " << throughput << ")";
+        check.regressions.push_back(line.str());
+    }
+    exceeds("p99_ns", static_cast<double>(report.latency.valueAtPercentile(99.0)), p99,
+            p99 * (1.0 + config.maxLatencyGrowth));
+    exceeds("p999_ns", static_cast<double>(report.latency.valueAtPercentile(99.9)), p999,
+            p999 * (1.0 + config.maxLatencyGrowth));
+    exceeds("peak_rss_kb", static_cast<double>(report.peakRssKilobytes), peakRss,
+            peakRss * (1.0 + config.maxRssGrowth));
+    return check;
+}
+
+void writeLoadReportJson(std::ostream& out, const LoadGenConfig& config, const LoadReport& report,
+                         const BaselineCheck& baseline) {
+    out << "{\n";
+    out << "  \"throughput_ops_per_sec\": " << static_cast<std::uint64_t>(report.throughput()) << ",\n";
+    out << "  \"latency\": ";
+    writeLatencyJson(out, report.latency);
+    out << ",\n";
+    out << "  \"peak_rss_kb\": " << report.peakRssKilobytes << ",\n";
+    out << "  \"operations\": " << report.operationCount << ",\n";
+    out << "  \"elapsed_s\": " << report.elapsedSeconds << ",\n";
+    out << "  \"allocs_per_op\": "
+        << (report.operationCount == 0 ? 0.0 : static_cast<double>(report.allocationCount) /
+                                                   static_cast<double>(report.operationCount))
+        << ",\n";
+    out << "  \"service_failures\": {\"timeout\": " << report.timeoutCount
+        << ", \"network_error\": " << report.networkErrorCount << "},\n";
+    out << "  \"invariants\": {\"balance_conserved\": " << (report.balanceConserved ? "true" : "false")
+        << ", \"negative_balances\": " << report.negativeBalanceCount
+        << ", \"daily_limited\": " << report.dailyLimitedCount
+        << ", \"daily_cap_held\": " << (report.dailyCapHeld ? "true" : "false") << "},\n";
+
+    out << "  \"by_operation\": {\n";
+    for (std::size_t operation = 0; operation < LOAD_OPERATION_COUNT; ++operation) {
+        const LoadOperationReport& entry = report.operations[operation];
+        out << "    \"" << OPERATION_NAMES[operation] << "\": {\"count\": " << entry.count << ", \"outcomes\": {";
+        for (std::size_t status = 0; status < TRANSACTION_STATUS_COUNT; ++status) {
+            out << (status == 0 ? "" : ", ") << "\"" << STATUS_NAMES[status] << "\": " << entry.outcomes[status];
+        }
+        out << "}, \"latency\": ";
+        writeLatencyJson(out, entry.latency);
+        out << "}" << (operation + 1 < LOAD_OPERATION_COUNT ? "," : "") << "\n";
+    }
+    out << "  },\n";
+
+    out << "  \"config\": {\"duration_s\": " << config.durationSeconds << ", \"threads\": " << config.threadCount
+        << ", \"accounts\": " << config.accountCount << ", \"mix\": {";
+    for (std::size_t operation = 0; operation < LOAD_OPERATION_COUNT; ++operation) {
+        out << (operation == 0 ? "" : ", ") << "\"" << OPERATION_NAMES[operation] << "\": " << config.mix[operation];
+    }
+    out << "}, \"zipf\": " << config.zipfExponent << ", \"service_latency_us\": " << config.serviceLatencyMicros
+        << ", \"timeout_rate\": " << config.timeoutRate << ", \"network_error_rate\": " << config.networkErrorRate
+        << ", \"ops_per_day\": " << config.operationsPerSimulatedDay
+        << ", \"single_day\": " << (config.singleDay ? "true" : "false") << ", \"seed\": " << config.seed << "}";
+
+    if (!config.baselinePath.empty()) {
+        out << ",\n  \"baseline\": {\"path\": ";
+        writeJsonString(out, config.baselinePath);
+        out << ", \"loaded\": " << (baseline.loaded ? "true" : "false") << ", \"regressions\": [";
+        for (std::size_t i = 0; i < baseline.regressions.size(); ++i) {
+            out << (i == 0 ? "" : ", ");
+            writeJsonString(out, baseline.regressions[i]);
+        }
+        out << "]}";
+    }
+    out << "\n}\n";
+}
@@ -0,0 +1,134 @@
+#ifndef LOAD_GENERATOR_HPP
+#define LOAD_GENERATOR_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../inc/Instrumentation.hpp"
+
+/// @brief Operations the load generator issues.
+enum class LoadOperation : std::uint8_t {
+    DEPOSIT,
+    WITHDRAWAL,
+    TRANSFER,
+    REFUND
+};
+
+inline constexpr std::size_t LOAD_OPERATION_COUNT = 4;
+
+/// @brief Workload, fault injection and regression gate settings of one run.
+struct LoadGenConfig {
+    double durationSeconds;
+    int threadCount;
+    int accountCount;
+    std::array<unsigned, LOAD_OPERATION_COUNT> mix;   // relative weights, indexed by LoadOperation
+    double zipfExponent;                              // 0 draws accounts uniformly
+    unsigned serviceLatencyMicros;                    // added to every external service call
+    double timeoutRate;                               // share of MFA checks answering TIMEOUT
+    double networkErrorRate;                          // share of MFA checks answering NETWORK_ERROR
+    int operationsPerSimulatedDay;                    // keeps the daily limits from saturating
+    bool singleDay;                                   // keeps the clock on one day to check the daily cap
+    std::uint64_t seed;
+    std::string outputPath;                           // empty writes the report to stdout
+    std::string baselinePath;                         // empty skips the regression gate
+    double maxThroughputDrop;                         // tolerated fractions relative to the baseline
+    double maxLatencyGrowth;
+    double maxRssGrowth;
+
+    /// @brief Constructs the default configuration.
+    LoadGenConfig();
+};
+
+/// @brief Draws ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s.
+/// @details The cumulative distribution is built once, so a draw is one uniform variate and a
+///          binary search. Rank 0 is the hottest account.
+class ZipfSampler {
+private:
+    std::vector<double> cumulative;
+
+public:
+    /// @brief Constructs a ZipfSampler instance.
+    /// @param [in] count The number of ranks; must be positive.
+    /// @param [in] exponent The skew; 0 gives a uniform distribution.
+    ZipfSampler(std::size_t count, double exponent);
+
+    /// @brief Draws one rank.
+    /// @param [in] engine The random engine of the calling thread.
+    /// @return The rank, in [0, count).
+    std::size_t sample(std::mt19937_64& engine) const;
+};
+
+/// @brief Results of one operation type.
+struct LoadOperationReport {
+    std::uint64_t count;
+    std::array<std::uint64_t, TRANSACTION_STATUS_COUNT> outcomes;   // indexed by TransactionStatus
+    LatencyHistogramSnapshot latency;
+};
+
+/// @brief Results of one run.
+struct LoadReport {
+    double elapsedSeconds;
+    std::uint64_t operationCount;
+    std::uint64_t timeoutCount;          // operations abandoned on a TIMEOUT MFA answer
+    std::uint64_t networkErrorCount;     // operations abandoned on a NETWORK_ERROR MFA answer
+    long allocationCount;
+    long peakRssKilobytes;
+    bool balanceConserved;               // the managed total equals the sum of the initial balances
+    std::size_t negativeBalanceCount;
+    std::uint64_t dailyLimitedCount;     // deposits, withdrawals and transfers counted on the simulated day
+    bool dailyCapHeld;                   // with singleDay, dailyLimitedCount stayed within the daily limit
+    LatencyHistogramSnapshot latency;    // every operation, transport failures included
+    std::array<LoadOperationReport, LOAD_OPERATION_COUNT> operations;
+
+    /// @brief Computes the throughput of the run.
+    /// @return Operations per second; 0 if no time elapsed.
+    double throughput() const;
+};
+
+/// @brief Outcome of comparing a report against a stored baseline.
+struct BaselineCheck {
+    bool loaded;
+    std::vector<std::string> regressions;   // one line per metric outside its tolerance
+};
+
+/// @brief Parses "--name=value" command line arguments into a configuration.
+/// @param [in] argc The argument count.
+/// @param [in] argv The arguments; argv[0] is skipped.
+/// @param [out] config The configuration, defaults for arguments not given.
+/// @param [out] error The first problem found, if any.
+/// @return True if every argument was understood and valid, false otherwise.
+bool parseLoadGenArguments(int argc, const char* const* argv, LoadGenConfig& config, std::string& error);
+
+/// @brief Writes the accepted arguments and their defaults.
+/// @param [in] out The stream to write to.
+void printLoadGenUsage(std::ostream& out);
+
+/// @brief Runs the workload for the configured duration on the configured threads.
+/// @param [in] config The configuration.
+/// @return The collected results.
+LoadReport runLoadGenerator(const LoadGenConfig& config);
+
+/// @brief Compares a report against a baseline report written by an earlier run.
+/// @details Throughput may drop by maxThroughputDrop; p99, p99.9 and peak RSS may grow by
+///          maxLatencyGrowth and maxRssGrowth of their baseline values.
+/// @param [in] config The configuration naming the baseline and the tolerances.
+/// @param [in] report The results of this run.
+/// @return Whether the baseline could be read, and the metrics that regressed.
+BaselineCheck checkAgainstBaseline(const LoadGenConfig& config, const LoadReport& report);
+
+/// @brief Writes a report as JSON.
+/// @details The summary keys come before the per-operation objects, so the first occurrence of a
+///          key is always the summary value; checkAgainstBaseline relies on that.
+/// @param [in] out The stream to write to.
+/// @param [in] config The configuration of the run.
+/// @param [in] report The results.
+/// @param [in] baseline The baseline comparison; ignored unless config names a baseline.
+void writeLoadReportJson(std::ostream& out, const LoadGenConfig& config, const LoadReport& report,
+                         const BaselineCheck& baseline);
+
+#endif // LOAD_GENERATOR_HPP
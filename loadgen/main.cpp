@@ -0,0 +1,53 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+
+#include "LoadGenerator.hpp"
+
+// Exit codes: 0 passed, 1 an invariant broke or a metric regressed against the baseline, 2 bad arguments
+int main(int argc, char** argv) {
+    LoadGenConfig config;
+    std::string error;
+    if (!parseLoadGenArguments(argc, argv, config, error)) {
+        std::cerr << "run_loadgen: " << error << "\n";
+        printLoadGenUsage(std::cerr);
+        return 2;
+    }
+
+    const LoadReport report = runLoadGenerator(config);
+    BaselineCheck baseline{false, {}};
+    if (!config.baselinePath.empty()) {
+        baseline = checkAgainstBaseline(config, report);
+    }
+
+    if (config.outputPath.empty()) {
+        writeLoadReportJson(std::cout, config, report, baseline);
+    } else {
+        std::ofstream file(config.outputPath);
+        if (!file) {
+            std::cerr << "run_loadgen: cannot write " << config.outputPath << "\n";
+            return 2;
+        }
+        writeLoadReportJson(file, config, report, baseline);
+    }
+
+    bool passed = report.balanceConserved && report.negativeBalanceCount == 0;
+    if (!passed) {
+        std::cerr << "run_loadgen: balance invariants broken\n";
+    }
+    if (!report.dailyCapHeld) {
+        std::cerr << "run_loadgen: daily transaction cap exceeded: " << report.dailyLimitedCount << "\n";
+        passed = false;
+    }
+    if (!config.baselinePath.empty()) {
+        if (!baseline.loaded) {
+            std::cerr << "run_loadgen: cannot read baseline " << config.baselinePath << "\n";
+            passed = false;
+        }
+        for (const std::string& regression : baseline.regressions) {
+            std::cerr << "run_loadgen: regression: " << regression << "\n";
+            passed = false;
+        }
+    }
+    return passed ? 0 : 1;
+}
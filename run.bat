@@ -137,6 +137,15 @@ if exist run_tests.exe (
     echo Test executable run_tests.exe not found in build.
     set "RC=1"
 )
+if %RC%==0 (
+    if exist run_allocation_tests.exe (
+        .\run_allocation_tests.exe
+        set "RC=%ERRORLEVEL%"
+    ) else (
+        echo Test executable run_allocation_tests.exe not found in build.
+        set "RC=1"
+    )
+)
 popd
 if %RC% neq 0 (
     echo Tests failed or did not run (code %RC%).
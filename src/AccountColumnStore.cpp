@@ -0,0 +1,108 @@
+#include "AccountColumnStore.hpp"
+#include "AccountIndex.hpp"
+
+AccountColumnStore::AccountColumnStore() {
+}
+
+void AccountColumnStore::load(const AccountIndex& accounts) {
+    const std::size_t count = accounts.size();
+    status.resize(count);
+    riskScore.resize(count);
+    isVerified.resize(count);
+    hasFraudAlert.resize(count);
+    balance.resize(count);
+    evaluatedScore.resize(count);
+    evaluatedStatus.resize(count);
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const Account& account = accounts.entryAt(i);
+        status[i] = static_cast<std::uint8_t>(account.status);
+        riskScore[i] = account.riskScore;
+        isVerified[i] = account.isVerified ? 1 : 0;
+        hasFraudAlert[i] = account.hasFraudAlert ? 1 : 0;
+        balance[i] = account.balance;
+    }
+}
+
+std::size_t AccountColumnStore::size() const {
+    return status.size();
+}
+
+void AccountColumnStore::evaluateRisk(const int* txnCounts, const double* volumes, int highRiskThreshold, bool auditMode,
+                                      const std::uint8_t* linkedFraudAlerts, int linkedFraudScore) {
+    const std::size_t count = size();
+    const std::int32_t highRiskStatus = static_cast<std::int32_t>(auditMode ? AccountStatus::FROZEN : AccountStatus::SUSPENDED);
+    const std::int32_t elevatedStatus = static_cast<std::int32_t>(AccountStatus::PENDING_VERIFICATION);
+    const std::int32_t activeStatus = static_cast<std::int32_t>(AccountStatus::ACTIVE);
+
+    const std::uint8_t* verified = isVerified.data();
+    const std::uint8_t* fraudAlert = hasFraudAlert.data();
+    std::int32_t* scores = evaluatedScore.data();
+    std::uint8_t* statuses = evaluatedStatus.data();
+
+    // Every threshold ladder of the scalar rules is rewritten as a sum of comparison
+    // results so the loop has no data-dependent branches and vectorizes cleanly.
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::int32_t transactions = txnCounts[i];
+        const double volume = volumes[i];
+        const std::int32_t unverified = 1 - static_cast<std::int32_t>(verified[i]);
+        const std::int32_t fraud = static_cast<std::int32_t>(fraudAlert[i]);
+        const std::int32_t linkedFraud = linkedFraudAlerts != nullptr ? static_cast<std::int32_t>(linkedFraudAlerts[i]) : 0;
+
+        // Transaction frequency: > 100 -> 30, > 50 -> 15, > 20 -> 5
+        std::int32_t score = 5 * (transactions > 20) + 10 * (transactions > 50) + 15 * (transactions > 100);
+        // Volume: > 1000000 -> 40, > 500000 -> 20, > 100000 -> 10
+        score += 10 * (volume > 100000.0) + 10 * (volume > 500000.0) + 20 * (volume > 1000000.0);
+        // Verification and fraud alert: both -> 35, unverified -> 20, fraud alert -> 25
+        score += 20 * unverified + 25 * fraud - 10 * unverified * fraud;
+        // Fraud alert on a linked account
+        score += linkedFraudScore * linkedFraud;
+
+        const std::int32_t highRisk = score >= highRiskThreshold;
+        const std::int32_t elevated = (score > 50) & (1 - highRisk);
+        const std::int32_t safe = 1 - highRisk - elevated;
+
+        scores[i] = score;
+        statuses[i] = static_cast<std::uint8_t>(highRisk * highRiskStatus + elevated * elevatedStatus + safe * activeStatus);
+    }
+
+    // Collected in a second pass so the kernel above keeps its branch-free body
+    changedRows.clear();
+    for (std::size_t i = 0; i < count; ++i) {
+        if (scores[i] != riskScore[i] || scores[i] >= highRiskThreshold) {
+            changedRows.push_back(i);
+        }
+    }
+}
+
+const std::uint8_t* AccountColumnStore::getStatus() const {
+    return status.data();
+}
+
+const std::int32_t* AccountColumnStore::getRiskScore() const {
+    return riskScore.data();
+}
+
+const std::uint8_t* AccountColumnStore::getIsVerified() const {
+    return isVerified.data();
+}
+
+const std::uint8_t* AccountColumnStore::getHasFraudAlert() const {
+    return hasFraudAlert.data();
+}
+
+const Money* AccountColumnStore::getBalance() const {
+    return balance.data();
+}
+
+const std::int32_t* AccountColumnStore::getEvaluatedScore() const {
+    return evaluatedScore.data();
+}
+
+const std::uint8_t* AccountColumnStore::getEvaluatedStatus() const {
+    return evaluatedStatus.data();
+}
+
+const std::vector<std::size_t>& AccountColumnStore::getChangedRows() const {
+    return changedRows;
+}
@@ -0,0 +1,161 @@
+#include "AccountIndex.hpp"
+#include <charconv>
+#include <climits>
+
+// Static member initialization
+const std::uint32_t AccountIndex::EMPTY_SLOT = 0xFFFFFFFFu;
+
+namespace {
+
+const std::size_t INITIAL_SLOT_COUNT = 16;
+
+} // namespace
+
+AccountIndex::AccountIndex(std::pmr::memory_resource* resource)
+    : slots(INITIAL_SLOT_COUNT, Slot{0, EMPTY_SLOT}, resource), entries(resource), slotMask(INITIAL_SLOT_COUNT - 1) {
+}
+
+bool AccountIndex::parseAccountId(const std::string& accountNumber, int& accountId) {
+    const std::size_t length = accountNumber.size();
+    if (length < 4 || length > 13 ||
+        accountNumber[0] != 'A' || accountNumber[1] != 'C' || accountNumber[2] != 'C') {
+        return false;
+    }
+
+    // Leading zeros would alias distinct strings onto the same id
+    if (accountNumber[3] == '0' && length > 4) {
+        return false;
+    }
+
+    long long value = 0;
+    for (std::size_t i = 3; i < length; ++i) {
+        unsigned digit = static_cast<unsigned>(accountNumber[i] - '0');
+        if (digit > 9) {
+            return false;
+        }
+        value = value * 10 + digit;
+    }
+
+    if (value > INT_MAX) {
+        return false;
+    }
+
+    accountId = static_cast<int>(value);
+    return true;
+}
+
+std::string AccountIndex::formatAccountNumber(int accountId) {
+    // "ACC" and at most 10 digits: one inline string, no temporary from std::to_string
+    char buffer[16] = {'A', 'C', 'C'};
+    const std::to_chars_result end = std::to_chars(buffer + 3, buffer + sizeof(buffer), accountId);
+    return std::string(buffer, end.ptr);
+}
+
+std::size_t AccountIndex::homeSlot(std::uint32_t accountId) const {
+    // Fibonacci hashing spreads the sequential ids handed out by the account counter
+    std::uint64_t hash = static_cast<std::uint64_t>(accountId) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(hash >> 32) & slotMask;
+}
+
+Account* AccountIndex::find(int accountId) {
+    return const_cast<Account*>(static_cast<const AccountIndex*>(this)->find(accountId));
+}
+
+const Account* AccountIndex::find(int accountId) const {
+    if (accountId < 0) {
+        return nullptr;
+    }
+
+    const std::uint32_t key = static_cast<std::uint32_t>(accountId);
+    for (std::size_t position = homeSlot(key); ; position = (position + 1) & slotMask) {
+        const Slot& slot = slots[position];
+        if (slot.entry == EMPTY_SLOT) {
+            return nullptr;
+        }
+        if (slot.accountId == key) {
+            return &entries[slot.entry];
+        }
+    }
+}
+
+Account* AccountIndex::find(const std::string& accountNumber) {
+    int accountId = 0;
+    if (!parseAccountId(accountNumber, accountId)) {
+        return nullptr;
+    }
+    return find(accountId);
+}
+
+const Account* AccountIndex::find(const std::string& accountNumber) const {
+    int accountId = 0;
+    if (!parseAccountId(accountNumber, accountId)) {
+        return nullptr;
+    }
+    return find(accountId);
+}
+
+Account* AccountIndex::insert(int accountId, const Account& account) {
+    if (accountId < 0 || find(accountId) != nullptr) {
+        return nullptr;
+    }
+
+    // Keep the load factor at or below one half so probes stay short
+    if ((entries.size() + 1) * 2 > slots.size()) {
+        rehash(slots.size() * 2);
+    }
+
+    const std::uint32_t key = static_cast<std::uint32_t>(accountId);
+    std::size_t position = homeSlot(key);
+    while (slots[position].entry != EMPTY_SLOT) {
+        position = (position + 1) & slotMask;
+    }
+
+    slots[position] = Slot{key, static_cast<std::uint32_t>(entries.size())};
+    entries.push_back(account);
+    return &entries.back();
+}
+
+void AccountIndex::reserve(std::size_t accountCount) {
+    std::size_t slotCount = slots.size();
+    while (slotCount < accountCount * 2) {
+        slotCount *= 2;
+    }
+    if (slotCount != slots.size()) {
+        rehash(slotCount);
+    }
+}
+
+void AccountIndex::clear() {
+    entries.clear();
+    slots.assign(INITIAL_SLOT_COUNT, Slot{0, EMPTY_SLOT});
+    slotMask = INITIAL_SLOT_COUNT - 1;
+}
+
+std::size_t AccountIndex::size() const {
+    return entries.size();
+}
+
+Account& AccountIndex::entryAt(std::size_t position) {
+    return entries[position];
+}
+
+const Account& AccountIndex::entryAt(std::size_t position) const {
+    return entries[position];
+}
+
+void AccountIndex::rehash(std::size_t slotCount) {
+    std::pmr::vector<Slot> previous(slotCount, Slot{0, EMPTY_SLOT}, slots.get_allocator());
+    previous.swap(slots);
+    slotMask = slotCount - 1;
+
+    for (const Slot& slot : previous) {
+        if (slot.entry == EMPTY_SLOT) {
+            continue;
+        }
+        std::size_t position = homeSlot(slot.accountId);
+        while (slots[position].entry != EMPTY_SLOT) {
+            position = (position + 1) & slotMask;
+        }
+        slots[position] = slot;
+    }
+}
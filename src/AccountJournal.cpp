@@ -0,0 +1,436 @@
+#include "AccountJournal.hpp"
+#include "AccountIndex.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#if defined(_WIN32)
+    #include <io.h>
+#else
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+static_assert(sizeof(AccountLogRecord) == 48, "AccountLogRecord layout is part of the WAL and snapshot formats");
+static_assert(sizeof(AccountSnapshotHeader) == 64, "AccountSnapshotHeader layout is part of the snapshot format");
+
+namespace {
+
+const char WAL_MAGIC[8] = {'A', 'C', 'C', 'W', 'A', 'L', '0', '2'};
+const char SNAPSHOT_MAGIC[8] = {'A', 'C', 'C', 'S', 'N', 'A', 'P', '2'};
+
+struct WalHeader {
+    char magic[8];
+    std::uint32_t recordSize;
+    std::uint32_t reserved;
+    std::uint64_t firstSequence;
+    char padding[AccountWriteAheadLog::HEADER_SIZE - 24];
+};
+
+static_assert(sizeof(WalHeader) == AccountWriteAheadLog::HEADER_SIZE, "WAL header must fill HEADER_SIZE bytes");
+
+std::uint64_t fnv1a64(const void* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325ULL) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+bool syncFile(std::FILE* file) {
+    if (std::fflush(file) != 0) {
+        return false;
+    }
+#if defined(_WIN32)
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+void syncParentDirectory(const std::string& path) {
+#if !defined(_WIN32)
+    // Makes the rename itself durable; best effort, as not every file system supports it
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    int directory = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY);
+    if (directory >= 0) {
+        fsync(directory);
+        ::close(directory);
+    }
+#else
+    (void)path;
+#endif
+}
+
+// Reads the header and the intact record prefix of an open log.
+// Returns false for a foreign layout; recordCount receives the number of intact records.
+bool scanLog(std::FILE* file, std::uint64_t& firstSequence, std::uint64_t& recordCount,
+             const std::function<void(const AccountLogRecord&)>* visit) {
+    WalHeader header;
+    if (std::fread(&header, sizeof(header), 1, file) != 1 ||
+        std::memcmp(header.magic, WAL_MAGIC, sizeof(WAL_MAGIC)) != 0 ||
+        header.recordSize != sizeof(AccountLogRecord)) {
+        return false;
+    }
+
+    firstSequence = header.firstSequence;
+    recordCount = 0;
+    AccountLogRecord record;
+    while (std::fread(&record, sizeof(record), 1, file) == 1) {
+        // A sequence gap or checksum mismatch marks the torn tail of the last group commit
+        if (record.sequence != firstSequence + recordCount || record.checksum != record.computeChecksum()) {
+            break;
+        }
+        if (visit != nullptr) {
+            (*visit)(record);
+        }
+        recordCount++;
+    }
+    return true;
+}
+
+} // namespace
+
+AccountLogRecord AccountLogRecord::fromAccount(AccountLogOperation operation, int accountId,
+                                               const Account& account, int suspendedAccountCount) {
+    AccountLogRecord record{};
+    record.accountId = accountId;
+    record.riskScore = account.riskScore;
+    record.balance = account.balance;
+    record.creditLimit = account.creditLimit;
+    record.suspendedAccountCount = suspendedAccountCount;
+    record.operation = static_cast<std::uint8_t>(operation);
+    record.type = static_cast<std::uint8_t>(account.type);
+    record.status = static_cast<std::uint8_t>(account.status);
+    record.flags = static_cast<std::uint8_t>((account.isVerified ? VERIFIED_FLAG : 0) |
+                                             (account.hasFraudAlert ? FRAUD_ALERT_FLAG : 0));
+    record.ownerId = account.ownerId;
+    return record;
+}
+
+Account AccountLogRecord::toAccount() const {
+    return Account{
+        AccountIndex::formatAccountNumber(accountId),
+        static_cast<AccountType>(type),
+        static_cast<AccountStatus>(status),
+        balance,
+        creditLimit,
+        riskScore,
+        (flags & VERIFIED_FLAG) != 0,
+        (flags & FRAUD_ALERT_FLAG) != 0,
+        ownerId
+    };
+}
+
+std::uint32_t AccountLogRecord::computeChecksum() const {
+    std::uint64_t hash = fnv1a64(this, offsetof(AccountLogRecord, checksum));
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+AccountWriteAheadLog::AccountWriteAheadLog(std::chrono::milliseconds flushInterval, std::size_t maxBatchRecords)
+    : file(nullptr), nextSequence(1), durableSequence(0), syncCount(0), syncRequested(false),
+      stopRequested(false), writeFailed(false), flushInterval(flushInterval),
+      maxBatchRecords(maxBatchRecords == 0 ? 1 : maxBatchRecords) {
+}
+
+AccountWriteAheadLog::~AccountWriteAheadLog() {
+    close();
+}
+
+bool AccountWriteAheadLog::writeHeader(std::uint64_t firstSequence) {
+    WalHeader header{};
+    std::memcpy(header.magic, WAL_MAGIC, sizeof(WAL_MAGIC));
+    header.recordSize = sizeof(AccountLogRecord);
+    header.firstSequence = firstSequence;
+    return std::fwrite(&header, sizeof(header), 1, file) == 1 && syncFile(file);
+}
+
+bool AccountWriteAheadLog::open(const std::string& logPath) {
+    close();
+
+    std::uint64_t firstSequence = 1;
+    std::uint64_t recordCount = 0;
+    std::error_code error;
+    const bool exists = std::filesystem::exists(logPath, error);
+    const std::uintmax_t fileSize = exists ? std::filesystem::file_size(logPath, error) : 0;
+    if (error) {
+        return false;
+    }
+
+    if (exists && fileSize > 0) {
+        // Validate read-only first, so a foreign file is never modified
+        std::FILE* existing = std::fopen(logPath.c_str(), "rb");
+        if (existing == nullptr) {
+            return false;
+        }
+        bool valid = scanLog(existing, firstSequence, recordCount, nullptr);
+        std::fclose(existing);
+        if (!valid) {
+            return false;
+        }
+
+        const std::uintmax_t intactSize = HEADER_SIZE + recordCount * sizeof(AccountLogRecord);
+        if (fileSize > intactSize) {
+            std::filesystem::resize_file(logPath, intactSize, error);
+            if (error) {
+                return false;
+            }
+        }
+        file = std::fopen(logPath.c_str(), "r+b");
+        if (file == nullptr || std::fseek(file, 0, SEEK_END) != 0) {
+            close();
+            return false;
+        }
+    } else {
+        file = std::fopen(logPath.c_str(), "w+b");
+        if (file == nullptr || !writeHeader(firstSequence)) {
+            close();
+            return false;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    path = logPath;
+    nextSequence = firstSequence + recordCount;
+    durableSequence = nextSequence - 1;
+    stopRequested = false;
+    writeFailed = false;
+    flushThread = std::thread(&AccountWriteAheadLog::flushLoop, this);
+    return true;
+}
+
+void AccountWriteAheadLog::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    flushWanted.notify_all();
+    if (flushThread.joinable()) {
+        flushThread.join();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file != nullptr) {
+            std::fclose(file);
+            file = nullptr;
+        }
+    }
+    flushDone.notify_all();
+}
+
+bool AccountWriteAheadLog::isOpen() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return file != nullptr && !stopRequested;
+}
+
+std::uint64_t AccountWriteAheadLog::append(AccountLogRecord record) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (file == nullptr || stopRequested) {
+        return 0;
+    }
+    record.sequence = nextSequence++;
+    record.checksum = record.computeChecksum();
+    pending.push_back(record);
+    if (pending.size() >= maxBatchRecords) {
+        flushWanted.notify_one();
+    }
+    return record.sequence;
+}
+
+void AccountWriteAheadLog::flushLoop() {
+    std::vector<AccountLogRecord> batch;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        flushWanted.wait_for(lock, flushInterval, [this]() {
+            return stopRequested || syncRequested || pending.size() >= maxBatchRecords;
+        });
+        if (pending.empty()) {
+            syncRequested = false;
+            if (stopRequested) {
+                return;
+            }
+            continue;
+        }
+
+        // One write and one fsync for everything appended since the last flush
+        batch.swap(pending);
+        const std::uint64_t lastSequence = batch.back().sequence;
+        lock.unlock();
+        bool written = std::fwrite(batch.data(), sizeof(AccountLogRecord), batch.size(), file) == batch.size() &&
+                       syncFile(file);
+        batch.clear();
+        lock.lock();
+
+        syncCount++;
+        if (written) {
+            durableSequence = lastSequence;
+        } else {
+            writeFailed = true;
+        }
+        syncRequested = syncRequested && !pending.empty();
+        flushDone.notify_all();
+    }
+}
+
+bool AccountWriteAheadLog::waitDurable(std::uint64_t sequence) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (durableSequence >= sequence) {
+        return true;
+    }
+    if (file == nullptr || stopRequested || writeFailed) {
+        return false;
+    }
+    syncRequested = true;
+    flushWanted.notify_one();
+    flushDone.wait(lock, [this, sequence]() {
+        return durableSequence >= sequence || writeFailed || file == nullptr;
+    });
+    return durableSequence >= sequence;
+}
+
+bool AccountWriteAheadLog::sync() {
+    return waitDurable(getLastSequence());
+}
+
+bool AccountWriteAheadLog::reset() {
+    std::string logPath;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (file == nullptr) {
+            return false;
+        }
+        logPath = path;
+    }
+
+    // Stopping the flusher writes out everything pending before the file is truncated;
+    // appends are refused until the flusher restarts
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    flushWanted.notify_all();
+    flushThread.join();
+    std::fclose(file);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    file = std::fopen(logPath.c_str(), "w+b");
+    if (file == nullptr || !writeHeader(nextSequence)) {
+        if (file != nullptr) {
+            std::fclose(file);
+            file = nullptr;
+        }
+        writeFailed = true;
+        flushDone.notify_all();
+        return false;
+    }
+    stopRequested = false;
+    flushThread = std::thread(&AccountWriteAheadLog::flushLoop, this);
+    return !writeFailed;
+}
+
+std::uint64_t AccountWriteAheadLog::getLastSequence() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return nextSequence - 1;
+}
+
+std::size_t AccountWriteAheadLog::getSyncCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return syncCount;
+}
+
+bool AccountWriteAheadLog::readRecords(const std::string& path,
+                                       const std::function<void(const AccountLogRecord&)>& visit) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        std::error_code error;
+        return !std::filesystem::exists(path, error);
+    }
+
+    std::fseek(file, 0, SEEK_END);
+    const long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+
+    std::uint64_t firstSequence = 0;
+    std::uint64_t recordCount = 0;
+    bool valid = size == 0 || scanLog(file, firstSequence, recordCount, &visit);
+    std::fclose(file);
+    return valid;
+}
+
+std::uint64_t AccountSnapshot::computeChecksum(const AccountSnapshotHeader& header,
+                                               const AccountLogRecord* records, std::size_t count) {
+    AccountSnapshotHeader unsummed = header;
+    unsummed.checksum = 0;
+    return fnv1a64(records, count * sizeof(AccountLogRecord), fnv1a64(&unsummed, sizeof(unsummed)));
+}
+
+bool AccountSnapshot::isValidHeader(const AccountSnapshotHeader& header, std::uint64_t fileSize) {
+    return std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) == 0 &&
+           header.recordSize == sizeof(AccountLogRecord) &&
+           header.accountCount <= (fileSize - sizeof(AccountSnapshotHeader)) / sizeof(AccountLogRecord) &&
+           fileSize == sizeof(AccountSnapshotHeader) + header.accountCount * sizeof(AccountLogRecord);
+}
+
+bool AccountSnapshot::write(const std::string& path, AccountSnapshotHeader header,
+                            std::vector<AccountLogRecord> records) {
+    std::sort(records.begin(), records.end(), [](const AccountLogRecord& left, const AccountLogRecord& right) {
+        return left.accountId < right.accountId;
+    });
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.recordSize = sizeof(AccountLogRecord);
+    header.flags = AccountSnapshotHeader::SORTED_BY_ID_FLAG;
+    header.accountCount = records.size();
+    header.checksum = computeChecksum(header, records.data(), records.size());
+
+    const std::string temporaryPath = path + ".tmp";
+    std::FILE* file = std::fopen(temporaryPath.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool written = std::fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   std::fwrite(records.data(), sizeof(AccountLogRecord), records.size(), file) == records.size() &&
+                   syncFile(file);
+    std::fclose(file);
+
+    std::error_code error;
+    if (written) {
+        std::filesystem::rename(temporaryPath, path, error);
+    }
+    if (!written || error) {
+        std::filesystem::remove(temporaryPath, error);
+        return false;
+    }
+    syncParentDirectory(path);
+    return true;
+}
+
+bool AccountSnapshot::read(const std::string& path, AccountSnapshotHeader& header,
+                           std::vector<AccountLogRecord>& records) {
+    std::error_code error;
+    const std::uintmax_t fileSize = std::filesystem::file_size(path, error);
+    if (error || fileSize < sizeof(AccountSnapshotHeader)) {
+        return false;
+    }
+
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return false;
+    }
+    bool valid = std::fread(&header, sizeof(header), 1, file) == 1 && isValidHeader(header, fileSize);
+    if (valid) {
+        records.resize(static_cast<std::size_t>(header.accountCount));
+        valid = std::fread(records.data(), sizeof(AccountLogRecord), records.size(), file) == records.size();
+    }
+    std::fclose(file);
+
+    if (valid) {
+        valid = computeChecksum(header, records.data(), records.size()) == header.checksum;
+    }
+    if (!valid) {
+        records.clear();
+    }
+    return valid;
+}
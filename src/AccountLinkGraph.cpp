@@ -0,0 +1,76 @@
+#include "AccountLinkGraph.hpp"
+#include <algorithm>
+
+AccountLinkGraph::AccountLinkGraph() : deadEdgeCount(0) {
+}
+
+void AccountLinkGraph::setLinks(int accountId, const std::vector<int>& linkedIds, Clock::time_point fetchedAt) {
+    const auto inserted = rowOf.try_emplace(accountId, static_cast<std::uint32_t>(rows.size()));
+    if (inserted.second) {
+        rows.push_back(Row{0, 0, fetchedAt});
+    }
+    Row& row = rows[inserted.first->second];
+    row.fetchedAt = fetchedAt;
+
+    // An unchanged or shrinking row is rewritten in place, the usual outcome of a refresh
+    if (linkedIds.size() <= row.count) {
+        deadEdgeCount += row.count - linkedIds.size();
+        row.count = static_cast<std::uint32_t>(linkedIds.size());
+        std::copy(linkedIds.begin(), linkedIds.end(), edges.begin() + row.offset);
+        return;
+    }
+
+    deadEdgeCount += row.count;
+    row.offset = static_cast<std::uint32_t>(edges.size());
+    row.count = static_cast<std::uint32_t>(linkedIds.size());
+    edges.insert(edges.end(), linkedIds.begin(), linkedIds.end());
+
+    if (deadEdgeCount > edges.size() - deadEdgeCount) {
+        compact();
+    }
+}
+
+void AccountLinkGraph::compact() {
+    std::vector<int> live;
+    live.reserve(edges.size() - deadEdgeCount);
+    for (Row& row : rows) {
+        const std::uint32_t offset = static_cast<std::uint32_t>(live.size());
+        live.insert(live.end(), edges.begin() + row.offset, edges.begin() + row.offset + row.count);
+        row.offset = offset;
+    }
+    edges.swap(live);
+    deadEdgeCount = 0;
+}
+
+bool AccountLinkGraph::findLinks(int accountId, const int*& links, std::size_t& count) const {
+    const auto found = rowOf.find(accountId);
+    if (found == rowOf.end()) {
+        links = nullptr;
+        count = 0;
+        return false;
+    }
+    const Row& row = rows[found->second];
+    links = edges.data() + row.offset;
+    count = row.count;
+    return true;
+}
+
+bool AccountLinkGraph::isFresh(int accountId, Clock::time_point now, Clock::duration maxAge) const {
+    const auto found = rowOf.find(accountId);
+    return found != rowOf.end() && now - rows[found->second].fetchedAt <= maxAge;
+}
+
+void AccountLinkGraph::clear() {
+    rows.clear();
+    rowOf.clear();
+    edges.clear();
+    deadEdgeCount = 0;
+}
+
+std::size_t AccountLinkGraph::size() const {
+    return rows.size();
+}
+
+std::size_t AccountLinkGraph::getLinkCount() const {
+    return edges.size() - deadEdgeCount;
+}
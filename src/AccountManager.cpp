@@ -1,22 +1,32 @@
 #include "AccountManager.hpp"
 #include "ExternalServices.hpp"
+#include "AsyncExternalServices.hpp"
+#include "Instrumentation.hpp"
+#include "ProcessingContext.hpp"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
 #include <iostream>
-#include <sstream>
-
-// Global variables
-int g_totalAccountsCreated = 0;
-double g_systemTotalBalance = 0.0;
-bool g_complianceAuditMode = false;
+#include <system_error>
+#include <utility>
 
 // Static member initialization
-int AccountManager::accountCounter = 500000;
-const double AccountManager::MINIMUM_BALANCE = 0.01;
+std::atomic<int> AccountManager::accountCounter(500000);
 const int AccountManager::HIGH_RISK_THRESHOLD = 75;
 const int AccountManager::MAX_ACCOUNTS_PER_USER = 10;
+const int AccountManager::LINKED_FRAUD_ALERT_RISK = 15;
+const std::uint32_t AccountManager::DEFAULT_OWNER_ID;
+const int AccountManager::DEFAULT_LINK_CACHE_TTL_MS;
 
-AccountManager::AccountManager() 
-    : suspendedAccountCount(0), totalManagedBalance(0.0), 
-      authService(nullptr), notificationService(nullptr), dataService(nullptr) {
+AccountManager::AccountManager(std::pmr::memory_resource* upstream)
+    : accountMemory(upstream), accounts(&accountMemory),
+      linkCacheTtl(DEFAULT_LINK_CACHE_TTL_MS),
+      ownerAccountCounts(&accountMemory), ownerCountsStale(false),
+      statusIndex(&accountMemory), statusIndexStale(false),
+      suspendedAccountCount(0), totalManagedBalance(), 
+      authService(nullptr), notificationService(nullptr), dataService(nullptr),
+      asyncDataService(nullptr), asyncNotificationService(nullptr), context(&ProcessingContext::global()),
+      writeAheadLog(nullptr), recordsPerSnapshot(0), recordsSinceSnapshot(0), materializedCount(0) {
 }
 
 AccountManager::~AccountManager() {
@@ -34,46 +44,423 @@ void AccountManager::setExternalDataService(ExternalDataService* service) {
     dataService = service;
 }
 
-std::string AccountManager::createAccount(AccountType type, double initialBalance) {
+void AccountManager::setAsyncExternalDataService(AsyncExternalDataService* service) {
+    asyncDataService = service;
+}
+
+void AccountManager::setAsyncNotificationService(AsyncNotificationService* service) {
+    asyncNotificationService = service;
+}
+
+void AccountManager::setProcessingContext(ProcessingContext* processingContext) {
+    context = processingContext != nullptr ? processingContext : &ProcessingContext::global();
+}
+
+ProcessingContext& AccountManager::getProcessingContext() const {
+    return *context;
+}
+
+void AccountManager::setLinkCacheTtl(std::chrono::milliseconds ttl) {
+    linkCacheTtl = ttl;
+}
+
+const AccountLinkGraph& AccountManager::getLinkGraph() const {
+    return linkGraph;
+}
+
+void AccountManager::setWriteAheadLog(AccountWriteAheadLog* log) {
+    writeAheadLog = log;
+}
+
+void AccountManager::setSnapshotPolicy(const std::string& path, std::size_t recordsPerSnapshot) {
+    snapshotPath = path;
+    this->recordsPerSnapshot = recordsPerSnapshot;
+    recordsSinceSnapshot = 0;
+}
+
+void AccountManager::logMutation(AccountLogOperation operation, const Account& account) {
+    if (writeAheadLog == nullptr) {
+        return;
+    }
+    
+    int accountId = 0;
+    AccountIndex::parseAccountId(account.accountNumber, accountId);
+    writeAheadLog->append(AccountLogRecord::fromAccount(operation, accountId, account, suspendedAccountCount));
+    
+    if (recordsPerSnapshot != 0 && ++recordsSinceSnapshot >= recordsPerSnapshot) {
+        writeSnapshot(snapshotPath);
+    }
+}
+
+bool AccountManager::writeSnapshot(const std::string& path) {
+    std::vector<AccountLogRecord> records;
+    records.reserve(static_cast<std::size_t>(getAccountCount()));
+    for (std::size_t i = 0; i < accounts.size(); ++i) {
+        const Account& account = accounts.entryAt(i);
+        int accountId = 0;
+        AccountIndex::parseAccountId(account.accountNumber, accountId);
+        records.push_back(AccountLogRecord::fromAccount(AccountLogOperation::CREATE, accountId, account,
+                                                        suspendedAccountCount));
+    }
+    // Accounts still served from the mapped snapshot are copied image for image
+    for (std::size_t i = 0; i < mappedBook.size(); ++i) {
+        const AccountLogRecord& image = mappedBook.recordAt(i);
+        if (accounts.find(image.accountId) == nullptr) {
+            records.push_back(image);
+            records.back().sequence = 0;
+            records.back().suspendedAccountCount = suspendedAccountCount;
+        }
+    }
+    
+    AccountSnapshotHeader header{};
+    header.lastSequence = writeAheadLog != nullptr ? writeAheadLog->getLastSequence() : 0;
+    header.suspendedAccountCount = suspendedAccountCount;
+    header.accountCounter = accountCounter.load(std::memory_order_relaxed);
+    header.totalManagedBalance = totalManagedBalance;
+    
+    recordsSinceSnapshot = 0;
+    if (!AccountSnapshot::write(path, header, std::move(records))) {
+        return false;
+    }
+    
+    // Records up to lastSequence are now redundant; recovery skips them should the reset not happen
+    if (writeAheadLog != nullptr) {
+        writeAheadLog->reset();
+    }
+    return true;
+}
+
+bool AccountManager::recover(const std::string& snapshotPath, const std::string& walPath) {
+    if (accounts.size() != 0 || mappedBook.isOpen()) {
+        return false;
+    }
+    
+    AccountSnapshotHeader header{};
+    std::vector<AccountLogRecord> records;
+    std::error_code error;
+    if (std::filesystem::exists(snapshotPath, error) && !AccountSnapshot::read(snapshotPath, header, records)) {
+        return false;
+    }
+    
+    int highestId = static_cast<int>(header.accountCounter);
+    accounts.reserve(records.size());
+    for (const AccountLogRecord& record : records) {
+        accounts.insert(record.accountId, record.toAccount());
+        highestId = std::max(highestId, record.accountId);
+    }
+    suspendedAccountCount = static_cast<int>(header.suspendedAccountCount);
+    totalManagedBalance = header.totalManagedBalance;
+    
+    bool replayed = AccountWriteAheadLog::readRecords(walPath, [&](const AccountLogRecord& record) {
+        if (record.sequence <= header.lastSequence) {
+            return;
+        }
+        const AccountLogOperation operation = static_cast<AccountLogOperation>(record.operation);
+        Account* found = accounts.find(record.accountId);
+        if (found != nullptr) {
+            // A balance adjustment moves the total by the change it made to the account
+            if (operation == AccountLogOperation::ADJUST_BALANCE) {
+                totalManagedBalance += record.balance - found->balance;
+            }
+            *found = record.toAccount();
+        } else {
+            accounts.insert(record.accountId, record.toAccount());
+        }
+        if (operation == AccountLogOperation::CREATE) {
+            totalManagedBalance += record.balance;
+        }
+        suspendedAccountCount = record.suspendedAccountCount;
+        highestId = std::max(highestId, record.accountId);
+    });
+    
+    // New accounts must not reuse a recovered id
+    ownerCountsStale = true;
+    statusIndexStale = true;
+    int current = accountCounter.load(std::memory_order_relaxed);
+    while (current < highestId && !accountCounter.compare_exchange_weak(current, highestId, std::memory_order_relaxed)) {
+    }
+    return replayed;
+}
+
+bool AccountManager::openSnapshot(const std::string& snapshotPath, const std::string& walPath) {
+    if (accounts.size() != 0 || mappedBook.isOpen()) {
+        return false;
+    }
+    
+    std::uint64_t lastSequence = 0;
+    int highestId = 0;
+    std::error_code error;
+    if (std::filesystem::exists(snapshotPath, error)) {
+        if (!mappedBook.open(snapshotPath)) {
+            return false;
+        }
+        const AccountSnapshotHeader& header = mappedBook.getHeader();
+        lastSequence = header.lastSequence;
+        suspendedAccountCount = static_cast<int>(header.suspendedAccountCount);
+        totalManagedBalance = header.totalManagedBalance;
+        highestId = static_cast<int>(header.accountCounter);
+        if (mappedBook.size() != 0) {
+            // Images are sorted by id, so the last one holds the highest id
+            highestId = std::max(highestId, mappedBook.recordAt(mappedBook.size() - 1).accountId);
+        }
+    }
+    
+    bool replayed = AccountWriteAheadLog::readRecords(walPath, [&](const AccountLogRecord& record) {
+        if (record.sequence <= lastSequence) {
+            return;
+        }
+        const AccountLogOperation operation = static_cast<AccountLogOperation>(record.operation);
+        Account* found = accounts.find(record.accountId);
+        if (found != nullptr) {
+            if (operation == AccountLogOperation::ADJUST_BALANCE) {
+                totalManagedBalance += record.balance - found->balance;
+            }
+            *found = record.toAccount();
+        } else {
+            const AccountLogRecord* image = mappedBook.find(record.accountId);
+            if (image != nullptr && operation == AccountLogOperation::ADJUST_BALANCE) {
+                totalManagedBalance += record.balance - image->balance;
+            }
+            accounts.insert(record.accountId, record.toAccount());
+            if (image != nullptr) {
+                materializedCount++;
+            }
+        }
+        if (operation == AccountLogOperation::CREATE) {
+            totalManagedBalance += record.balance;
+        }
+        suspendedAccountCount = record.suspendedAccountCount;
+        highestId = std::max(highestId, record.accountId);
+    });
+    
+    ownerCountsStale = true;
+    statusIndexStale = true;
+    int current = accountCounter.load(std::memory_order_relaxed);
+    while (current < highestId && !accountCounter.compare_exchange_weak(current, highestId, std::memory_order_relaxed)) {
+    }
+    return replayed;
+}
+
+Account* AccountManager::findAccount(const std::string& accountNumber) {
+    Account* found = accounts.find(accountNumber);
+    if (found != nullptr || !mappedBook.isOpen()) {
+        return found;
+    }
+    
+    const AccountLogRecord* image = mappedBook.find(accountNumber);
+    if (image == nullptr) {
+        return nullptr;
+    }
+    materializedCount++;
+    return accounts.insert(image->accountId, image->toAccount());
+}
+
+void AccountManager::materializeAll() {
+    if (materializedCount == mappedBook.size()) {
+        return;
+    }
+    accounts.reserve(accounts.size() + mappedBook.size() - materializedCount);
+    for (std::size_t i = 0; i < mappedBook.size(); ++i) {
+        const AccountLogRecord& image = mappedBook.recordAt(i);
+        if (accounts.find(image.accountId) == nullptr) {
+            accounts.insert(image.accountId, image.toAccount());
+            materializedCount++;
+        }
+    }
+}
+
+bool AccountManager::parseInitialBalance(double initialBalance, Money& balance) {
+    // The raw amount is checked against the minimum, then rounded to the nearest cent, as processTransaction does
+    if (!std::isfinite(initialBalance) || initialBalance < MINIMUM_BALANCE.toDouble()) {
+        return false;
+    }
+    balance = Money(initialBalance);
+    return true;
+}
+
+std::string AccountManager::createAccount(AccountType type, double initialBalance, std::uint32_t ownerId) {
     // Validation with complex flow
-    if (initialBalance < MINIMUM_BALANCE) {
+    Money balance;
+    if (!parseInitialBalance(initialBalance, balance)) {
+        return "";
+    }
+    
+    if (ownerAccountCount(ownerId) >= MAX_ACCOUNTS_PER_USER) {
+        return "";
+    }
+    
+    return createReservedAccount(reserveAccountIds(1), type, initialBalance, ownerId);
+}
+
+std::vector<std::string> AccountManager::createAccounts(std::size_t count, AccountType type, const double* balances,
+                                                        const std::uint32_t* ownerIds) {
+    std::vector<std::string> accountNumbers(count);
+    
+    // Admit in input order, counting each admitted account against its owner right away
+    std::vector<Money> amounts(count);
+    std::vector<bool> admitted(count, false);
+    std::size_t admittedCount = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const std::uint32_t ownerId = ownerIds != nullptr ? ownerIds[i] : DEFAULT_OWNER_ID;
+        int& owned = ownerAccountCount(ownerId);
+        if (parseInitialBalance(balances[i], amounts[i]) && owned < MAX_ACCOUNTS_PER_USER) {
+            owned++;
+            admitted[i] = true;
+            admittedCount++;
+        }
+    }
+    if (admittedCount == 0) {
+        return accountNumbers;
+    }
+    
+    accounts.reserve(accounts.size() + admittedCount);
+    if (!statusIndexStale) {
+        statusIndex.reserve(statusIndex.size() + admittedCount);
+    }
+    int accountId = reserveAccountIds(static_cast<int>(admittedCount));
+    Money createdBalance;
+    int createdCount = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!admitted[i]) {
+            continue;
+        }
+        const std::uint32_t ownerId = ownerIds != nullptr ? ownerIds[i] : DEFAULT_OWNER_ID;
+        Account* inserted = insertNewAccount(accountId++, type, amounts[i], ownerId);
+        if (inserted == nullptr) {
+            ownerAccountCount(ownerId)--;
+            continue;
+        }
+        accountNumbers[i] = inserted->accountNumber;
+        createdBalance += amounts[i];
+        createdCount++;
+    }
+    
+    totalManagedBalance += createdBalance;
+    context->systemTotalBalanceCents.fetch_add(createdBalance.toCents(), std::memory_order_relaxed);
+    context->totalAccountsCreated.fetch_add(createdCount, std::memory_order_relaxed);
+    return accountNumbers;
+}
+
+int AccountManager::reserveAccountIds(int count) {
+    return accountCounter.fetch_add(count, std::memory_order_relaxed) + 1;
+}
+
+std::string AccountManager::createReservedAccount(int accountId, AccountType type, double initialBalance,
+                                                  std::uint32_t ownerId) {
+    Money balance;
+    if (!parseInitialBalance(initialBalance, balance)) {
+        return "";
+    }
+    
+    int& owned = ownerAccountCount(ownerId);
+    if (owned >= MAX_ACCOUNTS_PER_USER) {
         return "";
     }
     
-    if (accounts.size() >= MAX_ACCOUNTS_PER_USER) {
+    Account* inserted = insertNewAccount(accountId, type, balance, ownerId);
+    if (inserted == nullptr) {
         return "";
     }
+    owned++;
     
-    std::ostringstream oss;
-    oss << "ACC" << ++accountCounter;
-    std::string accountNumber = oss.str();
+    totalManagedBalance += balance;
+    context->systemTotalBalanceCents.fetch_add(balance.toCents(), std::memory_order_relaxed);
+    context->totalAccountsCreated.fetch_add(1, std::memory_order_relaxed);
     
-    Account newAccount{
-        accountNumber,
+    return inserted->accountNumber;
+}
+
+Account* AccountManager::insertNewAccount(int accountId, AccountType type, Money balance, std::uint32_t ownerId) {
+    // Ids held by the mapped snapshot are taken even while they are not in the overlay
+    if (mappedBook.isOpen() && mappedBook.find(accountId) != nullptr) {
+        return nullptr;
+    }
+    
+    Account* inserted = accounts.insert(accountId, Account{
+        AccountIndex::formatAccountNumber(accountId),
         type,
         AccountStatus::PENDING_VERIFICATION,
-        initialBalance,
-        0.0,
+        balance,
+        Money(),
         0,
         false,
-        false
-    };
-    
-    accounts[accountNumber] = newAccount;
-    totalManagedBalance += initialBalance;
-    g_systemTotalBalance += initialBalance;
-    g_totalAccountsCreated++;
-    
-    return accountNumber;
+        false,
+        ownerId
+    });
+    if (inserted != nullptr) {
+        reindexAccount(*inserted);
+        logMutation(AccountLogOperation::CREATE, *inserted);
+    }
+    return inserted;
+}
+
+int& AccountManager::ownerAccountCount(std::uint32_t ownerId) const {
+    if (ownerCountsStale) {
+        ownerAccountCounts.clear();
+        for (std::size_t i = 0; i < accounts.size(); ++i) {
+            ownerAccountCounts[accounts.entryAt(i).ownerId]++;
+        }
+        for (std::size_t i = 0; i < mappedBook.size(); ++i) {
+            const AccountLogRecord& image = mappedBook.recordAt(i);
+            if (accounts.find(image.accountId) == nullptr) {
+                ownerAccountCounts[image.ownerId]++;
+            }
+        }
+        ownerCountsStale = false;
+    }
+    return ownerAccountCounts[ownerId];
+}
+
+const AccountStatusIndex& AccountManager::currentStatusIndex() const {
+    if (statusIndexStale) {
+        statusIndex.clear();
+        statusIndex.reserve(static_cast<std::size_t>(getAccountCount()));
+        for (std::size_t i = 0; i < accounts.size(); ++i) {
+            const Account& account = accounts.entryAt(i);
+            int accountId = 0;
+            AccountIndex::parseAccountId(account.accountNumber, accountId);
+            statusIndex.update(accountId, account.status, account.hasFraudAlert, account.riskScore);
+        }
+        for (std::size_t i = 0; i < mappedBook.size(); ++i) {
+            const AccountLogRecord& image = mappedBook.recordAt(i);
+            if (accounts.find(image.accountId) == nullptr) {
+                statusIndex.update(image.accountId, static_cast<AccountStatus>(image.status),
+                                   (image.flags & AccountLogRecord::FRAUD_ALERT_FLAG) != 0, image.riskScore);
+            }
+        }
+        statusIndexStale = false;
+    }
+    return statusIndex;
+}
+
+void AccountManager::reindexAccount(const Account& account) {
+    // A stale index is rebuilt from the current fields anyway
+    if (statusIndexStale) {
+        return;
+    }
+    int accountId = 0;
+    AccountIndex::parseAccountId(account.accountNumber, accountId);
+    statusIndex.update(accountId, account.status, account.hasFraudAlert, account.riskScore);
+}
+
+void AccountManager::setStatus(Account& account, AccountStatus newStatus) {
+    // Only transitions count, so repeated suspensions and every way out of SUSPENDED keep the count exact
+    if (account.status != AccountStatus::SUSPENDED && newStatus == AccountStatus::SUSPENDED) {
+        suspendedAccountCount++;
+    } else if (account.status == AccountStatus::SUSPENDED && newStatus != AccountStatus::SUSPENDED) {
+        suspendedAccountCount--;
+    }
+    account.status = newStatus;
+    reindexAccount(account);
 }
 
 bool AccountManager::activateAccount(const std::string& accountNumber) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
         return false;
     }
     
-    Account& account = it->second;
+    Account& account = *found;
     
     if (account.status == AccountStatus::PENDING_VERIFICATION) {
         if (!account.isVerified) {
@@ -85,64 +472,176 @@ bool AccountManager::activateAccount(const std::string& accountNumber) {
         return false;
     }
     
-    account.status = AccountStatus::ACTIVE;
+    setStatus(account, AccountStatus::ACTIVE);
+    logMutation(AccountLogOperation::ACTIVATE, account);
     return true;
 }
 
 bool AccountManager::suspendAccount(const std::string& accountNumber, const std::string& reason) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
         return false;
     }
     
-    Account& account = it->second;
+    Account& account = *found;
     
     if (account.status == AccountStatus::CLOSED) {
         return false;
     }
     
-    account.status = AccountStatus::SUSPENDED;
-    suspendedAccountCount++;
+    setStatus(account, AccountStatus::SUSPENDED);
+    logMutation(AccountLogOperation::SUSPEND, account);
+    return true;
+}
+
+bool AccountManager::canAdjustBalance(const std::string& accountNumber, Money delta) {
+    const Account* found = findAccount(accountNumber);
+    Money adjusted;
+    return found != nullptr && found->status == AccountStatus::ACTIVE &&
+           Money::checkedAdd(found->balance, delta, adjusted) && (delta >= Money() || adjusted >= Money());
+}
+
+bool AccountManager::adjustBalance(const std::string& accountNumber, Money delta) {
+    if (!canAdjustBalance(accountNumber, delta)) {
+        return false;
+    }
+    
+    Account& account = *findAccount(accountNumber);
+    account.balance += delta;
+    totalManagedBalance += delta;
+    context->systemTotalBalanceCents.fetch_add(delta.toCents(), std::memory_order_relaxed);
+    logMutation(AccountLogOperation::ADJUST_BALANCE, account);
     return true;
 }
 
 bool AccountManager::deactivateAccount(const std::string& accountNumber) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
         return false;
     }
     
-    Account& account = it->second;
+    Account& account = *found;
     
     if (account.status == AccountStatus::CLOSED) {
         return false;
     }
     
-    if (account.balance > 0.0) {
+    if (account.balance > Money()) {
         return false;
     }
     
-    account.status = AccountStatus::CLOSED;
+    setStatus(account, AccountStatus::CLOSED);
+    logMutation(AccountLogOperation::DEACTIVATE, account);
     return true;
 }
 
 AccountStatus AccountManager::evaluateAccountRisk(const std::string& accountNumber, 
                                                   int transactionCount, 
                                                   double volumeLastDay) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
-        return AccountStatus::CLOSED;
+    const ScopedLatencyTimer timer(LatencyMetric::EVALUATE_ACCOUNT_RISK);
+    
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
+        return countedOutcome(AccountStatus::CLOSED);
     }
     
-    Account& account = it->second;
-    int riskScore = 0;
+    int accountId = 0;
+    AccountIndex::parseAccountId(accountNumber, accountId);
     
-    // Check if account is blacklisted using stub service (must be mocked in tests)
-    if (dataService != nullptr) {
-        // This is a stub function call - must be mocked in tests
-        std::vector<std::string> linkedAccounts = dataService->getLinkedAccounts(accountNumber);
+    // Linked accounts come from the stub service (must be mocked in tests) only when the cached ones are stale
+    const AccountLinkGraph::Clock::time_point now = AccountLinkGraph::Clock::now();
+    if (dataService != nullptr && !linkGraph.isFresh(accountId, now, linkCacheTtl)) {
+        std::vector<std::string> linkedAccounts = timedServiceCall(LatencyMetric::LINKED_ACCOUNTS, [&]() {
+            return dataService->getLinkedAccounts(accountNumber);
+        });
+        storeLinkedAccounts(accountId, linkedAccounts, now);
+    }
+    
+    return countedOutcome(applyRiskRules(*found, transactionCount, volumeLastDay, hasLinkedFraudAlert(accountId)));
+}
+
+std::future<AccountStatus> AccountManager::evaluateAccountRiskAsync(const std::string& accountNumber,
+                                                                    int transactionCount,
+                                                                    double volumeLastDay) {
+    if (asyncDataService == nullptr) {
+        AccountStatus status = evaluateAccountRisk(accountNumber, transactionCount, volumeLastDay);
+        std::promise<AccountStatus> ready;
+        ready.set_value(status);
+        return ready.get_future();
+    }
+    
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
+        std::promise<AccountStatus> ready;
+        ready.set_value(countedOutcome(AccountStatus::CLOSED));
+        return ready.get_future();
+    }
+    
+    int accountId = 0;
+    AccountIndex::parseAccountId(accountNumber, accountId);
+    if (linkGraph.isFresh(accountId, AccountLinkGraph::Clock::now(), linkCacheTtl)) {
+        std::promise<AccountStatus> ready;
+        ready.set_value(countedOutcome(applyRiskRules(*found, transactionCount, volumeLastDay,
+                                                      hasLinkedFraudAlert(accountId))));
+        return ready.get_future();
     }
     
+    // The rules run once the fetched links are cached, so the outcome matches evaluateAccountRisk
+    std::future<std::vector<std::string>> linkedAccounts = asyncDataService->getLinkedAccountsAsync(accountNumber);
+    return std::async(std::launch::deferred, [this, linkedAccounts = std::move(linkedAccounts), accountNumber,
+                                              accountId, transactionCount, volumeLastDay]() mutable {
+        linkedAccounts.wait();
+        try {
+            storeLinkedAccounts(accountId, linkedAccounts.get(), AccountLinkGraph::Clock::now());
+        } catch (...) {
+        }
+        Account* account = findAccount(accountNumber);
+        if (account == nullptr) {
+            return countedOutcome(AccountStatus::CLOSED);
+        }
+        return countedOutcome(applyRiskRules(*account, transactionCount, volumeLastDay,
+                                             hasLinkedFraudAlert(accountId)));
+    });
+}
+
+void AccountManager::storeLinkedAccounts(int accountId, const std::vector<std::string>& linkedAccounts,
+                                         AccountLinkGraph::Clock::time_point fetchedAt) {
+    std::vector<int> linkedIds;
+    linkedIds.reserve(linkedAccounts.size());
+    for (const std::string& linkedAccount : linkedAccounts) {
+        int linkedId = 0;
+        if (AccountIndex::parseAccountId(linkedAccount, linkedId) && linkedId != accountId) {
+            linkedIds.push_back(linkedId);
+        }
+    }
+    linkGraph.setLinks(accountId, linkedIds, fetchedAt);
+}
+
+bool AccountManager::hasFraudAlert(int accountId) const {
+    const Account* found = accounts.find(accountId);
+    if (found != nullptr) {
+        return found->hasFraudAlert;
+    }
+    const AccountLogRecord* image = mappedBook.isOpen() ? mappedBook.find(accountId) : nullptr;
+    return image != nullptr && (image->flags & AccountLogRecord::FRAUD_ALERT_FLAG) != 0;
+}
+
+bool AccountManager::hasLinkedFraudAlert(int accountId) const {
+    const int* links = nullptr;
+    std::size_t count = 0;
+    linkGraph.findLinks(accountId, links, count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (hasFraudAlert(links[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+AccountStatus AccountManager::applyRiskRules(Account& account, int transactionCount, double volumeLastDay,
+                                             bool linkedFraudAlert) {
+    int riskScore = 0;
+    
     // MCDC Condition 1: Transaction frequency check
     if (transactionCount > 100) {
         riskScore += 30;
@@ -170,28 +669,77 @@ AccountStatus AccountManager::evaluateAccountRisk(const std::string& accountNumb
         riskScore += 25;
     }
     
+    // Fraud alerts propagate one hop across the cached account links
+    if (linkedFraudAlert) {
+        riskScore += LINKED_FRAUD_ALERT_RISK;
+    }
+    
     // MCDC Condition 4: Combined thresholds
-    if (riskScore >= HIGH_RISK_THRESHOLD && g_complianceAuditMode) {
-        account.status = AccountStatus::FROZEN;
-        return AccountStatus::FROZEN;
+    AccountStatus evaluated = AccountStatus::ACTIVE;
+    if (riskScore >= HIGH_RISK_THRESHOLD && context->complianceAuditMode.load(std::memory_order_relaxed)) {
+        evaluated = AccountStatus::FROZEN;
     } else if (riskScore >= HIGH_RISK_THRESHOLD) {
-        account.status = AccountStatus::SUSPENDED;
-        suspendedAccountCount++;
-        return AccountStatus::SUSPENDED;
+        evaluated = AccountStatus::SUSPENDED;
     } else if (riskScore > 50) {
-        return AccountStatus::PENDING_VERIFICATION;
+        evaluated = AccountStatus::PENDING_VERIFICATION;
     }
     
-    return AccountStatus::ACTIVE;
+    storeRiskEvaluation(account, riskScore, evaluated);
+    return evaluated;
+}
+
+void AccountManager::storeRiskEvaluation(Account& account, int riskScore, AccountStatus evaluated) {
+    const bool scoreChanged = account.riskScore != riskScore;
+    account.riskScore = riskScore;
+    
+    // Only high-risk outcomes change the stored status
+    if (evaluated == AccountStatus::FROZEN || evaluated == AccountStatus::SUSPENDED) {
+        setStatus(account, evaluated);
+    } else if (scoreChanged) {
+        reindexAccount(account);
+    } else {
+        return;
+    }
+    logMutation(AccountLogOperation::EVALUATE_RISK, account);
+}
+
+void AccountManager::evaluateAllAccountsRisk(const int* txnCounts, const double* volumes, AccountStatus* results) {
+    materializeAll();
+    riskColumns.load(accounts);
+    
+    // Every account is in the overlay now, so the links resolve through the index alone
+    linkedFraudAlerts.assign(riskColumns.size(), 0);
+    if (linkGraph.size() != 0) {
+        for (std::size_t i = 0; i < riskColumns.size(); ++i) {
+            int accountId = 0;
+            AccountIndex::parseAccountId(accounts.entryAt(i).accountNumber, accountId);
+            linkedFraudAlerts[i] = hasLinkedFraudAlert(accountId) ? 1 : 0;
+        }
+    }
+    riskColumns.evaluateRisk(txnCounts, volumes, HIGH_RISK_THRESHOLD,
+                             context->complianceAuditMode.load(std::memory_order_relaxed),
+                             linkedFraudAlerts.data(), LINKED_FRAUD_ALERT_RISK);
+    
+    const std::int32_t* scores = riskColumns.getEvaluatedScore();
+    const std::uint8_t* evaluated = riskColumns.getEvaluatedStatus();
+    if (results != nullptr) {
+        for (std::size_t i = 0; i < riskColumns.size(); ++i) {
+            results[i] = static_cast<AccountStatus>(evaluated[i]);
+        }
+    }
+    // Accounts whose score is unchanged and whose outcome is not high risk are left untouched
+    for (std::size_t row : riskColumns.getChangedRows()) {
+        storeRiskEvaluation(accounts.entryAt(row), scores[row], static_cast<AccountStatus>(evaluated[row]));
+    }
 }
 
 bool AccountManager::updateAccountStatus(const std::string& accountNumber, AccountStatus newStatus) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
         return false;
     }
     
-    Account& account = it->second;
+    Account& account = *found;
     
     // MCDC Condition 5: Status transition rules
     if (account.status == AccountStatus::CLOSED && newStatus != AccountStatus::CLOSED) {
@@ -206,64 +754,181 @@ bool AccountManager::updateAccountStatus(const std::string& accountNumber, Accou
         }
     }
     
-    if (account.status == AccountStatus::SUSPENDED && newStatus == AccountStatus::ACTIVE) {
-        suspendedAccountCount--;
-    } else if (account.status != AccountStatus::SUSPENDED && newStatus == AccountStatus::SUSPENDED) {
-        suspendedAccountCount++;
-    }
-    
-    account.status = newStatus;
+    setStatus(account, newStatus);
+    logMutation(AccountLogOperation::UPDATE_STATUS, account);
     return true;
 }
 
 Account* AccountManager::getAccount(const std::string& accountNumber) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    return findAccount(accountNumber);
+}
+
+Account* AccountManager::getAccountAt(std::size_t position) {
+    materializeAll();
+    if (position >= accounts.size()) {
         return nullptr;
     }
-    return &it->second;
+    return &accounts.entryAt(position);
 }
 
 bool AccountManager::verifyAccount(const std::string& accountNumber, bool verificationResult) {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
+    const ScopedLatencyTimer timer(LatencyMetric::VERIFY_ACCOUNT);
+    
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
         return false;
     }
     
-    Account& account = it->second;
+    Account& account = *found;
     account.isVerified = verificationResult;
     
     // Call stub/mock functions from ExternalServices
     // These functions are declared but not implemented - test framework must provide mocks
     if (dataService != nullptr) {
         // This is a stub function call - must be mocked in tests
-        std::string identityStatus = dataService->getIdentityVerificationStatus(accountNumber);
-        std::string creditScore = dataService->getCreditScore(accountNumber);
+        std::string identityStatus = timedServiceCall(LatencyMetric::IDENTITY_STATUS, [&]() {
+            return dataService->getIdentityVerificationStatus(accountNumber);
+        });
+        std::string creditScore = timedServiceCall(LatencyMetric::CREDIT_SCORE, [&]() {
+            return dataService->getCreditScore(accountNumber);
+        });
     }
     
-    if (notificationService != nullptr && verificationResult) {
-        // Another stub function call - requires mock implementation
-        notificationService->sendEmailNotification("user@example.com",
-                                                  "Account Verified",
-                                                  "Your account has been verified successfully.");
+    if (verificationResult) {
+        sendVerifiedEmail();
+    }
+    
+    return applyVerificationResult(account, verificationResult);
+}
+
+std::future<bool> AccountManager::verifyAccountAsync(const std::string& accountNumber, bool verificationResult) {
+    if (asyncDataService == nullptr) {
+        bool result = verifyAccount(accountNumber, verificationResult);
+        std::promise<bool> ready;
+        ready.set_value(result);
+        return ready.get_future();
+    }
+    
+    Account* found = findAccount(accountNumber);
+    if (found == nullptr) {
+        std::promise<bool> ready;
+        ready.set_value(false);
+        return ready.get_future();
     }
     
+    Account& account = *found;
+    account.isVerified = verificationResult;
+    
+    // Both lookups are issued before waiting on either
+    std::future<std::string> identityStatus = asyncDataService->getIdentityVerificationStatusAsync(accountNumber);
+    std::future<std::string> creditScore = asyncDataService->getCreditScoreAsync(accountNumber);
+    
+    if (verificationResult) {
+        sendVerifiedEmail();
+    }
+    
+    bool result = applyVerificationResult(account, verificationResult);
+    return std::async(std::launch::deferred,
+                      [identityStatus = std::move(identityStatus), creditScore = std::move(creditScore), result]() mutable {
+        identityStatus.wait();
+        creditScore.wait();
+        return result;
+    });
+}
+
+void AccountManager::sendVerifiedEmail() {
+    // Accounts carry no contact address, so every notification goes to the customer mailbox
+    static const std::string recipient = "user@example.com";
+    if (asyncNotificationService != nullptr) {
+        asyncNotificationService->sendTemplateNotificationAsync(recipient, NotificationTemplate::ACCOUNT_VERIFIED);
+    } else if (notificationService != nullptr) {
+        // Another stub function call - requires mock implementation
+        const NotificationTemplateText text = notificationTemplateText(NotificationTemplate::ACCOUNT_VERIFIED);
+        timedServiceCall(LatencyMetric::EMAIL_NOTIFICATION, [&]() {
+            return notificationService->sendEmailNotification(recipient, std::string(text.subject),
+                                                              std::string(text.body));
+        });
+    }
+}
+
+bool AccountManager::applyVerificationResult(Account& account, bool verificationResult) {
+    bool activated = false;
     if (verificationResult && account.status == AccountStatus::PENDING_VERIFICATION) {
-        account.status = AccountStatus::ACTIVE;
-        return true;
+        setStatus(account, AccountStatus::ACTIVE);
+        activated = true;
     }
     
-    return false;
+    // isVerified was updated by the caller even when the status stays the same
+    logMutation(AccountLogOperation::VERIFY, account);
+    return activated;
 }
 
 double AccountManager::getAccountBalance(const std::string& accountNumber) const {
-    auto it = accounts.find(accountNumber);
-    if (it == accounts.end()) {
-        return -1.0;
+    const Account* found = accounts.find(accountNumber);
+    if (found != nullptr) {
+        return found->balance.toDouble();
     }
-    return it->second.balance;
+    
+    // Unmodified accounts are read straight from the mapped snapshot
+    const AccountLogRecord* image = mappedBook.isOpen() ? mappedBook.find(accountNumber) : nullptr;
+    return image != nullptr ? image->balance.toDouble() : -1.0;
 }
 
 int AccountManager::getSuspendedAccountCount() const {
     return suspendedAccountCount;
 }
+
+std::vector<std::string> AccountManager::toAccountNumbers(const std::vector<int>& accountIds) {
+    std::vector<std::string> accountNumbers;
+    accountNumbers.reserve(accountIds.size());
+    for (int accountId : accountIds) {
+        accountNumbers.push_back(AccountIndex::formatAccountNumber(accountId));
+    }
+    return accountNumbers;
+}
+
+std::vector<std::string> AccountManager::getAccountsByStatus(AccountStatus status) const {
+    std::vector<int> accountIds;
+    currentStatusIndex().collectWithStatus(status, accountIds);
+    return toAccountNumbers(accountIds);
+}
+
+std::vector<std::string> AccountManager::getAccountsByStatus(AccountStatus status, bool hasFraudAlert) const {
+    std::vector<int> accountIds;
+    currentStatusIndex().collectWithStatus(status, hasFraudAlert, accountIds);
+    return toAccountNumbers(accountIds);
+}
+
+int AccountManager::getAccountCountByStatus(AccountStatus status) const {
+    return static_cast<int>(currentStatusIndex().countWithStatus(status));
+}
+
+std::vector<std::string> AccountManager::getAccountsWithRiskAtLeast(int minimumScore) const {
+    std::vector<int> accountIds;
+    currentStatusIndex().collectWithRiskAtLeast(minimumScore, accountIds);
+    return toAccountNumbers(accountIds);
+}
+
+std::vector<std::string> AccountManager::getHighRiskAccounts() const {
+    return getAccountsWithRiskAtLeast(HIGH_RISK_THRESHOLD);
+}
+
+double AccountManager::getTotalManagedBalance() const {
+    return totalManagedBalance.toDouble();
+}
+
+AllocationStats AccountManager::getAllocationStats() const {
+    return accountMemory.getStats();
+}
+
+int AccountManager::getAccountCount() const {
+    return static_cast<int>(accounts.size() + mappedBook.size() - materializedCount);
+}
+
+int AccountManager::getOwnerAccountCount(std::uint32_t ownerId) const {
+    return ownerAccountCount(ownerId);
+}
+
+int AccountManager::getMaxAccountsPerUser() {
+    return MAX_ACCOUNTS_PER_USER;
+}
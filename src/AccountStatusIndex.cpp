@@ -0,0 +1,117 @@
+#include "AccountStatusIndex.hpp"
+
+const std::size_t AccountStatusIndex::STATUS_COUNT;
+const std::size_t AccountStatusIndex::STATUS_LIST_COUNT;
+const int AccountStatusIndex::RISK_BUCKET_WIDTH;
+const std::size_t AccountStatusIndex::RISK_BUCKET_COUNT;
+
+AccountStatusIndex::AccountStatusIndex(std::pmr::memory_resource* resource)
+    : nodes(resource), nodeOf(resource), statusMembers(STATUS_LIST_COUNT, resource),
+      riskMembers(RISK_BUCKET_COUNT, resource) {
+}
+
+std::uint8_t AccountStatusIndex::statusListOf(AccountStatus status, bool hasFraudAlert) {
+    return static_cast<std::uint8_t>(static_cast<std::size_t>(status) * 2 + (hasFraudAlert ? 1 : 0));
+}
+
+std::size_t AccountStatusIndex::riskBucketOf(int riskScore) {
+    if (riskScore <= 0) {
+        return 0;
+    }
+    const std::size_t bucket = static_cast<std::size_t>(riskScore / RISK_BUCKET_WIDTH);
+    return bucket < RISK_BUCKET_COUNT ? bucket : RISK_BUCKET_COUNT - 1;
+}
+
+void AccountStatusIndex::unlink(std::pmr::vector<std::uint32_t>& members, std::uint32_t slot, bool riskList) {
+    const std::uint32_t moved = members.back();
+    members[slot] = moved;
+    if (riskList) {
+        nodes[moved].riskSlot = slot;
+    } else {
+        nodes[moved].statusSlot = slot;
+    }
+    members.pop_back();
+}
+
+void AccountStatusIndex::update(int accountId, AccountStatus status, bool hasFraudAlert, int riskScore) {
+    const std::uint8_t list = statusListOf(status, hasFraudAlert);
+    const std::uint8_t bucket = static_cast<std::uint8_t>(riskBucketOf(riskScore));
+
+    const auto inserted = nodeOf.try_emplace(accountId, static_cast<std::uint32_t>(nodes.size()));
+    const std::uint32_t position = inserted.first->second;
+    if (inserted.second) {
+        nodes.push_back(Node{accountId, riskScore, static_cast<std::uint32_t>(statusMembers[list].size()),
+                             static_cast<std::uint32_t>(riskMembers[bucket].size()), list, bucket});
+        statusMembers[list].push_back(position);
+        riskMembers[bucket].push_back(position);
+        return;
+    }
+
+    Node& node = nodes[position];
+    node.riskScore = riskScore;
+    if (node.statusList != list) {
+        unlink(statusMembers[node.statusList], node.statusSlot, false);
+        node.statusList = list;
+        node.statusSlot = static_cast<std::uint32_t>(statusMembers[list].size());
+        statusMembers[list].push_back(position);
+    }
+    if (node.riskBucket != bucket) {
+        unlink(riskMembers[node.riskBucket], node.riskSlot, true);
+        node.riskBucket = bucket;
+        node.riskSlot = static_cast<std::uint32_t>(riskMembers[bucket].size());
+        riskMembers[bucket].push_back(position);
+    }
+}
+
+void AccountStatusIndex::reserve(std::size_t accountCount) {
+    nodes.reserve(accountCount);
+    nodeOf.reserve(accountCount);
+}
+
+void AccountStatusIndex::clear() {
+    nodes.clear();
+    nodeOf.clear();
+    for (std::pmr::vector<std::uint32_t>& members : statusMembers) {
+        members.clear();
+    }
+    for (std::pmr::vector<std::uint32_t>& members : riskMembers) {
+        members.clear();
+    }
+}
+
+std::size_t AccountStatusIndex::size() const {
+    return nodes.size();
+}
+
+std::size_t AccountStatusIndex::countWithStatus(AccountStatus status) const {
+    return statusMembers[statusListOf(status, false)].size() + statusMembers[statusListOf(status, true)].size();
+}
+
+void AccountStatusIndex::collectWithStatus(AccountStatus status, std::vector<int>& accountIds) const {
+    accountIds.reserve(accountIds.size() + countWithStatus(status));
+    collectWithStatus(status, false, accountIds);
+    collectWithStatus(status, true, accountIds);
+}
+
+void AccountStatusIndex::collectWithStatus(AccountStatus status, bool hasFraudAlert,
+                                           std::vector<int>& accountIds) const {
+    const std::pmr::vector<std::uint32_t>& members = statusMembers[statusListOf(status, hasFraudAlert)];
+    accountIds.reserve(accountIds.size() + members.size());
+    for (std::uint32_t position : members) {
+        accountIds.push_back(nodes[position].accountId);
+    }
+}
+
+void AccountStatusIndex::collectWithRiskAtLeast(int minimumScore, std::vector<int>& accountIds) const {
+    const std::size_t first = riskBucketOf(minimumScore);
+    for (std::uint32_t position : riskMembers[first]) {
+        if (nodes[position].riskScore >= minimumScore) {
+            accountIds.push_back(nodes[position].accountId);
+        }
+    }
+    for (std::size_t bucket = first + 1; bucket < RISK_BUCKET_COUNT; ++bucket) {
+        for (std::uint32_t position : riskMembers[bucket]) {
+            accountIds.push_back(nodes[position].accountId);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+#include "AccountSymbolTable.hpp"
+#include <cstring>
+
+// Static member initialization
+const std::uint32_t AccountSymbolTable::EMPTY_SLOT = 0xFFFFFFFFu;
+const AccountSymbol AccountSymbolTable::EMPTY_ACCOUNT = 0;
+const AccountSymbol AccountSymbolTable::NO_SYMBOL = 0xFFFFFFFFu;
+
+namespace {
+
+const std::size_t INITIAL_SLOT_COUNT = 64;
+const std::size_t ARENA_CHUNK_SIZE = 64 * 1024;
+
+} // namespace
+
+AccountSymbolTable::AccountSymbolTable()
+    : slots(INITIAL_SLOT_COUNT, Slot{0, EMPTY_SLOT}), slotMask(INITIAL_SLOT_COUNT - 1),
+      names(1, std::string_view()), chunkUsed(0), chunkSize(0) {
+}
+
+std::uint64_t AccountSymbolTable::hashName(std::string_view accountNumber) {
+    // FNV-1a: account numbers are short, so a byte loop beats anything fancier
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (char character : accountNumber) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+AccountSymbol AccountSymbolTable::probe(std::string_view accountNumber, std::uint64_t hash,
+                                        std::size_t& position) const {
+    const std::uint32_t tag = static_cast<std::uint32_t>(hash >> 32);
+    for (position = static_cast<std::size_t>(hash) & slotMask; ; position = (position + 1) & slotMask) {
+        const Slot& slot = slots[position];
+        if (slot.symbol == EMPTY_SLOT) {
+            return NO_SYMBOL;
+        }
+        if (slot.hashTag == tag && names[slot.symbol] == accountNumber) {
+            return slot.symbol;
+        }
+    }
+}
+
+AccountSymbol AccountSymbolTable::find(std::string_view accountNumber) const {
+    if (accountNumber.empty()) {
+        return EMPTY_ACCOUNT;
+    }
+    std::size_t position = 0;
+    return probe(accountNumber, hashName(accountNumber), position);
+}
+
+AccountSymbol AccountSymbolTable::intern(std::string_view accountNumber) {
+    if (accountNumber.empty()) {
+        return EMPTY_ACCOUNT;
+    }
+
+    const std::uint64_t hash = hashName(accountNumber);
+    std::size_t position = 0;
+    AccountSymbol symbol = probe(accountNumber, hash, position);
+    if (symbol != NO_SYMBOL) {
+        return symbol;
+    }
+
+    if ((names.size() + 1) * 2 > slots.size()) {
+        rehash(slots.size() * 2);
+        probe(accountNumber, hash, position);
+    }
+
+    symbol = static_cast<AccountSymbol>(names.size());
+    names.push_back(store(accountNumber));
+    slots[position] = Slot{static_cast<std::uint32_t>(hash >> 32), symbol};
+    return symbol;
+}
+
+std::string_view AccountSymbolTable::store(std::string_view accountNumber) {
+    const std::size_t length = accountNumber.size();
+    if (chunkUsed + length > chunkSize) {
+        chunkSize = length > ARENA_CHUNK_SIZE ? length : ARENA_CHUNK_SIZE;
+        chunks.emplace_back(new char[chunkSize]);
+        chunkUsed = 0;
+    }
+
+    char* destination = chunks.back().get() + chunkUsed;
+    std::memcpy(destination, accountNumber.data(), length);
+    chunkUsed += length;
+    return std::string_view(destination, length);
+}
+
+void AccountSymbolTable::rehash(std::size_t slotCount) {
+    std::vector<Slot> rebuilt(slotCount, Slot{0, EMPTY_SLOT});
+    const std::size_t mask = slotCount - 1;
+    for (const Slot& slot : slots) {
+        if (slot.symbol == EMPTY_SLOT) {
+            continue;
+        }
+        std::size_t position = static_cast<std::size_t>(hashName(names[slot.symbol])) & mask;
+        while (rebuilt[position].symbol != EMPTY_SLOT) {
+            position = (position + 1) & mask;
+        }
+        rebuilt[position] = slot;
+    }
+    slots.swap(rebuilt);
+    slotMask = mask;
+}
+
+std::string_view AccountSymbolTable::name(AccountSymbol symbol) const {
+    if (symbol >= names.size()) {
+        return std::string_view();
+    }
+    return names[symbol];
+}
+
+std::size_t AccountSymbolTable::size() const {
+    return names.size();
+}
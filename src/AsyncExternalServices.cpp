@@ -0,0 +1,57 @@
+#include "AsyncExternalServices.hpp"
+#include "Instrumentation.hpp"
+
+ExecutorExternalDataService::ExecutorExternalDataService(ExternalDataService& service, ServiceCallExecutor& executor)
+    : service(service), executor(executor) {
+}
+
+ExecutorExternalDataService::~ExecutorExternalDataService() {
+    executor.drain();
+}
+
+std::future<std::string> ExecutorExternalDataService::getCreditScoreAsync(const std::string& accountNumber) {
+    return executor.submit([this, accountNumber]() {
+        return timedServiceCall(LatencyMetric::CREDIT_SCORE, [&]() { return service.getCreditScore(accountNumber); });
+    });
+}
+
+std::future<std::string> ExecutorExternalDataService::getIdentityVerificationStatusAsync(const std::string& accountNumber) {
+    return executor.submit([this, accountNumber]() {
+        return timedServiceCall(LatencyMetric::IDENTITY_STATUS,
+                                [&]() { return service.getIdentityVerificationStatus(accountNumber); });
+    });
+}
+
+std::future<std::vector<std::string>> ExecutorExternalDataService::getLinkedAccountsAsync(const std::string& primaryAccount) {
+    return executor.submit([this, primaryAccount]() {
+        return timedServiceCall(LatencyMetric::LINKED_ACCOUNTS, [&]() { return service.getLinkedAccounts(primaryAccount); });
+    });
+}
+
+ExecutorNotificationService::ExecutorNotificationService(NotificationService& service, ServiceCallExecutor& executor)
+    : service(service), executor(executor), failedCount(0) {
+}
+
+ExecutorNotificationService::~ExecutorNotificationService() {
+    executor.drain();
+}
+
+void ExecutorNotificationService::sendEmailNotificationAsync(const std::string& email,
+                                                             const std::string& subject,
+                                                             const std::string& body) {
+    executor.post([this, email, subject, body]() {
+        bool sent = false;
+        try {
+            sent = timedServiceCall(LatencyMetric::EMAIL_NOTIFICATION,
+                                    [&]() { return service.sendEmailNotification(email, subject, body); });
+        } catch (...) {
+        }
+        if (!sent) {
+            failedCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+std::size_t ExecutorNotificationService::getFailedCount() const {
+    return failedCount.load(std::memory_order_relaxed);
+}
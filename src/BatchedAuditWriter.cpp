@@ -0,0 +1,226 @@
+#include "BatchedAuditWriter.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <string_view>
+
+namespace {
+
+// Each entry owns three formatted fields of AUDIT_FIELD_SIZE bytes in the text buffer
+const std::size_t AUDIT_FIELD_SIZE = BatchedAuditWriter::ENTRY_TEXT_SIZE / 3;
+
+// A producer that has buffered this many batches writes them itself instead of waiting for the flush thread
+const std::size_t MAX_BUFFERED_BATCHES = 4;
+
+std::size_t clampAuditLength(int length) {
+    if (length < 0) {
+        return 0;
+    }
+    return static_cast<std::size_t>(length) < AUDIT_FIELD_SIZE ? static_cast<std::size_t>(length) : AUDIT_FIELD_SIZE - 1;
+}
+
+std::atomic<std::uint64_t> nextInstanceId(1);
+
+/// @brief Last writer and buffer the calling thread submitted to.
+struct BufferCache {
+    std::uint64_t instanceId;
+    void* buffer;
+};
+
+thread_local BufferCache bufferCache{0, nullptr};
+
+} // namespace
+
+const std::size_t BatchedAuditWriter::DEFAULT_BATCH_SIZE;
+const int BatchedAuditWriter::DEFAULT_FLUSH_INTERVAL_MS;
+const std::size_t BatchedAuditWriter::ENTRY_TEXT_SIZE;
+
+BatchedAuditWriter::BatchedAuditWriter(AuditLoggingService& service, std::size_t batchSize,
+                                       std::chrono::milliseconds flushInterval)
+    : service(service), batchSize(batchSize == 0 ? 1 : batchSize), flushInterval(flushInterval),
+      instanceId(nextInstanceId.fetch_add(1, std::memory_order_relaxed)),
+      flushPending(false), stopRequested(false),
+      submittedCount(0), writtenCount(0), failedCount(0), batchCount(0), durableCount(0) {
+    flusher = std::thread(&BatchedAuditWriter::flushLoop, this);
+}
+
+BatchedAuditWriter::~BatchedAuditWriter() {
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        stopRequested = true;
+    }
+    flushRequested.notify_one();
+    flusher.join();
+    flush();
+}
+
+BatchedAuditWriter::ThreadBuffer& BatchedAuditWriter::localBuffer() {
+    if (bufferCache.instanceId == instanceId) {
+        return *static_cast<ThreadBuffer*>(bufferCache.buffer);
+    }
+
+    // A thread alternating between writers finds its buffer again instead of creating another one
+    const std::thread::id self = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(registryMutex);
+    ThreadBuffer* found = nullptr;
+    for (const std::unique_ptr<ThreadBuffer>& buffer : buffers) {
+        if (buffer->owner == self) {
+            found = buffer.get();
+            break;
+        }
+    }
+    if (found == nullptr) {
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        found = buffers.back().get();
+        found->owner = self;
+        found->records.reserve(batchSize);
+    }
+    bufferCache = BufferCache{instanceId, found};
+    return *found;
+}
+
+bool BatchedAuditWriter::submit(const AuditRecord& record, std::string_view sourceAccount,
+                                AuditDurability durability) {
+    ThreadBuffer& buffer = localBuffer();
+    std::size_t buffered = 0;
+    {
+        std::lock_guard<std::mutex> lock(buffer.mutex);
+        buffer.records.push_back(BufferedRecord{record, buffer.accounts.size(), sourceAccount.size()});
+        buffer.accounts.append(sourceAccount.data(), sourceAccount.size());
+        buffered = buffer.records.size();
+    }
+    submittedCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (durability == AuditDurability::DURABLE) {
+        durableCount.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(writeMutex);
+        takeRecords(buffer);
+        return writePending();
+    }
+
+    if (buffered >= MAX_BUFFERED_BATCHES * batchSize) {
+        // The flush thread is falling behind; audit records are never dropped, so this thread writes its own
+        std::lock_guard<std::mutex> lock(writeMutex);
+        takeRecords(buffer);
+        writePending();
+    } else if (buffered >= batchSize) {
+        requestFlush();
+    }
+    return true;
+}
+
+bool BatchedAuditWriter::flush() {
+    std::lock_guard<std::mutex> lock(writeMutex);
+    {
+        std::lock_guard<std::mutex> registryLock(registryMutex);
+        for (const std::unique_ptr<ThreadBuffer>& buffer : buffers) {
+            takeRecords(*buffer);
+        }
+    }
+    return writePending();
+}
+
+void BatchedAuditWriter::takeRecords(ThreadBuffer& buffer) {
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    if (buffer.records.empty()) {
+        return;
+    }
+    if (pending.empty()) {
+        // Hand the producer the emptied scratch so that neither side allocates in steady state
+        pending.swap(buffer.records);
+        pendingAccounts.swap(buffer.accounts);
+    } else {
+        // Appended account text moves by the text already pending
+        const std::size_t base = pendingAccounts.size();
+        for (const BufferedRecord& buffered : buffer.records) {
+            pending.push_back(BufferedRecord{buffered.record, base + buffered.accountOffset, buffered.accountLength});
+        }
+        pendingAccounts.append(buffer.accounts);
+        buffer.records.clear();
+        buffer.accounts.clear();
+    }
+}
+
+bool BatchedAuditWriter::writePending() {
+    if (pending.empty()) {
+        return true;
+    }
+
+    // Formatted here, off the producers' path; the text is sized once so that the views stay put
+    if (text.size() < pending.size() * ENTRY_TEXT_SIZE) {
+        text.resize(pending.size() * ENTRY_TEXT_SIZE);
+    }
+    bool allWritten = true;
+    for (std::size_t first = 0; first < pending.size(); first += batchSize) {
+        const std::size_t count = std::min(batchSize, pending.size() - first);
+        entries.clear();
+        for (std::size_t i = first; i < first + count; ++i) {
+            const std::string_view account(pendingAccounts.data() + pending[i].accountOffset, pending[i].accountLength);
+            entries.push_back(formatEntry(pending[i].record, account, &text[i * ENTRY_TEXT_SIZE]));
+        }
+
+        bool written = false;
+        try {
+            written = timedServiceCall(LatencyMetric::AUDIT_LOG, [&]() { return service.logTransactionBatch(entries); });
+        } catch (...) {
+        }
+        batchCount.fetch_add(1, std::memory_order_relaxed);
+        (written ? writtenCount : failedCount).fetch_add(count, std::memory_order_relaxed);
+        allWritten = allWritten && written;
+    }
+    pending.clear();
+    pendingAccounts.clear();
+    return allWritten;
+}
+
+void BatchedAuditWriter::requestFlush() {
+    {
+        std::lock_guard<std::mutex> lock(flushMutex);
+        flushPending = true;
+    }
+    flushRequested.notify_one();
+}
+
+void BatchedAuditWriter::flushLoop() {
+    std::unique_lock<std::mutex> lock(flushMutex);
+    while (!stopRequested) {
+        flushRequested.wait_for(lock, flushInterval, [this]() { return flushPending || stopRequested; });
+        flushPending = false;
+        lock.unlock();
+        flush();
+        lock.lock();
+    }
+}
+
+BatchedAuditWriterStats BatchedAuditWriter::getStats() const {
+    BatchedAuditWriterStats stats{};
+    stats.submittedCount = submittedCount.load(std::memory_order_relaxed);
+    stats.writtenCount = writtenCount.load(std::memory_order_relaxed);
+    stats.failedCount = failedCount.load(std::memory_order_relaxed);
+    stats.batchCount = batchCount.load(std::memory_order_relaxed);
+    stats.durableCount = durableCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+AuditEntry BatchedAuditWriter::formatEntry(const AuditRecord& record, std::string_view sourceAccount, char* text) {
+    // Same text std::to_string produced, formatted into the caller's buffer instead of temporaries
+    char* amountText = text;
+    int amountLength = std::snprintf(amountText, AUDIT_FIELD_SIZE, "%f", record.amount.toDouble());
+    char* timestampText = amountText + AUDIT_FIELD_SIZE;
+    int timestampLength = std::snprintf(timestampText, AUDIT_FIELD_SIZE, "%lld",
+                                        static_cast<long long>(record.loggedAt));
+    char* detailsText = timestampText + AUDIT_FIELD_SIZE;
+    int detailsLength = std::snprintf(detailsText, AUDIT_FIELD_SIZE, "Transaction: %d", record.transactionId);
+
+    return AuditEntry{
+        sourceAccount,
+        std::string_view(amountText, clampAuditLength(amountLength)),
+        std::string_view(timestampText, clampAuditLength(timestampLength)),
+        "TRANSACTION_PROCESSED",
+        std::string_view(detailsText, clampAuditLength(detailsLength))
+    };
+}
+
+AuditRecord BatchedAuditWriter::makeRecord(const Transaction& transaction, std::time_t loggedAt) {
+    return AuditRecord{transaction.id, transaction.type, transaction.status, transaction.amount, loggedAt};
+}
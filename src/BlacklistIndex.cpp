@@ -0,0 +1,199 @@
+#include "BlacklistIndex.hpp"
+#include "ExternalServices.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+// Odd multipliers picking one bit per filter word, as in the split block Bloom filter
+const std::uint32_t BLOCK_SALTS[8] = {
+    0x47B6137BU, 0x44974D91U, 0x8824AD5BU, 0xA2B7289DU,
+    0x705495C7U, 0x2DF1424BU, 0x9EFC4947U, 0x5C6BFB31U
+};
+
+const std::size_t BITS_PER_BLOCK = 256;
+
+bool lessThan(const std::string& id, std::string_view accountNumber) {
+    return std::string_view(id) < accountNumber;
+}
+
+} // namespace
+
+BlacklistIndex::BlacklistIndex(std::size_t bitsPerKey)
+    : bitsPerKey(bitsPerKey == 0 ? 1 : bitsPerKey), refreshCount(0), rebuildCount(0), stopRequested(false) {
+}
+
+BlacklistIndex::~BlacklistIndex() {
+    stopBackgroundRefresh();
+}
+
+std::uint64_t BlacklistIndex::hashId(std::string_view accountNumber) {
+    // FNV-1a followed by a 64-bit finalizer, so the block and bit selectors are independent
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (char character : accountNumber) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 0x100000001B3ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+void BlacklistIndex::insertHash(std::vector<Block>& blocks, std::uint64_t hash) {
+    const std::size_t index = static_cast<std::size_t>(((hash >> 32) * blocks.size()) >> 32);
+    const std::uint32_t key = static_cast<std::uint32_t>(hash);
+    for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+        blocks[index].words[i] |= 1U << ((key * BLOCK_SALTS[i]) >> 27);
+    }
+}
+
+bool BlacklistIndex::testHash(const std::vector<Block>& blocks, std::uint64_t hash) {
+    const std::size_t index = static_cast<std::size_t>(((hash >> 32) * blocks.size()) >> 32);
+    const std::uint32_t key = static_cast<std::uint32_t>(hash);
+    for (std::size_t i = 0; i < WORDS_PER_BLOCK; ++i) {
+        if ((blocks[index].words[i] & (1U << ((key * BLOCK_SALTS[i]) >> 27))) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const BlacklistIndex::Snapshot> BlacklistIndex::buildSnapshot(std::vector<std::string> ids) const {
+    auto built = std::make_shared<Snapshot>();
+    // A quarter of headroom lets later additions reuse the filter instead of rebuilding it
+    built->capacity = ids.size() + ids.size() / 4 + 64;
+    const std::size_t blockCount = (built->capacity * bitsPerKey + BITS_PER_BLOCK - 1) / BITS_PER_BLOCK;
+    built->blocks.assign(blockCount, Block{});
+    for (const std::string& id : ids) {
+        insertHash(built->blocks, hashId(id));
+    }
+    built->ids = std::move(ids);
+    return built;
+}
+
+void BlacklistIndex::load(std::vector<std::string> ids) {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    ids.shrink_to_fit();
+
+    std::lock_guard<std::mutex> refreshLock(refreshMutex);
+    std::shared_ptr<const Snapshot> current;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        current = snapshot;
+    }
+
+    std::shared_ptr<const Snapshot> next;
+    if (current != nullptr && ids.size() <= current->capacity &&
+        std::includes(ids.begin(), ids.end(), current->ids.begin(), current->ids.end())) {
+        // Additions only: extend a copy of the current filter
+        std::vector<std::string> added;
+        std::set_difference(ids.begin(), ids.end(), current->ids.begin(), current->ids.end(),
+                            std::back_inserter(added));
+        auto extended = std::make_shared<Snapshot>();
+        extended->blocks = current->blocks;
+        extended->capacity = current->capacity;
+        for (const std::string& id : added) {
+            insertHash(extended->blocks, hashId(id));
+        }
+        extended->ids = std::move(ids);
+        next = std::move(extended);
+    } else {
+        next = buildSnapshot(std::move(ids));
+        rebuildCount++;
+    }
+
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex);
+        snapshot.swap(next);
+    }
+    refreshCount++;
+    // The previous snapshot is released here, outside the snapshot lock
+}
+
+void BlacklistIndex::refresh(ComplianceCheckService& service) {
+    load(service.getBlacklist());
+}
+
+void BlacklistIndex::startBackgroundRefresh(ComplianceCheckService& service, std::chrono::milliseconds interval) {
+    stopBackgroundRefresh();
+    {
+        std::lock_guard<std::mutex> lock(backgroundMutex);
+        stopRequested = false;
+    }
+    backgroundThread = std::thread(&BlacklistIndex::backgroundLoop, this, std::ref(service), interval);
+}
+
+void BlacklistIndex::stopBackgroundRefresh() {
+    {
+        std::lock_guard<std::mutex> lock(backgroundMutex);
+        stopRequested = true;
+    }
+    backgroundWake.notify_all();
+    if (backgroundThread.joinable()) {
+        backgroundThread.join();
+    }
+}
+
+void BlacklistIndex::backgroundLoop(ComplianceCheckService& service, std::chrono::milliseconds interval) {
+    std::unique_lock<std::mutex> lock(backgroundMutex);
+    while (!stopRequested) {
+        lock.unlock();
+        // A failing back end keeps the last good snapshot in place
+        try {
+            refresh(service);
+        } catch (...) {
+        }
+        lock.lock();
+        backgroundWake.wait_for(lock, interval, [this]() { return stopRequested; });
+    }
+}
+
+bool BlacklistIndex::mayContain(std::string_view accountNumber) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return snapshot != nullptr && testHash(snapshot->blocks, hashId(accountNumber));
+}
+
+bool BlacklistIndex::contains(std::string_view accountNumber) const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (snapshot == nullptr || !testHash(snapshot->blocks, hashId(accountNumber))) {
+        return false;
+    }
+    auto found = std::lower_bound(snapshot->ids.begin(), snapshot->ids.end(), accountNumber, lessThan);
+    return found != snapshot->ids.end() && *found == accountNumber;
+}
+
+std::size_t BlacklistIndex::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    return snapshot == nullptr ? 0 : snapshot->ids.size();
+}
+
+std::size_t BlacklistIndex::getMemoryUsage() const {
+    std::shared_lock<std::shared_mutex> lock(mutex);
+    if (snapshot == nullptr) {
+        return 0;
+    }
+    std::size_t bytes = snapshot->blocks.capacity() * sizeof(Block) +
+                        snapshot->ids.capacity() * sizeof(std::string);
+    const std::size_t inlineCapacity = std::string().capacity();
+    for (const std::string& id : snapshot->ids) {
+        // Ids beyond the small-string buffer own a separate heap block
+        if (id.capacity() > inlineCapacity) {
+            bytes += id.capacity() + 1;
+        }
+    }
+    return bytes;
+}
+
+std::size_t BlacklistIndex::getRefreshCount() const {
+    std::lock_guard<std::mutex> lock(refreshMutex);
+    return refreshCount;
+}
+
+std::size_t BlacklistIndex::getRebuildCount() const {
+    std::lock_guard<std::mutex> lock(refreshMutex);
+    return rebuildCount;
+}
@@ -0,0 +1,105 @@
+#include "ComplianceCache.hpp"
+
+CachingComplianceCheckService::CachingComplianceCheckService(ComplianceCheckService& service,
+                                                             std::chrono::steady_clock::duration ttl,
+                                                             std::chrono::steady_clock::duration blockedTtl,
+                                                             std::size_t maxEntries,
+                                                             Clock clock)
+    : service(service), ttl(ttl), blockedTtl(blockedTtl), maxEntries(maxEntries == 0 ? 1 : maxEntries),
+      clock(clock ? std::move(clock) : Clock(&std::chrono::steady_clock::now)),
+      invalidationEpoch(0), hitCount(0), missCount(0) {
+}
+
+ComplianceLevel CachingComplianceCheckService::checkComplianceLevel(const std::string& accountNumber) {
+    const std::chrono::steady_clock::time_point now = clock();
+    std::size_t epoch;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto found = entries.find(accountNumber);
+        if (found != entries.end() && now < found->second.expiresAt) {
+            recencyOrder.splice(recencyOrder.begin(), recencyOrder, found->second.recency);
+            hitCount.fetch_add(1, std::memory_order_relaxed);
+            return found->second.level;
+        }
+        epoch = invalidationEpoch;
+    }
+
+    // The back end is asked without holding the lock, so a slow lookup does not stall cache hits
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    ComplianceLevel level = service.checkComplianceLevel(accountNumber);
+    store(accountNumber, level, now, epoch);
+    return level;
+}
+
+void CachingComplianceCheckService::store(const std::string& accountNumber, ComplianceLevel level,
+                                          std::chrono::steady_clock::time_point now, std::size_t epoch) {
+    const std::chrono::steady_clock::time_point expiresAt =
+        now + (level == ComplianceLevel::BLOCKED ? blockedTtl : ttl);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (epoch != invalidationEpoch) {
+        return;
+    }
+
+    auto found = entries.find(accountNumber);
+    if (found != entries.end()) {
+        found->second.level = level;
+        found->second.expiresAt = expiresAt;
+        recencyOrder.splice(recencyOrder.begin(), recencyOrder, found->second.recency);
+        return;
+    }
+
+    if (entries.size() >= maxEntries) {
+        entries.erase(recencyOrder.back());
+        recencyOrder.pop_back();
+    }
+    recencyOrder.push_front(accountNumber);
+    entries.emplace(accountNumber, Entry{level, expiresAt, recencyOrder.begin()});
+}
+
+bool CachingComplianceCheckService::reportSuspiciousActivity(const std::string& accountNumber,
+                                                             const std::string& description) {
+    invalidate(accountNumber);
+    bool reported = service.reportSuspiciousActivity(accountNumber, description);
+    // A decision fetched while the report was in flight may predate it
+    invalidate(accountNumber);
+    return reported;
+}
+
+std::vector<std::string> CachingComplianceCheckService::getBlacklist() {
+    return service.getBlacklist();
+}
+
+bool CachingComplianceCheckService::isAccountBlacklisted(const std::string& accountNumber) {
+    return service.isAccountBlacklisted(accountNumber);
+}
+
+void CachingComplianceCheckService::invalidate(const std::string& accountNumber) {
+    std::lock_guard<std::mutex> lock(mutex);
+    invalidationEpoch++;
+    auto found = entries.find(accountNumber);
+    if (found != entries.end()) {
+        recencyOrder.erase(found->second.recency);
+        entries.erase(found);
+    }
+}
+
+void CachingComplianceCheckService::clear() {
+    std::lock_guard<std::mutex> lock(mutex);
+    invalidationEpoch++;
+    entries.clear();
+    recencyOrder.clear();
+}
+
+std::size_t CachingComplianceCheckService::getHitCount() const {
+    return hitCount.load(std::memory_order_relaxed);
+}
+
+std::size_t CachingComplianceCheckService::getMissCount() const {
+    return missCount.load(std::memory_order_relaxed);
+}
+
+std::size_t CachingComplianceCheckService::size() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return entries.size();
+}
@@ -0,0 +1,256 @@
+#include "ConcurrentAccountManager.hpp"
+#include "AccountIndex.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+std::size_t mixAccountId(int accountId) {
+    std::uint64_t hash = static_cast<std::uint64_t>(static_cast<std::uint32_t>(accountId)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<std::size_t>(hash >> 32);
+}
+
+} // namespace
+
+AccountHandle::AccountHandle()
+    : account(nullptr) {
+}
+
+AccountHandle::AccountHandle(std::shared_lock<std::shared_mutex>&& lock, const Account* account)
+    : lock(std::move(lock)), account(account) {
+}
+
+AccountHandle::operator bool() const {
+    return account != nullptr;
+}
+
+const Account* AccountHandle::get() const {
+    return account;
+}
+
+const Account* AccountHandle::operator->() const {
+    return account;
+}
+
+const Account& AccountHandle::operator*() const {
+    return *account;
+}
+
+ConcurrentAccountManager::ConcurrentAccountManager(std::size_t shardCount)
+    : shardCount(shardCount == 0 ? 1 : shardCount), shards(new Shard[this->shardCount]), accountCount(0) {
+}
+
+ConcurrentAccountManager::~ConcurrentAccountManager() {
+}
+
+ConcurrentAccountManager::Shard& ConcurrentAccountManager::shardFor(const std::string& accountNumber) const {
+    int accountId = 0;
+    if (AccountIndex::parseAccountId(accountNumber, accountId)) {
+        return shardFor(accountId);
+    }
+    return shards[std::hash<std::string>()(accountNumber) % shardCount];
+}
+
+ConcurrentAccountManager::Shard& ConcurrentAccountManager::shardFor(int accountId) const {
+    return shards[mixAccountId(accountId) % shardCount];
+}
+
+void ConcurrentAccountManager::setAuthenticationService(AuthenticationService* service) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setAuthenticationService(service);
+    }
+}
+
+void ConcurrentAccountManager::setNotificationService(NotificationService* service) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setNotificationService(service);
+    }
+}
+
+void ConcurrentAccountManager::setExternalDataService(ExternalDataService* service) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setExternalDataService(service);
+    }
+}
+
+void ConcurrentAccountManager::setAsyncExternalDataService(AsyncExternalDataService* service) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setAsyncExternalDataService(service);
+    }
+}
+
+void ConcurrentAccountManager::setAsyncNotificationService(AsyncNotificationService* service) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setAsyncNotificationService(service);
+    }
+}
+
+void ConcurrentAccountManager::setProcessingContext(ProcessingContext* processingContext) {
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::unique_lock<std::shared_mutex> lock(shards[i].mutex);
+        shards[i].manager.setProcessingContext(processingContext);
+    }
+}
+
+std::string ConcurrentAccountManager::createAccount(AccountType type, double initialBalance, std::uint32_t ownerId) {
+    // Reserve a slot of the owner limit first so concurrent creators can never overshoot it
+    {
+        std::lock_guard<std::mutex> lock(ownerMutex);
+        int& owned = ownerAccountCounts[ownerId];
+        if (owned >= AccountManager::getMaxAccountsPerUser()) {
+            return "";
+        }
+        owned++;
+    }
+
+    int accountId = AccountManager::reserveAccountIds(1);
+    Shard& shard = shardFor(accountId);
+    std::string accountNumber;
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        accountNumber = shard.manager.createReservedAccount(accountId, type, initialBalance, ownerId);
+    }
+
+    if (accountNumber.empty()) {
+        std::lock_guard<std::mutex> lock(ownerMutex);
+        ownerAccountCounts[ownerId]--;
+    } else {
+        accountCount.fetch_add(1, std::memory_order_acq_rel);
+    }
+    return accountNumber;
+}
+
+bool ConcurrentAccountManager::activateAccount(const std::string& accountNumber) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.activateAccount(accountNumber);
+}
+
+bool ConcurrentAccountManager::suspendAccount(const std::string& accountNumber, const std::string& reason) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.suspendAccount(accountNumber, reason);
+}
+
+bool ConcurrentAccountManager::deactivateAccount(const std::string& accountNumber) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.deactivateAccount(accountNumber);
+}
+
+AccountStatus ConcurrentAccountManager::evaluateAccountRisk(const std::string& accountNumber,
+                                                            int transactionCount,
+                                                            double volumeLastDay) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.evaluateAccountRisk(accountNumber, transactionCount, volumeLastDay);
+}
+
+bool ConcurrentAccountManager::updateAccountStatus(const std::string& accountNumber, AccountStatus newStatus) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.updateAccountStatus(accountNumber, newStatus);
+}
+
+AccountHandle ConcurrentAccountManager::getAccount(const std::string& accountNumber) const {
+    Shard& shard = shardFor(accountNumber);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    const Account* account = shard.manager.getAccount(accountNumber);
+    return AccountHandle(std::move(lock), account);
+}
+
+bool ConcurrentAccountManager::verifyAccount(const std::string& accountNumber, bool verificationResult) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.verifyAccount(accountNumber, verificationResult);
+}
+
+std::future<bool> ConcurrentAccountManager::verifyAccountAsync(const std::string& accountNumber,
+                                                              bool verificationResult) {
+    Shard& shard = shardFor(accountNumber);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.verifyAccountAsync(accountNumber, verificationResult);
+}
+
+std::future<AccountStatus> ConcurrentAccountManager::evaluateAccountRiskAsync(const std::string& accountNumber,
+                                                                              int transactionCount,
+                                                                              double volumeLastDay) {
+    Shard& shard = shardFor(accountNumber);
+    std::future<AccountStatus> status;
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        status = shard.manager.evaluateAccountRiskAsync(accountNumber, transactionCount, volumeLastDay);
+    }
+    // Waiting on the shard's future updates the account, so it is waited on under the shard lock again
+    return std::async(std::launch::deferred, [&shard, status = std::move(status)]() mutable {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return status.get();
+    });
+}
+
+bool ConcurrentAccountManager::transferBalance(const std::string& source, const std::string& destination,
+                                               double amount) {
+    Money cents;
+    if (!Money::fromExactAmount(amount, cents) || cents <= Money() || source == destination) {
+        return false;
+    }
+
+    Shard& sourceShard = shardFor(source);
+    Shard& destinationShard = shardFor(destination);
+    // Shards live in one array, so address order is shard order
+    Shard& first = &sourceShard < &destinationShard ? sourceShard : destinationShard;
+    Shard& second = &sourceShard < &destinationShard ? destinationShard : sourceShard;
+    std::unique_lock<std::shared_mutex> firstLock(first.mutex);
+    std::unique_lock<std::shared_mutex> secondLock;
+    if (&second != &first) {
+        secondLock = std::unique_lock<std::shared_mutex>(second.mutex);
+    }
+
+    // Both sides are checked before either changes, so a refusal leaves both accounts untouched
+    if (!sourceShard.manager.canAdjustBalance(source, -cents) ||
+        !destinationShard.manager.canAdjustBalance(destination, cents)) {
+        return false;
+    }
+    sourceShard.manager.adjustBalance(source, -cents);
+    destinationShard.manager.adjustBalance(destination, cents);
+    return true;
+}
+
+double ConcurrentAccountManager::getAccountBalance(const std::string& accountNumber) const {
+    Shard& shard = shardFor(accountNumber);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.manager.getAccountBalance(accountNumber);
+}
+
+int ConcurrentAccountManager::getSuspendedAccountCount() const {
+    int total = 0;
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        std::shared_lock<std::shared_mutex> lock(shards[i].mutex);
+        total += shards[i].manager.getSuspendedAccountCount();
+    }
+    return total;
+}
+
+double ConcurrentAccountManager::getTotalManagedBalance() const {
+    // Locked in shard order, as transferBalance does, and held until every shard is summed
+    std::vector<std::shared_lock<std::shared_mutex>> locks;
+    locks.reserve(shardCount);
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        locks.emplace_back(shards[i].mutex);
+    }
+    // Summed in cents: adding the shard totals as doubles would round differently as they change
+    Money total;
+    for (std::size_t i = 0; i < shardCount; ++i) {
+        total += Money(shards[i].manager.getTotalManagedBalance());
+    }
+    return total.toDouble();
+}
+
+int ConcurrentAccountManager::getAccountCount() const {
+    return accountCount.load(std::memory_order_acquire);
+}
@@ -0,0 +1,87 @@
+#include "DailyUsageCounter.hpp"
+#include <thread>
+
+DailyUsageCounter::DailyUsageCounter() : state(0) {
+}
+
+std::uint64_t DailyUsageCounter::pack(const DailyUsage& usage) {
+    return (static_cast<std::uint64_t>(usage.volumeCents) << COUNT_BITS) |
+           static_cast<std::uint64_t>(usage.transactionCount);
+}
+
+DailyUsage DailyUsageCounter::unpack(std::uint64_t word) {
+    return DailyUsage{
+        static_cast<int>(word & static_cast<std::uint64_t>(MAX_TRANSACTION_COUNT)),
+        static_cast<std::int64_t>(word >> COUNT_BITS)
+    };
+}
+
+DailyUsage DailyUsageCounter::load() const {
+    return unpack(state.load(std::memory_order_acquire));
+}
+
+bool DailyUsageCounter::compareExchange(DailyUsage& expected, const DailyUsage& desired) {
+    std::uint64_t word = pack(expected);
+    if (state.compare_exchange_strong(word, pack(desired), std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return true;
+    }
+    expected = unpack(word);
+    return false;
+}
+
+void DailyUsageCounter::reset() {
+    state.store(0, std::memory_order_release);
+}
+
+bool DailyUsageCounter::fits(const DailyUsage& usage) {
+    return usage.transactionCount >= 0 && usage.transactionCount <= MAX_TRANSACTION_COUNT &&
+           usage.volumeCents >= 0 && usage.volumeCents <= MAX_VOLUME_CENTS;
+}
+
+DailyUsageWindow::DailyUsageWindow() {
+    // Below every real day, so the first use of a slot rolls it over
+    for (Slot& slot : slots) {
+        slot.day.store(ROLLING_OVER - 1, std::memory_order_relaxed);
+    }
+}
+
+DailyUsageCounter* DailyUsageWindow::counterFor(std::time_t timestamp) {
+    const std::int64_t day = dayOf(timestamp);
+    Slot& slot = slots[static_cast<std::size_t>(day) % SLOT_COUNT];
+    while (true) {
+        std::int64_t current = slot.day.load(std::memory_order_acquire);
+        if (current == ROLLING_OVER) {
+            // Another thread is clearing the slot; that takes a few instructions
+            std::this_thread::yield();
+        } else if (current == day) {
+            return &slot.usage;
+        } else if (current > day) {
+            // The slot was rolled over to a later day that shares it
+            return nullptr;
+        } else if (slot.day.compare_exchange_weak(current, ROLLING_OVER, std::memory_order_acq_rel)) {
+            // Clear before publishing the new day, so nobody counts against the old usage under it
+            slot.usage.reset();
+            slot.day.store(day, std::memory_order_release);
+            return &slot.usage;
+        }
+    }
+}
+
+DailyUsage DailyUsageWindow::load(std::time_t timestamp) const {
+    const std::int64_t day = dayOf(timestamp);
+    const Slot& slot = slots[static_cast<std::size_t>(day) % SLOT_COUNT];
+    if (slot.day.load(std::memory_order_acquire) != day) {
+        return DailyUsage{0, 0};
+    }
+    return slot.usage.load();
+}
+
+void DailyUsageWindow::reset() {
+    for (Slot& slot : slots) {
+        slot.usage.reset();
+    }
+}
+
+std::int64_t DailyUsageWindow::dayOf(std::time_t timestamp) {
+    return timestamp < 0 ? 0 : static_cast<std::int64_t>(timestamp) / SECONDS_PER_DAY;
+}
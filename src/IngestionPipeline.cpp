@@ -0,0 +1,286 @@
+#include "IngestionPipeline.hpp"
+#include "MappedFile.hpp"
+#include "TransactionHistory.hpp"
+#include "TransactionPolicy.hpp"
+#include <charconv>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+namespace {
+
+const std::string_view CSV_HEADER_PREFIX = "type";
+
+const std::string_view TRANSACTION_TYPE_NAMES[] = {"DEPOSIT", "WITHDRAWAL", "TRANSFER", "REFUND"};
+const std::string_view ACCOUNT_TYPE_NAMES[] = {"CHECKING", "SAVINGS", "INVESTMENT", "BUSINESS"};
+
+template <typename Enum, std::size_t N>
+bool parseEnumName(std::string_view field, const std::string_view (&names)[N], Enum& value) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (field == names[i]) {
+            value = static_cast<Enum>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Splits off the text up to the next comma; returns false once the row is used up
+bool nextField(std::string_view& row, std::string_view& field) {
+    if (row.data() == nullptr) {
+        return false;
+    }
+    const std::size_t comma = row.find(',');
+    if (comma == std::string_view::npos) {
+        field = row;
+        row = std::string_view();
+    } else {
+        field = row.substr(0, comma);
+        row.remove_prefix(comma + 1);
+    }
+    return true;
+}
+
+// Enough batches to fill every stage queue plus the one each stage and the parser is working on
+std::size_t batchCountFor(std::size_t queueCapacity) {
+    return (queueCapacity == 0 ? 1 : queueCapacity) * INGESTION_QUEUE_COUNT + INGESTION_QUEUE_COUNT + 1;
+}
+
+std::string_view accountField(const char* field) {
+    return std::string_view(field, strnlen(field, TransactionHistoryRecord::ACCOUNT_FIELD_SIZE));
+}
+
+} // namespace
+
+const std::size_t IngestionPipeline::DEFAULT_BATCH_SIZE;
+const std::size_t IngestionPipeline::DEFAULT_QUEUE_CAPACITY;
+
+IngestionPipeline::IngestionPipeline(TransactionProcessor& processor, std::size_t batchSize, std::size_t queueCapacity)
+    : processor(processor), batchSize(batchSize == 0 ? 1 : batchSize),
+      freeBatches(batchCountFor(queueCapacity)) {
+    for (std::unique_ptr<SpscQueue<Batch*>>& queue : stageQueues) {
+        queue = std::make_unique<SpscQueue<Batch*>>(queueCapacity == 0 ? 1 : queueCapacity);
+    }
+
+    // Every batch is back on the free list whenever no ingestion is running
+    const std::size_t batchCount = batchCountFor(queueCapacity);
+    batches.reserve(batchCount);
+    for (std::size_t i = 0; i < batchCount; ++i) {
+        batches.push_back(std::make_unique<Batch>());
+        batches.back()->requests.resize(this->batchSize);
+        batches.back()->count = 0;
+        freeBatches.push(batches.back().get());
+    }
+}
+
+bool IngestionPipeline::parseCsvRow(std::string_view row, TransactionRequest& request) {
+    std::string_view field;
+    if (!nextField(row, field) || !parseEnumName(field, TRANSACTION_TYPE_NAMES, request.type)) {
+        return false;
+    }
+
+    if (!nextField(row, field) || field.empty()) {
+        return false;
+    }
+    const std::from_chars_result amount = std::from_chars(field.data(), field.data() + field.size(), request.amount);
+    if (amount.ec != std::errc() || amount.ptr != field.data() + field.size()) {
+        return false;
+    }
+
+    if (!nextField(row, field) || field.empty()) {
+        return false;
+    }
+    request.sourceAccount.assign(field.data(), field.size());
+
+    if (!nextField(row, field)) {
+        return false;
+    }
+    request.destAccount.assign(field.data(), field.size());
+
+    request.sourceAccountType = DEFAULT_TRANSACTION_PRODUCT;
+    if (nextField(row, field)) {
+        if (!field.empty() && !parseEnumName(field, ACCOUNT_TYPE_NAMES, request.sourceAccountType)) {
+            return false;
+        }
+        if (row.data() != nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+IngestionReport IngestionPipeline::ingest(const char* data, std::size_t size, IngestionFormat format) {
+    // The stage threads and the parser write disjoint fields of the report
+    IngestionReport report{};
+    std::thread validator(&IngestionPipeline::runStage, this, IngestionStage::VALIDATE, std::ref(report));
+    std::thread screener(&IngestionPipeline::runStage, this, IngestionStage::SCREEN, std::ref(report));
+    std::thread executor(&IngestionPipeline::runStage, this, IngestionStage::EXECUTE, std::ref(report));
+
+    if (format == IngestionFormat::CSV) {
+        parseCsv(data, size, report);
+    } else {
+        parseBinary(data, size, report);
+    }
+    stageQueues[static_cast<std::size_t>(IngestionStage::VALIDATE)]->push(nullptr);
+
+    validator.join();
+    screener.join();
+    executor.join();
+    return report;
+}
+
+bool IngestionPipeline::ingestFile(const std::string& path, IngestionFormat format, IngestionReport& report) {
+    MappedFile file;
+    if (!file.openReadOnly(path)) {
+        return false;
+    }
+    report = ingest(file.data(), file.size(), format);
+    return true;
+}
+
+void IngestionPipeline::runStage(IngestionStage stage, IngestionReport& report) {
+    const std::size_t index = static_cast<std::size_t>(stage);
+    SpscQueue<Batch*>& input = *stageQueues[index];
+    const bool isLast = stage == IngestionStage::EXECUTE;
+    SpscQueue<Batch*>& output = isLast ? freeBatches : *stageQueues[index + 1];
+    for (;;) {
+        Batch* batch = input.pop();
+        if (batch == nullptr) {
+            if (!isLast) {
+                output.push(nullptr);
+            }
+            return;
+        }
+
+        switch (stage) {
+            case IngestionStage::VALIDATE:
+                processor.validateBatch(batch->requests.data(), batch->count, batch->state);
+                break;
+            case IngestionStage::SCREEN:
+                processor.screenBatch(batch->requests.data(), batch->count, batch->state);
+                break;
+            case IngestionStage::EXECUTE:
+                processor.executeBatch(batch->requests.data(), batch->count, batch->state);
+                for (std::size_t i = 0; i < batch->count; ++i) {
+                    report.statusCounts[static_cast<std::size_t>(batch->state.statuses[i])]++;
+                }
+                break;
+        }
+
+        output.push(batch);
+        if (!isLast && output.size() > report.peakQueueDepths[index + 1]) {
+            report.peakQueueDepths[index + 1] = output.size();
+        }
+    }
+}
+
+void IngestionPipeline::submitBatch(Batch* batch, IngestionReport& report) {
+    SpscQueue<Batch*>& queue = *stageQueues[static_cast<std::size_t>(IngestionStage::VALIDATE)];
+    queue.push(batch);
+    if (batch->count != 0) {
+        report.batchCount++;
+    }
+    std::size_t& peak = report.peakQueueDepths[static_cast<std::size_t>(IngestionStage::VALIDATE)];
+    if (queue.size() > peak) {
+        peak = queue.size();
+    }
+}
+
+void IngestionPipeline::parseCsv(const char* data, std::size_t size, IngestionReport& report) {
+    const char* const end = data + size;
+    const char* line = data;
+    Batch* batch = nullptr;
+    bool firstRow = true;
+
+    while (line < end) {
+        const char* newline = static_cast<const char*>(std::memchr(line, '\n', static_cast<std::size_t>(end - line)));
+        const char* lineEnd = newline != nullptr ? newline : end;
+        std::string_view row(line, static_cast<std::size_t>(lineEnd - line));
+        line = newline != nullptr ? newline + 1 : end;
+
+        if (!row.empty() && row.back() == '\r') {
+            row.remove_suffix(1);
+        }
+        if (row.empty()) {
+            continue;
+        }
+        if (firstRow) {
+            firstRow = false;
+            if (row.substr(0, CSV_HEADER_PREFIX.size()) == CSV_HEADER_PREFIX) {
+                continue;
+            }
+        }
+
+        if (batch == nullptr) {
+            batch = freeBatches.pop();
+            batch->count = 0;
+        }
+        if (!parseCsvRow(row, batch->requests[batch->count])) {
+            report.malformedCount++;
+            continue;
+        }
+        report.rowCount++;
+        if (++batch->count == batchSize) {
+            submitBatch(batch, report);
+            batch = nullptr;
+        }
+    }
+
+    // Only the executor returns batches to the free list, so even an empty one goes through the stages
+    if (batch != nullptr) {
+        submitBatch(batch, report);
+    }
+}
+
+void IngestionPipeline::parseBinary(const char* data, std::size_t size, IngestionReport& report) {
+    const std::size_t recordCount = size / sizeof(TransactionHistoryRecord);
+    if (size % sizeof(TransactionHistoryRecord) != 0) {
+        report.malformedCount++;
+    }
+
+    Batch* batch = nullptr;
+    for (std::size_t i = 0; i < recordCount; ++i) {
+        // Copied out field by field: the input need not be aligned for the record
+        TransactionHistoryRecord record;
+        std::memcpy(&record, data + i * sizeof(TransactionHistoryRecord), sizeof(TransactionHistoryRecord));
+        if (record.type < static_cast<std::int32_t>(TransactionType::DEPOSIT) ||
+            record.type > static_cast<std::int32_t>(TransactionType::REFUND)) {
+            report.malformedCount++;
+            continue;
+        }
+
+        if (batch == nullptr) {
+            batch = freeBatches.pop();
+            batch->count = 0;
+        }
+        TransactionRequest& request = batch->requests[batch->count];
+        request.type = static_cast<TransactionType>(record.type);
+        request.amount = record.amount.toDouble();
+        const std::string_view source = accountField(record.sourceAccount);
+        const std::string_view destination = accountField(record.destAccount);
+        request.sourceAccount.assign(source.data(), source.size());
+        request.destAccount.assign(destination.data(), destination.size());
+        request.sourceAccountType = DEFAULT_TRANSACTION_PRODUCT;
+        report.rowCount++;
+        if (++batch->count == batchSize) {
+            submitBatch(batch, report);
+            batch = nullptr;
+        }
+    }
+
+    if (batch != nullptr) {
+        submitBatch(batch, report);
+    }
+}
+
+std::array<std::size_t, INGESTION_QUEUE_COUNT> IngestionPipeline::getQueueDepths() const {
+    std::array<std::size_t, INGESTION_QUEUE_COUNT> depths{};
+    for (std::size_t i = 0; i < INGESTION_QUEUE_COUNT; ++i) {
+        depths[i] = stageQueues[i]->size();
+    }
+    return depths;
+}
+
+std::size_t IngestionPipeline::getBatchSize() const {
+    return batchSize;
+}
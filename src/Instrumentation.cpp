@@ -0,0 +1,240 @@
+#include "Instrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+/// @brief Counters of one thread; only the owning thread writes them.
+struct InstrumentationShard {
+    std::array<std::array<std::atomic<std::uint64_t>, LATENCY_BUCKET_COUNT>, LATENCY_METRIC_COUNT> buckets{};
+    std::array<std::atomic<std::uint64_t>, LATENCY_METRIC_COUNT> totalNanoseconds{};
+    std::array<std::atomic<std::uint64_t>, LATENCY_METRIC_COUNT> maxNanoseconds{};
+    std::array<std::atomic<std::uint64_t>, TRANSACTION_STATUS_COUNT> transactionOutcomes{};
+    std::array<std::atomic<std::uint64_t>, ACCOUNT_STATUS_COUNT> accountOutcomes{};
+    std::array<std::atomic<std::uint64_t>, NOTIFICATION_EVENT_COUNT> notificationEvents{};
+};
+
+void increment(std::atomic<std::uint64_t>& counter, std::uint64_t value) {
+    // Single writer: a plain load and store is enough and avoids a locked instruction
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+template <std::size_t Count>
+void addInto(std::array<std::uint64_t, Count>& target, const std::array<std::atomic<std::uint64_t>, Count>& source) {
+    for (std::size_t i = 0; i < Count; ++i) {
+        target[i] += source[i].load(std::memory_order_relaxed);
+    }
+}
+
+template <std::size_t Count>
+void mergeInto(std::array<std::atomic<std::uint64_t>, Count>& target,
+               const std::array<std::atomic<std::uint64_t>, Count>& source) {
+    for (std::size_t i = 0; i < Count; ++i) {
+        target[i].fetch_add(source[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+
+template <std::size_t Count>
+void zero(std::array<std::atomic<std::uint64_t>, Count>& counters) {
+    for (std::atomic<std::uint64_t>& counter : counters) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+/// @brief The live shards and the merged counters of exited threads.
+struct ShardRegistry {
+    std::mutex mutex;
+    std::vector<InstrumentationShard*> live;
+    InstrumentationShard retired;
+};
+
+ShardRegistry& registry() {
+    // Never destroyed, so threads exiting during static destruction can still retire their shard
+    static ShardRegistry* instance = new ShardRegistry();
+    return *instance;
+}
+
+/// @brief Registers the shard of a thread on first use and retires it when the thread exits.
+class ShardOwner {
+private:
+    InstrumentationShard* shard;
+
+public:
+    ShardOwner() : shard(new InstrumentationShard()) {
+        ShardRegistry& shards = registry();
+        std::lock_guard<std::mutex> lock(shards.mutex);
+        shards.live.push_back(shard);
+    }
+
+    ~ShardOwner() {
+        ShardRegistry& shards = registry();
+        std::lock_guard<std::mutex> lock(shards.mutex);
+        shards.live.erase(std::find(shards.live.begin(), shards.live.end(), shard));
+        for (std::size_t metric = 0; metric < LATENCY_METRIC_COUNT; ++metric) {
+            mergeInto(shards.retired.buckets[metric], shard->buckets[metric]);
+            const std::uint64_t max = shard->maxNanoseconds[metric].load(std::memory_order_relaxed);
+            if (max > shards.retired.maxNanoseconds[metric].load(std::memory_order_relaxed)) {
+                shards.retired.maxNanoseconds[metric].store(max, std::memory_order_relaxed);
+            }
+        }
+        mergeInto(shards.retired.totalNanoseconds, shard->totalNanoseconds);
+        mergeInto(shards.retired.transactionOutcomes, shard->transactionOutcomes);
+        mergeInto(shards.retired.accountOutcomes, shard->accountOutcomes);
+        mergeInto(shards.retired.notificationEvents, shard->notificationEvents);
+        delete shard;
+    }
+
+    ShardOwner(const ShardOwner&) = delete;
+    ShardOwner& operator=(const ShardOwner&) = delete;
+
+    InstrumentationShard& get() {
+        return *shard;
+    }
+};
+
+InstrumentationShard& localShard() {
+    thread_local ShardOwner owner;
+    return owner.get();
+}
+
+void addShard(InstrumentationSnapshot& snapshot, const InstrumentationShard& shard) {
+    for (std::size_t metric = 0; metric < LATENCY_METRIC_COUNT; ++metric) {
+        LatencyHistogramSnapshot& histogram = snapshot.latencies[metric];
+        addInto(histogram.buckets, shard.buckets[metric]);
+        histogram.totalNanoseconds += shard.totalNanoseconds[metric].load(std::memory_order_relaxed);
+        histogram.maxNanoseconds = std::max(histogram.maxNanoseconds,
+                                            shard.maxNanoseconds[metric].load(std::memory_order_relaxed));
+    }
+    addInto(snapshot.transactionOutcomes, shard.transactionOutcomes);
+    addInto(snapshot.accountOutcomes, shard.accountOutcomes);
+    addInto(snapshot.notificationEvents, shard.notificationEvents);
+}
+
+void zeroShard(InstrumentationShard& shard) {
+    for (std::size_t metric = 0; metric < LATENCY_METRIC_COUNT; ++metric) {
+        zero(shard.buckets[metric]);
+    }
+    zero(shard.totalNanoseconds);
+    zero(shard.maxNanoseconds);
+    zero(shard.transactionOutcomes);
+    zero(shard.accountOutcomes);
+    zero(shard.notificationEvents);
+}
+
+} // namespace
+
+std::uint64_t LatencyHistogramSnapshot::valueAtPercentile(double percentile) const {
+    if (count == 0) {
+        return 0;
+    }
+    const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+    std::uint64_t rank = static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(count) + 0.5);
+    rank = std::max<std::uint64_t>(rank, 1);
+
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < LATENCY_BUCKET_COUNT; ++bucket) {
+        seen += buckets[bucket];
+        if (seen >= rank) {
+            return std::min(latencyBucketLowerBound(bucket), maxNanoseconds);
+        }
+    }
+    return maxNanoseconds;
+}
+
+double LatencyHistogramSnapshot::meanNanoseconds() const {
+    return count == 0 ? 0.0 : static_cast<double>(totalNanoseconds) / static_cast<double>(count);
+}
+
+const LatencyHistogramSnapshot& InstrumentationSnapshot::latency(LatencyMetric metric) const {
+    return latencies[static_cast<std::size_t>(metric)];
+}
+
+std::uint64_t InstrumentationSnapshot::transactionOutcome(TransactionStatus status) const {
+    return transactionOutcomes[static_cast<std::size_t>(status)];
+}
+
+std::uint64_t InstrumentationSnapshot::accountOutcome(AccountStatus status) const {
+    return accountOutcomes[static_cast<std::size_t>(status)];
+}
+
+std::uint64_t InstrumentationSnapshot::notificationCount(NotificationEvent event) const {
+    return notificationEvents[static_cast<std::size_t>(event)];
+}
+
+std::uint64_t InstrumentationSnapshot::notificationQueueDepth() const {
+    // The counters of different threads are read at slightly different moments
+    const std::uint64_t queued = notificationCount(NotificationEvent::ENQUEUED) +
+                                 notificationCount(NotificationEvent::RETRIED);
+    const std::uint64_t dispatched = notificationCount(NotificationEvent::DISPATCHED);
+    return queued > dispatched ? queued - dispatched : 0;
+}
+
+void Instrumentation::recordLatency(LatencyMetric metric, std::uint64_t nanoseconds) {
+    const std::size_t index = static_cast<std::size_t>(metric);
+    if (!ENABLED || index >= LATENCY_METRIC_COUNT) {
+        return;
+    }
+    InstrumentationShard& shard = localShard();
+    increment(shard.buckets[index][latencyBucketIndex(nanoseconds)], 1);
+    increment(shard.totalNanoseconds[index], nanoseconds);
+    if (nanoseconds > shard.maxNanoseconds[index].load(std::memory_order_relaxed)) {
+        shard.maxNanoseconds[index].store(nanoseconds, std::memory_order_relaxed);
+    }
+}
+
+void Instrumentation::countTransactionOutcome(TransactionStatus status) {
+    const std::size_t index = static_cast<std::size_t>(status);
+    if (ENABLED && index < TRANSACTION_STATUS_COUNT) {
+        increment(localShard().transactionOutcomes[index], 1);
+    }
+}
+
+void Instrumentation::countAccountOutcome(AccountStatus status) {
+    const std::size_t index = static_cast<std::size_t>(status);
+    if (ENABLED && index < ACCOUNT_STATUS_COUNT) {
+        increment(localShard().accountOutcomes[index], 1);
+    }
+}
+
+void Instrumentation::countNotification(NotificationEvent event, std::uint64_t count) {
+    const std::size_t index = static_cast<std::size_t>(event);
+    if (ENABLED && index < NOTIFICATION_EVENT_COUNT) {
+        increment(localShard().notificationEvents[index], count);
+    }
+}
+
+InstrumentationSnapshot Instrumentation::snapshot() {
+    InstrumentationSnapshot snapshot{};
+    if (!ENABLED) {
+        return snapshot;
+    }
+
+    ShardRegistry& shards = registry();
+    std::lock_guard<std::mutex> lock(shards.mutex);
+    addShard(snapshot, shards.retired);
+    for (const InstrumentationShard* shard : shards.live) {
+        addShard(snapshot, *shard);
+    }
+    for (LatencyHistogramSnapshot& histogram : snapshot.latencies) {
+        for (std::uint64_t bucket : histogram.buckets) {
+            histogram.count += bucket;
+        }
+    }
+    return snapshot;
+}
+
+void Instrumentation::reset() {
+    if (!ENABLED) {
+        return;
+    }
+
+    ShardRegistry& shards = registry();
+    std::lock_guard<std::mutex> lock(shards.mutex);
+    zeroShard(shards.retired);
+    for (InstrumentationShard* shard : shards.live) {
+        zeroShard(*shard);
+    }
+}
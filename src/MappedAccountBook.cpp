@@ -0,0 +1,107 @@
+#include "MappedAccountBook.hpp"
+#include "AccountIndex.hpp"
+
+namespace {
+
+const int MAX_INTERPOLATION_STEPS = 4;
+
+} // namespace
+
+MappedAccountBook::MappedAccountBook()
+    : header(nullptr), records(nullptr), recordCount(0) {
+}
+
+bool MappedAccountBook::open(const std::string& path) {
+    close();
+    if (!file.openReadOnly(path) || file.size() < sizeof(AccountSnapshotHeader)) {
+        close();
+        return false;
+    }
+
+    const AccountSnapshotHeader* mapped = reinterpret_cast<const AccountSnapshotHeader*>(file.data());
+    if (!AccountSnapshot::isValidHeader(*mapped, file.size()) ||
+        (mapped->flags & AccountSnapshotHeader::SORTED_BY_ID_FLAG) == 0) {
+        close();
+        return false;
+    }
+
+    header = mapped;
+    records = reinterpret_cast<const AccountLogRecord*>(file.data() + sizeof(AccountSnapshotHeader));
+    recordCount = static_cast<std::size_t>(mapped->accountCount);
+    return true;
+}
+
+void MappedAccountBook::close() {
+    file.close();
+    header = nullptr;
+    records = nullptr;
+    recordCount = 0;
+}
+
+bool MappedAccountBook::isOpen() const {
+    return header != nullptr;
+}
+
+bool MappedAccountBook::verify() const {
+    return header != nullptr &&
+           AccountSnapshot::computeChecksum(*header, records, recordCount) == header->checksum;
+}
+
+const AccountLogRecord* MappedAccountBook::find(int accountId) const {
+    if (recordCount == 0) {
+        return nullptr;
+    }
+
+    std::size_t low = 0;
+    std::size_t high = recordCount - 1;
+    int steps = 0;
+    while (low <= high) {
+        const std::int64_t lowId = records[low].accountId;
+        const std::int64_t highId = records[high].accountId;
+        if (accountId < lowId || accountId > highId) {
+            return nullptr;
+        }
+
+        // Interpolate between the bounds: dense ids hit on the first probe. Skewed id ranges
+        // fall back to bisection, which bounds the search at O(log n) probes
+        std::size_t probe = low + (high - low) / 2;
+        if (steps++ < MAX_INTERPOLATION_STEPS && highId > lowId) {
+            probe = low + static_cast<std::size_t>((accountId - lowId) * static_cast<std::int64_t>(high - low) /
+                                                   (highId - lowId));
+        }
+
+        const int probeId = records[probe].accountId;
+        if (probeId == accountId) {
+            return &records[probe];
+        }
+        if (probeId < accountId) {
+            low = probe + 1;
+        } else {
+            if (probe == 0) {
+                return nullptr;
+            }
+            high = probe - 1;
+        }
+    }
+    return nullptr;
+}
+
+const AccountLogRecord* MappedAccountBook::find(const std::string& accountNumber) const {
+    int accountId = 0;
+    if (!AccountIndex::parseAccountId(accountNumber, accountId)) {
+        return nullptr;
+    }
+    return find(accountId);
+}
+
+const AccountLogRecord& MappedAccountBook::recordAt(std::size_t position) const {
+    return records[position];
+}
+
+const AccountSnapshotHeader& MappedAccountBook::getHeader() const {
+    return *header;
+}
+
+std::size_t MappedAccountBook::size() const {
+    return recordCount;
+}
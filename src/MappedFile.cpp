@@ -0,0 +1,251 @@
+#include "MappedFile.hpp"
+
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+MappedFile::MappedFile()
+    : mappedData(nullptr), mappedSize(0), writable(false),
+      fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {
+}
+
+bool MappedFile::openReadOnly(const std::string& path) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    writable = false;
+    if (!mapOpenFile(static_cast<std::size_t>(fileSize.QuadPart))) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::openReadWrite(const std::string& path, std::size_t minimumSize) {
+    close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return false;
+    }
+
+    fileHandle = file;
+    writable = true;
+    std::size_t size = static_cast<std::size_t>(fileSize.QuadPart);
+    if (!mapOpenFile(size < minimumSize ? minimumSize : size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::mapOpenFile(std::size_t size) {
+    // Mapping a writable file beyond its end extends it with zero bytes
+    LARGE_INTEGER mappingSize;
+    mappingSize.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE mapping = CreateFileMappingA(static_cast<HANDLE>(fileHandle), nullptr,
+                                        writable ? PAGE_READWRITE : PAGE_READONLY,
+                                        mappingSize.HighPart, mappingSize.LowPart, nullptr);
+    if (mapping == nullptr) {
+        return false;
+    }
+
+    void* view = MapViewOfFile(mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+    if (view == nullptr) {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    mappingHandle = mapping;
+    mappedData = static_cast<char*>(view);
+    mappedSize = size;
+    return true;
+}
+
+void MappedFile::unmap() {
+    if (mappedData != nullptr) {
+        UnmapViewOfFile(mappedData);
+        mappedData = nullptr;
+    }
+    if (mappingHandle != nullptr) {
+        CloseHandle(static_cast<HANDLE>(mappingHandle));
+        mappingHandle = nullptr;
+    }
+    mappedSize = 0;
+}
+
+bool MappedFile::sync() {
+    if (mappedData == nullptr || !writable) {
+        return false;
+    }
+    return FlushViewOfFile(mappedData, mappedSize) != 0 &&
+           FlushFileBuffers(static_cast<HANDLE>(fileHandle)) != 0;
+}
+
+void MappedFile::close() {
+    unmap();
+    if (fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(static_cast<HANDLE>(fileHandle));
+        fileHandle = INVALID_HANDLE_VALUE;
+    }
+    writable = false;
+}
+
+#else
+
+MappedFile::MappedFile()
+    : mappedData(nullptr), mappedSize(0), writable(false), fileDescriptor(-1) {
+}
+
+bool MappedFile::openReadOnly(const std::string& path) {
+    close();
+    int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if (fstat(descriptor, &fileStatus) != 0 || fileStatus.st_size == 0) {
+        ::close(descriptor);
+        return false;
+    }
+
+    fileDescriptor = descriptor;
+    writable = false;
+    if (!mapOpenFile(static_cast<std::size_t>(fileStatus.st_size))) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::openReadWrite(const std::string& path, std::size_t minimumSize) {
+    close();
+    int descriptor = ::open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (descriptor < 0) {
+        return false;
+    }
+
+    struct stat fileStatus;
+    if (fstat(descriptor, &fileStatus) != 0) {
+        ::close(descriptor);
+        return false;
+    }
+
+    std::size_t size = static_cast<std::size_t>(fileStatus.st_size);
+    if (size < minimumSize) {
+        if (ftruncate(descriptor, static_cast<off_t>(minimumSize)) != 0) {
+            ::close(descriptor);
+            return false;
+        }
+        size = minimumSize;
+    }
+
+    fileDescriptor = descriptor;
+    writable = true;
+    if (!mapOpenFile(size)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+bool MappedFile::mapOpenFile(std::size_t size) {
+    if (size == 0) {
+        return false;
+    }
+    void* view = mmap(nullptr, size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ,
+                      MAP_SHARED, fileDescriptor, 0);
+    if (view == MAP_FAILED) {
+        return false;
+    }
+    mappedData = static_cast<char*>(view);
+    mappedSize = size;
+    return true;
+}
+
+void MappedFile::unmap() {
+    if (mappedData != nullptr) {
+        munmap(mappedData, mappedSize);
+        mappedData = nullptr;
+    }
+    mappedSize = 0;
+}
+
+bool MappedFile::sync() {
+    if (mappedData == nullptr || !writable) {
+        return false;
+    }
+    return msync(mappedData, mappedSize, MS_SYNC) == 0;
+}
+
+void MappedFile::close() {
+    unmap();
+    if (fileDescriptor >= 0) {
+        ::close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+    writable = false;
+}
+
+#endif
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::resize(std::size_t newSize) {
+    if (!writable || newSize < mappedSize) {
+        return false;
+    }
+    unmap();
+#if !defined(_WIN32)
+    if (ftruncate(fileDescriptor, static_cast<off_t>(newSize)) != 0) {
+        return false;
+    }
+#endif
+    return mapOpenFile(newSize);
+}
+
+bool MappedFile::isOpen() const {
+    return mappedData != nullptr;
+}
+
+char* MappedFile::data() {
+    return mappedData;
+}
+
+const char* MappedFile::data() const {
+    return mappedData;
+}
+
+std::size_t MappedFile::size() const {
+    return mappedSize;
+}
@@ -0,0 +1,61 @@
+#include "MemoryResources.hpp"
+
+namespace {
+
+CountingMemoryResource& scratchUpstream() {
+    // Never destroyed, so thread pools released after static destruction still have an upstream
+    static CountingMemoryResource* upstream = new CountingMemoryResource(std::pmr::new_delete_resource());
+    return *upstream;
+}
+
+} // namespace
+
+CountingMemoryResource::CountingMemoryResource(std::pmr::memory_resource* upstream)
+    : upstream(upstream != nullptr ? upstream : std::pmr::get_default_resource()),
+      allocationCount(0), deallocationCount(0), bytesAllocated(0), bytesInUse(0), peakBytesInUse(0) {
+}
+
+void* CountingMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    void* pointer = upstream->allocate(bytes, alignment);
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    bytesAllocated.fetch_add(bytes, std::memory_order_relaxed);
+
+    const std::size_t inUse = bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak = peakBytesInUse.load(std::memory_order_relaxed);
+    while (peak < inUse && !peakBytesInUse.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+    }
+    return pointer;
+}
+
+void CountingMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {
+    upstream->deallocate(pointer, bytes, alignment);
+    deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+bool CountingMemoryResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+std::pmr::memory_resource* CountingMemoryResource::getUpstream() const {
+    return upstream;
+}
+
+AllocationStats CountingMemoryResource::getStats() const {
+    return AllocationStats{
+        allocationCount.load(std::memory_order_relaxed),
+        deallocationCount.load(std::memory_order_relaxed),
+        bytesAllocated.load(std::memory_order_relaxed),
+        bytesInUse.load(std::memory_order_relaxed),
+        peakBytesInUse.load(std::memory_order_relaxed)
+    };
+}
+
+std::pmr::memory_resource* ThreadScratchPool::local() {
+    thread_local std::pmr::unsynchronized_pool_resource pool(&scratchUpstream());
+    return &pool;
+}
+
+AllocationStats ThreadScratchPool::getStats() {
+    return scratchUpstream().getStats();
+}
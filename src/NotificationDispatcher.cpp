@@ -0,0 +1,194 @@
+#include "NotificationDispatcher.hpp"
+#include "Instrumentation.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace {
+
+// Orders the retry heap so that the earliest due message is at the front
+struct DueLater {
+    template <typename Notification>
+    bool operator()(const Notification& left, const Notification& right) const {
+        return left.readyAt > right.readyAt;
+    }
+};
+
+} // namespace
+
+const std::size_t NotificationDispatcher::DEFAULT_WORKER_COUNT;
+const std::size_t NotificationDispatcher::DEFAULT_QUEUE_CAPACITY;
+const std::size_t NotificationDispatcher::DEFAULT_BATCH_SIZE;
+const int NotificationDispatcher::DEFAULT_MAX_ATTEMPTS;
+const int NotificationDispatcher::DEFAULT_INITIAL_BACKOFF_MS;
+
+NotificationDispatcher::NotificationDispatcher(NotificationService& service, std::size_t workerCount,
+                                               std::size_t queueCapacity, std::size_t batchSize)
+    : service(service), queueCapacity(queueCapacity == 0 ? 1 : queueCapacity), batchSize(batchSize == 0 ? 1 : batchSize),
+      maxAttempts(DEFAULT_MAX_ATTEMPTS), initialBackoff(DEFAULT_INITIAL_BACKOFF_MS),
+      inFlightCount(0), stopRequested(false), stats() {
+    const std::size_t count = workerCount == 0 ? 1 : workerCount;
+    workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&NotificationDispatcher::workerLoop, this);
+    }
+}
+
+NotificationDispatcher::~NotificationDispatcher() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void NotificationDispatcher::setRetryPolicy(int maxAttempts, std::chrono::milliseconds initialBackoff) {
+    std::lock_guard<std::mutex> lock(mutex);
+    this->maxAttempts = maxAttempts < 1 ? 1 : maxAttempts;
+    this->initialBackoff = initialBackoff;
+}
+
+void NotificationDispatcher::sendEmailNotificationAsync(const std::string& email,
+                                                        const std::string& subject,
+                                                        const std::string& body) {
+    // Free-form messages only coalesce when every field matches
+    std::string key;
+    key.reserve(email.size() + subject.size() + body.size() + 3);
+    key.append("F\x1f").append(email).append(1, '\x1f').append(subject).append(1, '\x1f').append(body);
+    enqueue(std::move(key), EmailNotification{email, subject, body});
+}
+
+void NotificationDispatcher::sendTemplateNotificationAsync(const std::string& email,
+                                                           NotificationTemplate notificationTemplate) {
+    std::string key = "T" + std::to_string(static_cast<int>(notificationTemplate)) + "\x1f" + email;
+    const NotificationTemplateText text = notificationTemplateText(notificationTemplate);
+    enqueue(std::move(key), EmailNotification{email, std::string(text.subject), std::string(text.body)});
+}
+
+void NotificationDispatcher::enqueue(std::string key, EmailNotification message) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (queuedKeys.count(key) != 0) {
+            stats.coalescedCount++;
+            Instrumentation::countNotification(NotificationEvent::COALESCED);
+            return;
+        }
+        if (ready.size() + retrying.size() >= queueCapacity) {
+            stats.droppedCount++;
+            Instrumentation::countNotification(NotificationEvent::DROPPED);
+            return;
+        }
+
+        queuedKeys.insert(key);
+        ready.push_back(PendingNotification{std::move(key), std::move(message), 0, std::chrono::steady_clock::now()});
+        stats.enqueuedCount++;
+        Instrumentation::countNotification(NotificationEvent::ENQUEUED);
+    }
+    workAvailable.notify_one();
+}
+
+void NotificationDispatcher::promoteDueRetries(std::chrono::steady_clock::time_point now) {
+    while (!retrying.empty() && retrying.front().readyAt <= now) {
+        std::pop_heap(retrying.begin(), retrying.end(), DueLater());
+        ready.push_back(std::move(retrying.back()));
+        retrying.pop_back();
+    }
+}
+
+void NotificationDispatcher::completeAttempt(PendingNotification& notification, bool sent,
+                                             std::chrono::steady_clock::time_point now) {
+    if (sent) {
+        stats.sentCount++;
+        Instrumentation::countNotification(NotificationEvent::SENT);
+        return;
+    }
+
+    notification.attempts++;
+    if (notification.attempts >= maxAttempts) {
+        stats.failedCount++;
+        Instrumentation::countNotification(NotificationEvent::FAILED);
+        return;
+    }
+    // A newer request for the same message was queued while this one was being sent
+    if (queuedKeys.count(notification.key) != 0) {
+        stats.coalescedCount++;
+        Instrumentation::countNotification(NotificationEvent::COALESCED);
+        return;
+    }
+
+    notification.readyAt = now + initialBackoff * (1 << std::min(notification.attempts - 1, 16));
+    queuedKeys.insert(notification.key);
+    retrying.push_back(std::move(notification));
+    std::push_heap(retrying.begin(), retrying.end(), DueLater());
+    stats.retriedCount++;
+    Instrumentation::countNotification(NotificationEvent::RETRIED);
+}
+
+void NotificationDispatcher::workerLoop() {
+    std::vector<PendingNotification> batch;
+    std::vector<EmailNotification> messages;
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        promoteDueRetries(std::chrono::steady_clock::now());
+        if (ready.empty()) {
+            if (retrying.empty()) {
+                if (stopRequested) {
+                    // Only reached once stopping: nothing is queued and nothing waits for a retry
+                    return;
+                }
+                workAvailable.wait(lock);
+            } else {
+                workAvailable.wait_until(lock, retrying.front().readyAt);
+            }
+            continue;
+        }
+
+        const std::size_t count = std::min(batchSize, ready.size());
+        batch.clear();
+        messages.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            // Leaving the queue ends coalescing, so a request arriving during the send is queued anew
+            queuedKeys.erase(ready.front().key);
+            messages.push_back(ready.front().message);
+            batch.push_back(std::move(ready.front()));
+            ready.pop_front();
+        }
+        inFlightCount += count;
+        stats.batchCount++;
+        Instrumentation::countNotification(NotificationEvent::DISPATCHED, count);
+        lock.unlock();
+
+        // A throwing gateway counts as a failure of the whole batch
+        std::vector<bool> sent;
+        try {
+            sent = timedServiceCall(LatencyMetric::EMAIL_NOTIFICATION,
+                                    [&]() { return service.sendEmailNotificationBatch(messages); });
+        } catch (...) {
+            sent.clear();
+        }
+
+        lock.lock();
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            completeAttempt(batch[i], i < sent.size() && sent[i], now);
+        }
+        inFlightCount -= count;
+        if (ready.empty() && retrying.empty() && inFlightCount == 0) {
+            idle.notify_all();
+        }
+    }
+}
+
+void NotificationDispatcher::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return ready.empty() && retrying.empty() && inFlightCount == 0; });
+}
+
+NotificationDispatcherStats NotificationDispatcher::getStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    NotificationDispatcherStats current = stats;
+    current.queueDepth = ready.size() + retrying.size();
+    return current;
+}
@@ -0,0 +1,11 @@
+#include "ProcessingContext.hpp"
+
+ProcessingContext::ProcessingContext()
+    : totalTransactionsProcessed(0), totalVolumeProcessedCents(0), totalAccountsCreated(0),
+      systemTotalBalanceCents(0), systemLocked(false), complianceAuditMode(false) {
+}
+
+ProcessingContext& ProcessingContext::global() {
+    static ProcessingContext context;
+    return context;
+}
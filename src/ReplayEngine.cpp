@@ -0,0 +1,147 @@
+#include "ReplayEngine.hpp"
+#include "ProcessingContext.hpp"
+#include "TransactionProcessor.hpp"
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <system_error>
+
+namespace {
+
+std::string accountField(const char* field) {
+    return std::string(field, strnlen(field, TransactionHistoryRecord::ACCOUNT_FIELD_SIZE));
+}
+
+} // namespace
+
+const std::size_t ReplayEngine::DEFAULT_PARTITION_COUNT;
+
+ReplayEngine::ReplayEngine(std::size_t threadCount, std::size_t partitionCount)
+    : pool(threadCount), partitionCount(partitionCount == 0 ? 1 : partitionCount), systemLocked(false) {
+}
+
+void ReplayEngine::setSystemLocked(bool locked) {
+    systemLocked = locked;
+}
+
+std::size_t ReplayEngine::partitionOf(const char* sourceAccount) const {
+    // FNV-1a: stable across platforms and runs, unlike std::hash
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    const std::size_t length = strnlen(sourceAccount, TransactionHistoryRecord::ACCOUNT_FIELD_SIZE);
+    for (std::size_t i = 0; i < length; ++i) {
+        hash = (hash ^ static_cast<unsigned char>(sourceAccount[i])) * 0x100000001B3ULL;
+    }
+    return static_cast<std::size_t>(hash % partitionCount);
+}
+
+ReplayResult ReplayEngine::replay(const std::vector<TransactionHistoryRecord>& records) {
+    ReplayResult result{};
+    result.statuses.assign(records.size(), TransactionStatus::REJECTED);
+
+    std::vector<std::vector<std::size_t>> partitions(partitionCount);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        partitions[partitionOf(records[i].sourceAccount)].push_back(i);
+    }
+
+    // Validation and screening depend on one record and its source account, so partitions run them alone
+    std::vector<TransactionRequest> requests(records.size());
+    // Bytes, not vector<bool>, so that partitions setting neighbouring flags do not race
+    std::vector<std::uint8_t> admitted(records.size(), 0);
+    pool.run(partitionCount, [&](std::size_t partition) {
+        const std::vector<std::size_t>& indices = partitions[partition];
+        if (indices.empty()) {
+            return;
+        }
+
+        std::vector<TransactionRequest> shard;
+        shard.reserve(indices.size());
+        for (std::size_t index : indices) {
+            const TransactionHistoryRecord& record = records[index];
+            shard.push_back(TransactionRequest{static_cast<TransactionType>(record.type), record.amount.toDouble(),
+                                               accountField(record.sourceAccount), accountField(record.destAccount)});
+        }
+
+        // The shard and everything it allocates is released in one step when the task ends
+        std::pmr::monotonic_buffer_resource arena;
+        TransactionProcessor processor(&arena);
+        processor.setTransactionLogSink(nullptr);
+        TransactionBatchState state(&arena);
+        processor.validateBatch(shard.data(), shard.size(), state);
+        processor.screenBatch(shard.data(), shard.size(), state);
+
+        // Each partition writes only the slots of its own records
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            admitted[indices[i]] = state.admitted[i] ? 1 : 0;
+            requests[indices[i]] = std::move(shard[i]);
+        }
+    });
+
+    // The daily limits are instance-wide: one processor counts every admitted record in input order
+    ProcessingContext context;
+    context.systemLocked.store(systemLocked, std::memory_order_relaxed);
+    std::pmr::monotonic_buffer_resource arena;
+    TransactionProcessor processor(&arena);
+    processor.setTransactionLogSink(nullptr);
+    processor.setProcessingContext(&context);
+    std::time_t now = 0;
+    processor.setClock([&now]() { return now; });
+
+    TransactionBatchState state(&arena);
+    state.amounts.resize(1);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        if (admitted[i] == 0) {
+            continue;
+        }
+        now = static_cast<std::time_t>(records[i].timestamp);
+        state.admitted.assign(1, true);
+        state.statuses.assign(1, TransactionStatus::REJECTED);
+        state.amounts[0] = Money(requests[i].amount);
+        processor.executeBatch(&requests[i], 1, state);
+        result.statuses[i] = state.statuses[0];
+    }
+
+    result.totalTransactionsProcessed = context.totalTransactionsProcessed.load();
+    result.totalVolumeProcessed = Money::fromCents(context.totalVolumeProcessedCents.load());
+    for (TransactionStatus status : result.statuses) {
+        const std::size_t index = static_cast<std::size_t>(status);
+        if (index < result.statusCounts.size()) {
+            result.statusCounts[index]++;
+        }
+    }
+    return result;
+}
+
+bool ReplayEngine::replayFile(const std::string& path, ReplayResult& result) {
+    // Opening a segment creates it when missing, which a replay must not do
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(path, error)) {
+        return false;
+    }
+
+    std::vector<TransactionHistoryRecord> records;
+    {
+        TransactionHistory segment(1);
+        if (!segment.openSegment(path)) {
+            return false;
+        }
+        records.reserve(segment.getSpilledCount());
+        segment.forEachTransaction(std::numeric_limits<time_t>::min(), std::numeric_limits<time_t>::max(),
+                                   [&records](const TransactionHistoryRecord& record) {
+            records.push_back(record);
+        });
+    }
+
+    result = replay(records);
+    return true;
+}
+
+std::size_t ReplayEngine::getPartitionCount() const {
+    return partitionCount;
+}
+
+std::size_t ReplayEngine::getThreadCount() const {
+    return pool.getThreadCount();
+}
@@ -0,0 +1,67 @@
+#include "ServiceCallExecutor.hpp"
+
+ServiceCallExecutor::ServiceCallExecutor(std::size_t workerCount)
+    : runningCount(0), stopRequested(false) {
+    const std::size_t count = workerCount == 0 ? 1 : workerCount;
+    workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&ServiceCallExecutor::workerLoop, this);
+    }
+}
+
+ServiceCallExecutor::~ServiceCallExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    taskAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ServiceCallExecutor::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    taskAvailable.notify_one();
+}
+
+void ServiceCallExecutor::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+        taskAvailable.wait(lock, [this]() { return stopRequested || !tasks.empty(); });
+        if (tasks.empty()) {
+            // Only reached once stopping: the queue has been fully drained
+            return;
+        }
+
+        std::function<void()> task = std::move(tasks.front());
+        tasks.pop_front();
+        runningCount++;
+        lock.unlock();
+
+        // A failing fire-and-forget call must not take the worker down
+        try {
+            task();
+        } catch (...) {
+        }
+
+        lock.lock();
+        runningCount--;
+        if (tasks.empty() && runningCount == 0) {
+            idle.notify_all();
+        }
+    }
+}
+
+void ServiceCallExecutor::drain() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [this]() { return tasks.empty() && runningCount == 0; });
+}
+
+std::size_t ServiceCallExecutor::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return tasks.size() + runningCount;
+}
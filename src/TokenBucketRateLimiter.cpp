@@ -0,0 +1,209 @@
+#include "TokenBucketRateLimiter.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+const std::size_t TokenBucketRateLimiter::MAX_PROBES;
+
+TokenBucketRateLimiter::TokenBucketRateLimiter(int capacity, double refillPerSecond, std::size_t maxAccounts,
+                                               std::chrono::steady_clock::duration idleTimeout, Clock clock)
+    : slotMask(0), capacity(std::max(capacity, 1)),
+      emissionInterval(std::max<std::int64_t>(std::llround(1e9 / refillPerSecond), 1)),
+      burstTolerance(0),
+      idleTimeout(std::chrono::duration_cast<std::chrono::nanoseconds>(idleTimeout).count()),
+      clock(clock ? std::move(clock) : Clock(&std::chrono::steady_clock::now)),
+      rejectedInsertCount(0) {
+    std::size_t slotCount = MAX_PROBES;
+    while (slotCount < 2 * maxAccounts) {
+        slotCount *= 2;
+    }
+    slotMask = slotCount - 1;
+    slots.reset(new Slot[slotCount]);
+    for (std::size_t i = 0; i < slotCount; ++i) {
+        slots[i].key.store(EMPTY_KEY, std::memory_order_relaxed);
+        slots[i].arrivalTime.store(0, std::memory_order_relaxed);
+    }
+    burstTolerance = static_cast<std::int64_t>(this->capacity - 1) * emissionInterval;
+    origin = this->clock();
+}
+
+std::uint64_t TokenBucketRateLimiter::hashKey(std::string_view accountNumber) {
+    // FNV-1a with a murmur3 finalizer, as in BlacklistIndex
+    std::uint64_t hash = 0xCBF29CE484222325ULL;
+    for (char character : accountNumber) {
+        hash ^= static_cast<unsigned char>(character);
+        hash *= 0x100000001B3ULL;
+    }
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+    return hash == EMPTY_KEY ? 1 : hash;
+}
+
+std::int64_t TokenBucketRateLimiter::now() const {
+    const std::int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock() - origin).count();
+    return std::max<std::int64_t>(elapsed, 0);
+}
+
+TokenBucketRateLimiter::Slot* TokenBucketRateLimiter::find(std::uint64_t key) const {
+    // Evicted slots become empty, so the whole probe window is searched rather than stopping at a gap
+    const std::size_t home = static_cast<std::size_t>(key) & slotMask;
+    for (std::size_t probe = 0; probe < MAX_PROBES; ++probe) {
+        Slot& slot = slots[(home + probe) & slotMask];
+        if (slot.key.load(std::memory_order_acquire) == key) {
+            return &slot;
+        }
+    }
+    return nullptr;
+}
+
+TokenBucketRateLimiter::Slot* TokenBucketRateLimiter::findOrInsert(std::uint64_t key, std::int64_t currentTime) {
+    const std::size_t home = static_cast<std::size_t>(key) & slotMask;
+    while (true) {
+        Slot* found = find(key);
+        if (found != nullptr) {
+            return found;
+        }
+
+        for (std::size_t probe = 0; probe < MAX_PROBES; ++probe) {
+            Slot& slot = slots[(home + probe) & slotMask];
+            std::uint64_t expected = EMPTY_KEY;
+            if (slot.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel) || expected == key) {
+                return &slot;
+            }
+        }
+
+        // No free slot in the window: make room by evicting idle buckets, or give up
+        bool freed = false;
+        for (std::size_t probe = 0; probe < MAX_PROBES; ++probe) {
+            freed = evictIfIdle(slots[(home + probe) & slotMask], currentTime) || freed;
+        }
+        if (!freed) {
+            rejectedInsertCount.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+}
+
+bool TokenBucketRateLimiter::evictIfIdle(Slot& slot, std::int64_t currentTime) {
+    if (slot.key.load(std::memory_order_acquire) == EMPTY_KEY) {
+        return false;
+    }
+    std::int64_t arrivalTime = slot.arrivalTime.load(std::memory_order_acquire);
+    if (arrivalTime == EVICTING || arrivalTime + idleTimeout > currentTime) {
+        return false;
+    }
+    if (!slot.arrivalTime.compare_exchange_strong(arrivalTime, EVICTING, std::memory_order_acq_rel)) {
+        return false;
+    }
+
+    // Owners that loaded the old arrival time fail their exchange against EVICTING and look again
+    slot.key.store(EMPTY_KEY, std::memory_order_release);
+    slot.arrivalTime.store(0, std::memory_order_release);
+    return true;
+}
+
+bool TokenBucketRateLimiter::consume(Slot& slot, std::uint64_t key, std::int64_t currentTime, bool& moved) {
+    moved = false;
+    std::int64_t arrivalTime = slot.arrivalTime.load(std::memory_order_acquire);
+    while (true) {
+        if (arrivalTime == EVICTING) {
+            std::this_thread::yield();
+            arrivalTime = slot.arrivalTime.load(std::memory_order_acquire);
+            continue;
+        }
+        // Checked after loading the arrival time, so the time read belongs to this account
+        if (slot.key.load(std::memory_order_acquire) != key) {
+            moved = true;
+            return false;
+        }
+
+        const std::int64_t start = std::max(arrivalTime, currentTime);
+        if (start - currentTime > burstTolerance) {
+            return false;
+        }
+        if (slot.arrivalTime.compare_exchange_weak(arrivalTime, start + emissionInterval, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+int TokenBucketRateLimiter::tokensAt(std::int64_t arrivalTime, std::int64_t currentTime) const {
+    const std::int64_t slack = burstTolerance - (std::max(arrivalTime, currentTime) - currentTime);
+    if (slack < 0) {
+        return 0;
+    }
+    return static_cast<int>(std::min<std::int64_t>(slack / emissionInterval + 1, capacity));
+}
+
+bool TokenBucketRateLimiter::checkRateLimit(const std::string& accountNumber) {
+    return getRemainingRequests(accountNumber) > 0;
+}
+
+bool TokenBucketRateLimiter::incrementRateCounter(const std::string& accountNumber) {
+    const std::uint64_t key = hashKey(accountNumber);
+    const std::int64_t currentTime = now();
+    while (true) {
+        Slot* slot = findOrInsert(key, currentTime);
+        if (slot == nullptr) {
+            return false;
+        }
+        bool moved = false;
+        const bool taken = consume(*slot, key, currentTime, moved);
+        if (!moved) {
+            return taken;
+        }
+    }
+}
+
+void TokenBucketRateLimiter::resetRateLimits(const std::string& accountNumber) {
+    const std::uint64_t key = hashKey(accountNumber);
+    Slot* slot = find(key);
+    if (slot == nullptr) {
+        return;
+    }
+    std::int64_t arrivalTime = slot->arrivalTime.load(std::memory_order_acquire);
+    while (arrivalTime != EVICTING && slot->key.load(std::memory_order_acquire) == key &&
+           !slot->arrivalTime.compare_exchange_weak(arrivalTime, 0, std::memory_order_acq_rel)) {
+    }
+}
+
+int TokenBucketRateLimiter::getRemainingRequests(const std::string& accountNumber) {
+    const std::uint64_t key = hashKey(accountNumber);
+    const Slot* slot = find(key);
+    if (slot == nullptr) {
+        return capacity;
+    }
+    const std::int64_t arrivalTime = slot->arrivalTime.load(std::memory_order_acquire);
+    if (arrivalTime == EVICTING || slot->key.load(std::memory_order_acquire) != key) {
+        return capacity;
+    }
+    return tokensAt(arrivalTime, now());
+}
+
+std::size_t TokenBucketRateLimiter::evictIdle() {
+    const std::int64_t currentTime = now();
+    std::size_t evicted = 0;
+    for (std::size_t i = 0; i <= slotMask; ++i) {
+        if (evictIfIdle(slots[i], currentTime)) {
+            ++evicted;
+        }
+    }
+    return evicted;
+}
+
+std::size_t TokenBucketRateLimiter::size() const {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i <= slotMask; ++i) {
+        if (slots[i].key.load(std::memory_order_relaxed) != EMPTY_KEY) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+std::size_t TokenBucketRateLimiter::getRejectedInsertCount() const {
+    return rejectedInsertCount.load(std::memory_order_relaxed);
+}
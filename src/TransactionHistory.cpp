@@ -0,0 +1,219 @@
+#include "TransactionHistory.hpp"
+#include <cstring>
+
+const std::size_t TransactionHistoryRecord::ACCOUNT_FIELD_SIZE;
+const std::size_t TransactionHistoryRecord::MAX_ACCOUNT_LENGTH;
+
+namespace {
+
+// Segment layout: a 64-byte header followed by densely packed TransactionHistoryRecord entries
+const char SEGMENT_MAGIC[8] = {'T', 'X', 'H', 'I', 'S', 'T', '0', '3'};
+const std::size_t SEGMENT_INITIAL_RECORDS = 4096;
+
+struct SegmentHeader {
+    char magic[8];
+    std::uint32_t recordSize;
+    std::uint32_t reserved;
+    std::uint64_t recordCount;
+    char padding[40];
+};
+
+static_assert(sizeof(SegmentHeader) == 64, "segment header must stay 64 bytes");
+static_assert(sizeof(TransactionHistoryRecord) == 112, "history record layout is part of the file format");
+
+SegmentHeader* headerOf(MappedFile& file) {
+    return reinterpret_cast<SegmentHeader*>(file.data());
+}
+
+const SegmentHeader* headerOf(const MappedFile& file) {
+    return reinterpret_cast<const SegmentHeader*>(file.data());
+}
+
+const TransactionHistoryRecord* recordsOf(const MappedFile& file) {
+    return reinterpret_cast<const TransactionHistoryRecord*>(file.data() + sizeof(SegmentHeader));
+}
+
+bool copyAccount(char* field, std::string_view account) {
+    if (account.size() > TransactionHistoryRecord::MAX_ACCOUNT_LENGTH) {
+        return false;
+    }
+    std::memcpy(field, account.data(), account.size());
+    std::memset(field + account.size(), 0, TransactionHistoryRecord::ACCOUNT_FIELD_SIZE - account.size());
+    return true;
+}
+
+} // namespace
+
+TransactionHistory::TransactionHistory(std::size_t ringCapacity, std::pmr::memory_resource* resource)
+    : ring(ringCapacity == 0 ? 1 : ringCapacity, resource), ringHead(0), ringCount(0), droppedCount(0),
+      refusedCount(0), segmentCapacity(0) {
+}
+
+TransactionHistory::~TransactionHistory() {
+    closeSegment();
+}
+
+bool TransactionHistory::openSegment(const std::string& path) {
+    closeSegment();
+
+    // Validate a non-empty existing file before mapping it writable, so foreign files are never extended
+    MappedFile existing;
+    if (existing.openReadOnly(path)) {
+        const SegmentHeader* header = headerOf(existing);
+        if (existing.size() < sizeof(SegmentHeader) ||
+            std::memcmp(header->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0) {
+            return false;
+        }
+        existing.close();
+    }
+
+    const std::size_t initialSize = sizeof(SegmentHeader) + SEGMENT_INITIAL_RECORDS * sizeof(TransactionHistoryRecord);
+    if (!segment.openReadWrite(path, initialSize)) {
+        return false;
+    }
+
+    SegmentHeader* header = headerOf(segment);
+    static const char EMPTY_MAGIC[8] = {0};
+    if (std::memcmp(header->magic, EMPTY_MAGIC, sizeof(EMPTY_MAGIC)) == 0) {
+        // Freshly created file: the mapping is zero-filled
+        std::memcpy(header->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC));
+        header->recordSize = static_cast<std::uint32_t>(sizeof(TransactionHistoryRecord));
+        header->recordCount = 0;
+    }
+
+    const std::size_t capacity = (segment.size() - sizeof(SegmentHeader)) / sizeof(TransactionHistoryRecord);
+    if (std::memcmp(header->magic, SEGMENT_MAGIC, sizeof(SEGMENT_MAGIC)) != 0 ||
+        header->recordSize != sizeof(TransactionHistoryRecord) ||
+        header->recordCount > capacity) {
+        segment.close();
+        return false;
+    }
+
+    segmentCapacity = capacity;
+    return true;
+}
+
+void TransactionHistory::closeSegment() {
+    if (segment.isOpen()) {
+        segment.sync();
+        segment.close();
+    }
+    segmentCapacity = 0;
+}
+
+bool TransactionHistory::sync() {
+    return segment.sync();
+}
+
+std::size_t TransactionHistory::segmentRecordCount() const {
+    if (!segment.isOpen()) {
+        return 0;
+    }
+    return static_cast<std::size_t>(headerOf(segment)->recordCount);
+}
+
+bool TransactionHistory::toRecord(const Transaction& transaction, const AccountSymbolTable& symbols,
+                                  TransactionHistoryRecord& record) {
+    record.id = transaction.id;
+    record.type = static_cast<std::int32_t>(transaction.type);
+    record.status = static_cast<std::int32_t>(transaction.status);
+    record.reserved = 0;
+    record.amount = transaction.amount;
+    record.timestamp = static_cast<std::int64_t>(transaction.timestamp);
+    return copyAccount(record.sourceAccount, symbols.name(transaction.sourceAccount)) &&
+           copyAccount(record.destAccount, symbols.name(transaction.destAccount));
+}
+
+bool TransactionHistory::append(const Transaction& transaction, const AccountSymbolTable& symbols) {
+    // Converted before a slot is taken, so a refused transaction evicts nothing
+    TransactionHistoryRecord record;
+    if (!toRecord(transaction, symbols, record)) {
+        refusedCount++;
+        return false;
+    }
+
+    const std::size_t capacity = ring.size();
+    std::size_t slot;
+    if (ringCount < capacity) {
+        slot = (ringHead + ringCount) % capacity;
+        ++ringCount;
+    } else {
+        // Ring is full: the oldest record leaves memory and its slot is reused
+        slot = ringHead;
+        spill(ring[slot]);
+        ringHead = (ringHead + 1) % capacity;
+    }
+    ring[slot] = record;
+    return true;
+}
+
+void TransactionHistory::spill(const TransactionHistoryRecord& record) {
+    if (!segment.isOpen()) {
+        droppedCount++;
+        return;
+    }
+
+    std::size_t count = segmentRecordCount();
+    if (count == segmentCapacity) {
+        // Grow geometrically so remapping stays amortized O(1) per record
+        const std::size_t newCapacity = segmentCapacity * 2;
+        if (!segment.resize(sizeof(SegmentHeader) + newCapacity * sizeof(TransactionHistoryRecord))) {
+            droppedCount++;
+            return;
+        }
+        segmentCapacity = newCapacity;
+    }
+
+    TransactionHistoryRecord* records =
+        reinterpret_cast<TransactionHistoryRecord*>(segment.data() + sizeof(SegmentHeader));
+    records[count] = record;
+    headerOf(segment)->recordCount = count + 1;
+}
+
+void TransactionHistory::forEachTransaction(time_t since, time_t until,
+                                            const std::function<void(const TransactionHistoryRecord&)>& callback) const {
+    const std::int64_t first = static_cast<std::int64_t>(since);
+    const std::int64_t last = static_cast<std::int64_t>(until);
+
+    const std::size_t spilled = segmentRecordCount();
+    if (spilled > 0) {
+        const TransactionHistoryRecord* records = recordsOf(segment);
+        for (std::size_t i = 0; i < spilled; ++i) {
+            if (records[i].timestamp >= first && records[i].timestamp < last) {
+                callback(records[i]);
+            }
+        }
+    }
+
+    const std::size_t capacity = ring.size();
+    for (std::size_t i = 0; i < ringCount; ++i) {
+        const TransactionHistoryRecord& record = ring[(ringHead + i) % capacity];
+        if (record.timestamp >= first && record.timestamp < last) {
+            callback(record);
+        }
+    }
+}
+
+std::size_t TransactionHistory::getRingCapacity() const {
+    return ring.size();
+}
+
+std::size_t TransactionHistory::getInMemoryCount() const {
+    return ringCount;
+}
+
+std::size_t TransactionHistory::getSpilledCount() const {
+    return segmentRecordCount();
+}
+
+std::size_t TransactionHistory::getDroppedCount() const {
+    return droppedCount;
+}
+
+std::size_t TransactionHistory::getRefusedCount() const {
+    return refusedCount;
+}
+
+std::size_t TransactionHistory::size() const {
+    return ringCount + segmentRecordCount();
+}
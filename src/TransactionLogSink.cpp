@@ -0,0 +1,156 @@
+#include "TransactionLogSink.hpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+    std::size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+void ConsoleTransactionLogSink::write(const Transaction& transaction) {
+    std::cout << "Transaction ID: " << transaction.id
+              << " Status: " << static_cast<int>(transaction.status) << std::endl;
+}
+
+void ConsoleTransactionLogSink::flush() {
+    std::cout.flush();
+}
+
+ConsoleTransactionLogSink& ConsoleTransactionLogSink::instance() {
+    static ConsoleTransactionLogSink sink;
+    return sink;
+}
+
+AsyncTransactionLogSink::AsyncTransactionLogSink(std::ostream& output, TransactionLogFormat format, std::size_t capacity)
+    : slots(roundUpToPowerOfTwo(capacity < 2 ? 2 : capacity)), mask(slots.size() - 1),
+      writeIndex(0), readIndex(0), droppedCount(0), flushTarget(0), flushedThrough(0), stopRequested(false),
+      output(output), format(format) {
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    drainThread = std::thread(&AsyncTransactionLogSink::drainLoop, this);
+}
+
+AsyncTransactionLogSink::~AsyncTransactionLogSink() {
+    stopRequested.store(true, std::memory_order_release);
+    drainThread.join();
+}
+
+void AsyncTransactionLogSink::write(const Transaction& transaction) {
+    std::size_t position = writeIndex.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+
+    for (;;) {
+        slot = &slots[position & mask];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+
+        if (difference == 0) {
+            if (writeIndex.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // Ring is full: never block the transaction path
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            position = writeIndex.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->record = TransactionLogRecord{
+        static_cast<std::int32_t>(transaction.id),
+        static_cast<std::int32_t>(transaction.type),
+        static_cast<std::int32_t>(transaction.status),
+        0,
+        transaction.amount,
+        static_cast<std::int64_t>(transaction.timestamp)
+    };
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+void AsyncTransactionLogSink::flush() {
+    // Every slot below target is claimed; it is written once published, and the flush must follow it
+    const std::size_t target = writeIndex.load(std::memory_order_acquire);
+    std::size_t requested = flushTarget.load(std::memory_order_relaxed);
+    while (requested < target &&
+           !flushTarget.compare_exchange_weak(requested, target, std::memory_order_acq_rel)) {
+    }
+
+    while (flushedThrough.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+std::size_t AsyncTransactionLogSink::getDroppedCount() const {
+    return droppedCount.load(std::memory_order_relaxed);
+}
+
+void AsyncTransactionLogSink::drainLoop() {
+    int idleRounds = 0;
+
+    for (;;) {
+        bool stopping = stopRequested.load(std::memory_order_acquire);
+        std::size_t written = drainAvailable();
+
+        // A flush covers only what was drained before it, so a waiter whose records are still being
+        // published gets another flush once they are drained
+        const std::size_t drained = readIndex.load(std::memory_order_relaxed);
+        const std::size_t flushed = flushedThrough.load(std::memory_order_relaxed);
+        if (flushTarget.load(std::memory_order_acquire) > flushed && drained > flushed) {
+            output.flush();
+            flushedThrough.store(drained, std::memory_order_release);
+        }
+
+        if (written > 0) {
+            idleRounds = 0;
+            continue;
+        }
+
+        if (stopping && readIndex.load(std::memory_order_relaxed) == writeIndex.load(std::memory_order_acquire)) {
+            output.flush();
+            return;
+        }
+
+        // Back off while the ring is empty so an idle sink costs no CPU
+        if (++idleRounds < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+        }
+    }
+}
+
+std::size_t AsyncTransactionLogSink::drainAvailable() {
+    std::size_t written = 0;
+    std::size_t position = readIndex.load(std::memory_order_relaxed);
+
+    for (;;) {
+        Slot& slot = slots[position & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            break;
+        }
+
+        writeRecord(slot.record);
+        slot.sequence.store(position + mask + 1, std::memory_order_release);
+        readIndex.store(++position, std::memory_order_release);
+        ++written;
+    }
+
+    return written;
+}
+
+void AsyncTransactionLogSink::writeRecord(const TransactionLogRecord& record) {
+    if (format == TransactionLogFormat::BINARY) {
+        output.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    } else {
+        output << "Transaction ID: " << record.id << " Status: " << record.status << '\n';
+    }
+}
@@ -1,21 +1,37 @@
 #include "TransactionProcessor.hpp"
+#include "BatchedAuditWriter.hpp"
+#include "BlacklistIndex.hpp"
 #include "ExternalServices.hpp"
-#include <iostream>
+#include "Instrumentation.hpp"
+#include "ProcessingContext.hpp"
+#include "TransactionLogSink.hpp"
+#include "WindowedRateLimiter.hpp"
 #include <cmath>
-
-// Global variables
-int g_totalTransactionsProcessed = 0;
-double g_totalVolumeProcessed = 0.0;
-bool g_systemLocked = false;
+#include <string_view>
+#include <unordered_map>
 
 // Static member initialization
-int TransactionProcessor::transactionCounter = 1000;
-const double TransactionProcessor::MIN_TRANSACTION_AMOUNT = 0.01;
-const double TransactionProcessor::MAX_TRANSACTION_AMOUNT = 1000000.0;
+std::atomic<int> TransactionProcessor::transactionCounter(1000);
 const int TransactionProcessor::MAX_DAILY_TRANSACTIONS = 1000;
 
-TransactionProcessor::TransactionProcessor() 
-    : dailyVolume(0.0), dailyTransactionCount(0), complianceService(nullptr), auditService(nullptr) {
+namespace {
+
+int nextTransactionId(std::atomic<int>& counter) {
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+} // namespace
+
+TransactionBatchState::TransactionBatchState(std::pmr::memory_resource* resource)
+    : amounts(resource), admitted(resource) {
+}
+
+TransactionProcessor::TransactionProcessor(std::pmr::memory_resource* upstream)
+    : clock([]() { return time(nullptr); }), processorMemory(upstream),
+      transactionHistory(TransactionHistory::DEFAULT_RING_CAPACITY, &processorMemory),
+      complianceService(nullptr), auditService(nullptr), auditWriter(nullptr), blacklistIndex(nullptr), accountLimiter(nullptr),
+      rateLimitingService(nullptr), logSink(&ConsoleTransactionLogSink::instance()),
+      context(&ProcessingContext::global()), auditText(&processorMemory) {
 }
 
 TransactionProcessor::~TransactionProcessor() {
@@ -29,27 +45,65 @@ void TransactionProcessor::setAuditService(AuditLoggingService* service) {
     auditService = service;
 }
 
-bool TransactionProcessor::validateTransaction(double amount, TransactionType type) {
-    // Complex MCDC condition 1: Amount and Type validation
-    if (amount < MIN_TRANSACTION_AMOUNT) {
-        return false;
-    } else if (amount > MAX_TRANSACTION_AMOUNT) {
-        return false;
-    } else if (type == TransactionType::WITHDRAWAL && amount > 50000.0) {
-        // Special rule for large withdrawals
-        return false;
-    } else if (type == TransactionType::REFUND && amount > 10000.0) {
-        // Refunds have lower limits
-        return false;
-    } else {
-        return true;
-    }
+void TransactionProcessor::setAuditWriter(BatchedAuditWriter* writer) {
+    auditWriter = writer;
+}
+
+void TransactionProcessor::setBlacklistIndex(const BlacklistIndex* index) {
+    blacklistIndex = index;
+}
+
+void TransactionProcessor::setAccountLimiter(WindowedRateLimiter* limiter) {
+    accountLimiter = limiter;
+}
+
+void TransactionProcessor::setRateLimitingService(RateLimitingService* service) {
+    rateLimitingService = service;
+}
+
+void TransactionProcessor::setClock(Clock clock) {
+    this->clock = clock ? std::move(clock) : Clock([]() { return time(nullptr); });
+}
+
+void TransactionProcessor::setTransactionLogSink(TransactionLogSink* sink) {
+    logSink = sink;
+}
+
+void TransactionProcessor::setProcessingContext(ProcessingContext* processingContext) {
+    context = processingContext != nullptr ? processingContext : &ProcessingContext::global();
+}
+
+ProcessingContext& TransactionProcessor::getProcessingContext() const {
+    return *context;
+}
+
+bool TransactionProcessor::validateTransaction(double amount, TransactionType type, AccountType product) const {
+    // The raw amount against the bounds in units, so every boundary behaves as the double comparisons did
+    const TransactionRule& rule = transactionRule(product, type);
+    return !(amount < rule.minAmount.toDouble()) && !(amount > rule.maxAmount.toDouble());
+}
+
+bool TransactionProcessor::validateTransaction(Money amount, TransactionType type, AccountType product) const {
+    // One table lookup replaces the per-type ladder; the batch kernels read the same table
+    const TransactionRule& rule = transactionRule(product, type);
+    return amount >= rule.minAmount && amount <= rule.maxAmount;
 }
 
 TransactionStatus TransactionProcessor::executeTransfer(double amount, 
                                                         const std::string& source,
                                                         const std::string& destination,
                                                         bool isUrgent) {
+    const ScopedLatencyTimer timer(LatencyMetric::EXECUTE_TRANSFER);
+    return countedOutcome(decideTransfer(Money(amount), source, destination, isUrgent, dailyUsage.load(clock())));
+}
+
+TransactionStatus TransactionProcessor::decideTransfer(Money amount, 
+                                                       const std::string& source,
+                                                       const std::string& destination,
+                                                       bool isUrgent,
+                                                       const DailyUsage& usage) const {
+    const Money volumeAfter = Money::fromCents(usage.volumeCents) + amount;
+    
     // Complex MCDC condition 2-5: Multi-condition transfer logic
     if (source.empty() || destination.empty()) {
         return TransactionStatus::REJECTED;
@@ -57,7 +111,7 @@ TransactionStatus TransactionProcessor::executeTransfer(double amount,
     
     // Condition 2: Check if accounts are same
     if (source == destination) {
-        if (amount > 0.0) {
+        if (amount > Money()) {
             return TransactionStatus::REJECTED;
         } else {
             return TransactionStatus::CANCELLED;
@@ -65,137 +119,453 @@ TransactionStatus TransactionProcessor::executeTransfer(double amount,
     }
     
     // Condition 3: Urgent transfer rules
-    if (isUrgent && amount > 100000.0) {
-        if (dailyTransactionCount >= MAX_DAILY_TRANSACTIONS) {
+    if (isUrgent && amount > URGENT_TRANSFER_THRESHOLD) {
+        if (usage.transactionCount >= MAX_DAILY_TRANSACTIONS) {
             return TransactionStatus::REJECTED;
-        } else if (dailyVolume + amount > 5000000.0) {
+        } else if (volumeAfter > MAX_DAILY_VOLUME) {
             return TransactionStatus::REJECTED;
         }
     }
     
     // Condition 4: System lock check
-    if (g_systemLocked && !isUrgent) {
+    const bool systemLocked = context->systemLocked.load(std::memory_order_relaxed);
+    if (systemLocked && !isUrgent) {
         return TransactionStatus::PENDING;
-    } else if (g_systemLocked && isUrgent) {
+    } else if (systemLocked && isUrgent) {
         return TransactionStatus::APPROVED;
     }
     
     // Condition 5: Final validation before execution
-    if (amount > 0.0 && 
-        dailyTransactionCount < MAX_DAILY_TRANSACTIONS && 
-        dailyVolume + amount <= 5000000.0) {
+    if (amount > Money() && 
+        usage.transactionCount < MAX_DAILY_TRANSACTIONS && 
+        volumeAfter <= MAX_DAILY_VOLUME) {
         return TransactionStatus::COMPLETED;
-    } else if (amount > 0.0 && dailyTransactionCount < MAX_DAILY_TRANSACTIONS) {
+    } else if (amount > Money() && usage.transactionCount < MAX_DAILY_TRANSACTIONS) {
         return TransactionStatus::APPROVED;
-    } else if (amount > 0.0) {
+    } else if (amount > Money()) {
         return TransactionStatus::PENDING;
     } else {
         return TransactionStatus::CANCELLED;
     }
 }
 
-TransactionStatus TransactionProcessor::processTransaction(TransactionType type, 
-                                                           double amount, 
-                                                           const std::string& sourceAccount,
-                                                           const std::string& destAccount) {
-    // Validation phase
-    if (!validateTransaction(amount, type)) {
-        return TransactionStatus::REJECTED;
+bool TransactionProcessor::isBlockedByCompliance(ComplianceLevel complianceLevel, Money amount) const {
+    if (complianceLevel == ComplianceLevel::BLOCKED) {
+        return true;
     }
     
-    // Check compliance using stub service (must be mocked in tests)
-    if (complianceService != nullptr) {
-        ComplianceLevel complianceLevel = complianceService->checkComplianceLevel(sourceAccount);
-        if (complianceLevel == ComplianceLevel::BLOCKED) {
-            return TransactionStatus::REJECTED;
-        }
-        
-        if (complianceLevel == ComplianceLevel::HIGH_RISK && amount > 50000.0) {
-            return TransactionStatus::REJECTED;
-        }
+    if (complianceLevel == ComplianceLevel::HIGH_RISK && amount > HIGH_RISK_LIMIT) {
+        return true;
     }
     
-    // Process based on type
+    return false;
+}
+
+TransactionStatus TransactionProcessor::decideTransaction(const TransactionRule& rule, 
+                                                          Money amount, 
+                                                          const std::string& sourceAccount,
+                                                          const std::string& destAccount,
+                                                          bool isUrgent,
+                                                          const DailyUsage& usage,
+                                                          bool& addsVolume) const {
     TransactionStatus status = TransactionStatus::PENDING;
+    addsVolume = false;
     
-    if (type == TransactionType::TRANSFER) {
-        status = executeTransfer(amount, sourceAccount, destAccount, false);
-    } else if (type == TransactionType::DEPOSIT) {
-        if (amount > 0.0 && dailyTransactionCount < MAX_DAILY_TRANSACTIONS) {
-            status = TransactionStatus::COMPLETED;
-            dailyVolume += amount;
-            g_totalVolumeProcessed += amount;
+    // The amount bounds of the rule were checked by validateTransaction
+    if (rule.handling == TransactionHandling::TRANSFER) {
+        // Counted transfers are capped like DAILY_LIMITED ones; decideTransfer alone would leave them PENDING
+        if (usage.transactionCount < MAX_DAILY_TRANSACTIONS) {
+            status = decideTransfer(amount, sourceAccount, destAccount, isUrgent, usage);
         } else {
             status = TransactionStatus::REJECTED;
         }
-    } else if (type == TransactionType::WITHDRAWAL) {
-        if (amount > 0.0 && amount <= 50000.0 && dailyTransactionCount < MAX_DAILY_TRANSACTIONS) {
+    } else if (rule.handling == TransactionHandling::DAILY_LIMITED) {
+        if (amount > Money() && usage.transactionCount < MAX_DAILY_TRANSACTIONS) {
             status = TransactionStatus::COMPLETED;
-            dailyVolume += amount;
-        } else if (dailyTransactionCount >= MAX_DAILY_TRANSACTIONS) {
-            status = TransactionStatus::REJECTED;
+            addsVolume = rule.addsDailyVolume;
         } else {
-            status = TransactionStatus::PENDING;
+            status = TransactionStatus::REJECTED;
         }
-    } else if (type == TransactionType::REFUND) {
-        if (amount > 0.0 && amount <= 10000.0) {
+    } else if (rule.handling == TransactionHandling::UNLIMITED) {
+        if (amount > Money()) {
             status = TransactionStatus::COMPLETED;
-        } else if (amount > 10000.0) {
-            status = TransactionStatus::PENDING;
+            addsVolume = rule.addsDailyVolume;
         }
     } else {
         status = TransactionStatus::CANCELLED;
     }
     
-    // Log and update counters
+    return status;
+}
+
+TransactionStatus TransactionProcessor::dispatchTransaction(TransactionType type, 
+                                                            const TransactionRule& rule,
+                                                            Money amount, 
+                                                            const std::string& sourceAccount,
+                                                            const std::string& destAccount,
+                                                            std::time_t timestamp,
+                                                            bool isUrgent,
+                                                            const TransferApplier* apply) {
+    const std::int64_t amountCents = amount.toCents();
+    
+    // The account window is reserved first and given back if the instance limits refuse
+    if (accountLimiter != nullptr && !accountLimiter->tryAcquire(sourceAccount, timestamp, amountCents)) {
+        return TransactionStatus::REJECTED;
+    }
+    
+    // A timestamp older than the days kept cannot be checked against its day's limits
+    DailyUsageCounter* const dayCounter = dailyUsage.counterFor(timestamp);
+    if (dayCounter == nullptr) {
+        if (accountLimiter != nullptr) {
+            accountLimiter->release(sourceAccount, timestamp, amountCents);
+        }
+        return TransactionStatus::REJECTED;
+    }
+    DailyUsageCounter& counter = *dayCounter;
+    DailyUsage usage = counter.load();
+    
+    // Reserve-then-commit in one step: decide on a snapshot and publish the counted usage only if
+    // nobody changed it meanwhile, otherwise decide again on the usage that won
+    while (true) {
+        bool addsVolume = false;
+        TransactionStatus status = decideTransaction(rule, amount, sourceAccount, destAccount, isUrgent, usage,
+                                                     addsVolume);
+        DailyUsage counted{usage.transactionCount + 1, usage.volumeCents + (addsVolume ? amountCents : 0)};
+        if (!DailyUsageCounter::fits(counted)) {
+            status = TransactionStatus::REJECTED;
+        }
+        if (status == TransactionStatus::REJECTED || status == TransactionStatus::CANCELLED) {
+            if (accountLimiter != nullptr) {
+                accountLimiter->release(sourceAccount, timestamp, amountCents);
+            }
+            return status;
+        }
+        
+        if (counter.compareExchange(usage, counted)) {
+            // The usage stays reserved while the transaction is applied, so a refusal can give it back
+            if (status == TransactionStatus::COMPLETED && apply != nullptr && !(*apply)()) {
+                releaseDailyUsage(counter, DailyUsage{1, counted.volumeCents - usage.volumeCents});
+                if (accountLimiter != nullptr) {
+                    accountLimiter->release(sourceAccount, timestamp, amountCents);
+                }
+                return TransactionStatus::REJECTED;
+            }
+            if (type == TransactionType::DEPOSIT) {
+                context->totalVolumeProcessedCents.fetch_add(amountCents, std::memory_order_relaxed);
+            }
+            context->totalTransactionsProcessed.fetch_add(1, std::memory_order_relaxed);
+            return status;
+        }
+    }
+}
+
+void TransactionProcessor::releaseDailyUsage(DailyUsageCounter& counter, const DailyUsage& counted) {
+    DailyUsage usage = counter.load();
+    while (true) {
+        const DailyUsage released{usage.transactionCount - counted.transactionCount,
+                                  usage.volumeCents - counted.volumeCents};
+        if (!DailyUsageCounter::fits(released) || counter.compareExchange(usage, released)) {
+            return;
+        }
+    }
+}
+
+TransactionStatus TransactionProcessor::runTransaction(TransactionType type, 
+                                                       double amount, 
+                                                       const std::string& sourceAccount,
+                                                       const std::string& destAccount,
+                                                       AccountType sourceAccountType,
+                                                       bool isUrgent,
+                                                       const TransferApplier* apply) {
+    // Validation phase; from here on the amount is in cents, rounded to the nearest one
+    if (!validateTransaction(amount, type, sourceAccountType)) {
+        return TransactionStatus::REJECTED;
+    }
+    const Money cents(amount);
+    
+    // Blacklisted sources are rejected locally; clean ones are answered by the filter alone
+    if (blacklistIndex != nullptr && blacklistIndex->contains(sourceAccount)) {
+        return TransactionStatus::REJECTED;
+    }
+    
+    // Throttled sources are rejected before any remote call is spent on them
+    if (rateLimitingService != nullptr && !timedServiceCall(LatencyMetric::RATE_LIMIT_INCREMENT, [&]() {
+            return rateLimitingService->incrementRateCounter(sourceAccount);
+        })) {
+        return TransactionStatus::REJECTED;
+    }
+    
+    // Check compliance using stub service (must be mocked in tests)
+    if (complianceService != nullptr) {
+        ComplianceLevel complianceLevel = timedServiceCall(LatencyMetric::COMPLIANCE_CHECK, [&]() {
+            return complianceService->checkComplianceLevel(sourceAccount);
+        });
+        if (isBlockedByCompliance(complianceLevel, cents)) {
+            return TransactionStatus::REJECTED;
+        }
+    }
+    
+    // Process based on type
+    const std::time_t timestamp = clock();
+    TransactionStatus status = dispatchTransaction(type, transactionRule(sourceAccountType, type), cents,
+                                                   sourceAccount, destAccount, timestamp, isUrgent, apply);
+    
+    // Log the counted transaction
     if (status != TransactionStatus::REJECTED && status != TransactionStatus::CANCELLED) {
-        logTransaction(Transaction{
-            ++transactionCounter,
+        Transaction transaction{
+            nextTransactionId(transactionCounter),
             type,
-            amount,
-            sourceAccount,
-            destAccount,
-            time(nullptr),
+            cents,
+            AccountSymbolTable::EMPTY_ACCOUNT,
+            AccountSymbolTable::EMPTY_ACCOUNT,
+            timestamp,
             status
-        });
-        
-        dailyTransactionCount++;
-        g_totalTransactionsProcessed++;
+        };
+        recordTransaction(transaction, sourceAccount, destAccount);
+        auditTransaction(transaction, sourceAccount);
     }
     
     return status;
 }
 
+TransactionStatus TransactionProcessor::processTransaction(TransactionType type, 
+                                                           double amount, 
+                                                           const std::string& sourceAccount,
+                                                           const std::string& destAccount,
+                                                           AccountType sourceAccountType) {
+    const ScopedLatencyTimer timer(LatencyMetric::PROCESS_TRANSACTION);
+    return countedOutcome(runTransaction(type, amount, sourceAccount, destAccount, sourceAccountType, false, nullptr));
+}
+
+TransactionStatus TransactionProcessor::processTransfer(double amount, 
+                                                        const std::string& source,
+                                                        const std::string& destination,
+                                                        bool isUrgent,
+                                                        const TransferApplier& apply,
+                                                        AccountType sourceAccountType) {
+    const ScopedLatencyTimer timer(LatencyMetric::EXECUTE_TRANSFER);
+    return countedOutcome(runTransaction(TransactionType::TRANSFER, amount, source, destination, sourceAccountType,
+                                         isUrgent, &apply));
+}
+
+std::vector<TransactionStatus> TransactionProcessor::processBatch(const TransactionRequest* requests, 
+                                                                  std::size_t count) {
+    // The scratch comes from the pool of this thread, so repeated batches reuse it
+    TransactionBatchState state(ThreadScratchPool::local());
+    validateBatch(requests, count, state);
+    screenBatch(requests, count, state);
+    executeBatch(requests, count, state);
+    return std::move(state.statuses);
+}
+
+void TransactionProcessor::validateBatch(const TransactionRequest* requests, std::size_t count, 
+                                         TransactionBatchState& state) const {
+    state.amounts.resize(count);
+    state.admitted.assign(count, false);
+    state.statuses.assign(count, TransactionStatus::REJECTED);
+    for (std::size_t i = 0; i < count; ++i) {
+        state.admitted[i] = validateTransaction(requests[i].amount, requests[i].type, requests[i].sourceAccountType);
+        state.amounts[i] = Money(requests[i].amount);
+    }
+}
+
+void TransactionProcessor::screenBatch(const TransactionRequest* requests, std::size_t count, 
+                                       TransactionBatchState& state) {
+    // Drop locally blacklisted sources and rate-limit the rest in input order
+    for (std::size_t i = 0; i < count; ++i) {
+        state.admitted[i] = state.admitted[i] &&
+                            (blacklistIndex == nullptr || !blacklistIndex->contains(requests[i].sourceAccount)) &&
+                            (rateLimitingService == nullptr ||
+                             timedServiceCall(LatencyMetric::RATE_LIMIT_INCREMENT, [&]() {
+                                 return rateLimitingService->incrementRateCounter(requests[i].sourceAccount);
+                             }));
+    }
+    if (complianceService == nullptr) {
+        return;
+    }
+    
+    // One compliance lookup per distinct source account of an admitted request
+    // Keyed by views of the request strings, which outlive the map
+    std::pmr::unordered_map<std::string_view, ComplianceLevel> complianceLevels(ThreadScratchPool::local());
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!state.admitted[i]) {
+            continue;
+        }
+        auto level = complianceLevels.find(requests[i].sourceAccount);
+        if (level == complianceLevels.end()) {
+            level = complianceLevels.emplace(requests[i].sourceAccount,
+                                             timedServiceCall(LatencyMetric::COMPLIANCE_CHECK, [&]() {
+                                                 return complianceService->checkComplianceLevel(requests[i].sourceAccount);
+                                             })).first;
+        }
+        state.admitted[i] = !isBlockedByCompliance(level->second, state.amounts[i]);
+    }
+}
+
+void TransactionProcessor::executeBatch(const TransactionRequest* requests, std::size_t count, 
+                                        TransactionBatchState& state) {
+    // Execute in input order so the daily limits cut off exactly as sequential calls would
+    const bool directAudit = auditWriter == nullptr && auditService != nullptr;
+    std::unique_lock<std::mutex> auditLock(auditMutex, std::defer_lock);
+    if (directAudit) {
+        auditLock.lock();
+        auditEntries.clear();
+        reserveAuditText(count);
+    }
+    
+    for (std::size_t i = 0; i < count; ++i) {
+        const TransactionRequest& request = requests[i];
+        if (!state.admitted[i]) {
+            continue;
+        }
+        
+        const std::time_t timestamp = clock();
+        TransactionStatus status = dispatchTransaction(request.type,
+                                                       transactionRule(request.sourceAccountType, request.type),
+                                                       state.amounts[i], 
+                                                       request.sourceAccount, request.destAccount, timestamp);
+        state.statuses[i] = status;
+        
+        if (status != TransactionStatus::REJECTED && status != TransactionStatus::CANCELLED) {
+            Transaction transaction{
+                nextTransactionId(transactionCounter),
+                request.type,
+                state.amounts[i],
+                AccountSymbolTable::EMPTY_ACCOUNT,
+                AccountSymbolTable::EMPTY_ACCOUNT,
+                timestamp,
+                status
+            };
+            recordTransaction(transaction, request.sourceAccount, request.destAccount);
+            if (auditWriter != nullptr) {
+                auditWriter->submit(makeAuditRecord(transaction), request.sourceAccount, auditDurability(transaction));
+            } else if (directAudit) {
+                auditEntries.push_back(makeAuditEntry(transaction, request.sourceAccount, auditEntries.size()));
+            }
+        }
+    }
+    
+    // A single bulk audit emit for the batch
+    if (directAudit && !auditEntries.empty()) {
+        timedServiceCall(LatencyMetric::AUDIT_LOG, [&]() { return auditService->logTransactionBatch(auditEntries); });
+    }
+    
+    for (TransactionStatus status : state.statuses) {
+        countedOutcome(status);
+    }
+}
+
+std::vector<TransactionStatus> TransactionProcessor::processBatch(const std::vector<TransactionRequest>& requests) {
+    return processBatch(requests.data(), requests.size());
+}
+
+void TransactionProcessor::recordTransaction(Transaction& transaction, std::string_view sourceAccount,
+                                             std::string_view destAccount) {
+    // Interning under the history lock costs no extra lock per transaction
+    std::lock_guard<std::mutex> lock(historyMutex);
+    transaction.sourceAccount = accountSymbols.intern(sourceAccount);
+    transaction.destAccount = accountSymbols.intern(destAccount);
+    transactionHistory.append(transaction, accountSymbols);
+    if (logSink != nullptr) {
+        logSink->write(transaction);
+    }
+}
+
+std::string_view TransactionProcessor::recordTransaction(const Transaction& transaction) {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    transactionHistory.append(transaction, accountSymbols);
+    if (logSink != nullptr) {
+        logSink->write(transaction);
+    }
+    return accountSymbols.name(transaction.sourceAccount);
+}
+
+void TransactionProcessor::reserveAuditText(std::size_t entryCount) {
+    // Grow only: in steady state the buffer is reused and views into it stay put during a batch
+    if (auditText.size() < entryCount * BatchedAuditWriter::ENTRY_TEXT_SIZE) {
+        auditText.resize(entryCount * BatchedAuditWriter::ENTRY_TEXT_SIZE);
+    }
+    if (auditEntries.capacity() < entryCount) {
+        auditEntries.reserve(entryCount);
+    }
+}
+
+AuditEntry TransactionProcessor::makeAuditEntry(const Transaction& transaction, std::string_view sourceAccount,
+                                                std::size_t textSlot) {
+    return BatchedAuditWriter::formatEntry(makeAuditRecord(transaction), sourceAccount,
+                                           &auditText[textSlot * BatchedAuditWriter::ENTRY_TEXT_SIZE]);
+}
+
+AuditRecord TransactionProcessor::makeAuditRecord(const Transaction& transaction) {
+    return BatchedAuditWriter::makeRecord(transaction, time(nullptr));
+}
+
+AuditDurability TransactionProcessor::auditDurability(const Transaction& transaction) {
+    return transaction.amount > URGENT_TRANSFER_THRESHOLD ? AuditDurability::DURABLE : AuditDurability::THROUGHPUT;
+}
+
 void TransactionProcessor::logTransaction(const Transaction& transaction) {
-    transactionHistory.push_back(transaction);
-    std::cout << "Transaction ID: " << transaction.id 
-              << " Status: " << static_cast<int>(transaction.status) << std::endl;
+    auditTransaction(transaction, recordTransaction(transaction));
+}
+
+void TransactionProcessor::auditTransaction(const Transaction& transaction, std::string_view sourceAccount) {
+    if (auditWriter != nullptr) {
+        auditWriter->submit(makeAuditRecord(transaction), sourceAccount, auditDurability(transaction));
+        return;
+    }
     
     // Call stub/mock functions from ExternalServices
     // These functions are declared but not implemented - test framework must provide mocks
     if (auditService != nullptr) {
         // This is a stub function call - must be mocked in tests
-        auditService->logTransaction(transaction.sourceAccount, 
-                                     std::to_string(transaction.amount), 
-                                     std::to_string(time(nullptr)));
-        
-        // Another stub function call
-        auditService->logAccountEvent(transaction.sourceAccount,
-                                     "TRANSACTION_PROCESSED",
-                                     "Transaction: " + std::to_string(transaction.id));
+        std::lock_guard<std::mutex> lock(auditMutex);
+        reserveAuditText(1);
+        timedServiceCall(LatencyMetric::AUDIT_LOG, [&]() {
+            return auditService->logTransactionEntry(makeAuditEntry(transaction, sourceAccount, 0));
+        });
     }
 }
 
 bool TransactionProcessor::resetDailyLimits() {
-    dailyVolume = 0.0;
-    dailyTransactionCount = 0;
+    dailyUsage.reset();
     return true;
 }
 
 double TransactionProcessor::getDailyVolume() const {
-    return dailyVolume;
+    return Money::fromCents(dailyUsage.load(clock()).volumeCents).toDouble();
 }
 
 int TransactionProcessor::getTransactionCount() const {
-    return dailyTransactionCount;
+    return dailyUsage.load(clock()).transactionCount;
+}
+
+int TransactionProcessor::getMaxDailyTransactions() {
+    return MAX_DAILY_TRANSACTIONS;
+}
+
+TransactionHistory& TransactionProcessor::getTransactionHistory() {
+    return transactionHistory;
+}
+
+const TransactionHistory& TransactionProcessor::getTransactionHistory() const {
+    return transactionHistory;
+}
+
+AccountSymbol TransactionProcessor::internAccount(std::string_view accountNumber) {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return accountSymbols.intern(accountNumber);
+}
+
+std::string_view TransactionProcessor::getAccountName(AccountSymbol symbol) const {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return accountSymbols.name(symbol);
+}
+
+std::size_t TransactionProcessor::getAccountSymbolCount() const {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return accountSymbols.size();
+}
+
+AllocationStats TransactionProcessor::getAllocationStats() const {
+    return processorMemory.getStats();
 }
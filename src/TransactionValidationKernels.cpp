@@ -0,0 +1,296 @@
+#include "TransactionProcessor.hpp"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    #define TRANSACTION_VALIDATION_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define TRANSACTION_VALIDATION_TARGET_AVX2
+    #else
+        #define TRANSACTION_VALIDATION_TARGET_AVX2 __attribute__((target("avx2")))
+    #endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    #define TRANSACTION_VALIDATION_NEON 1
+    #include <arm_neon.h>
+#endif
+
+namespace {
+
+static_assert(sizeof(Money) == sizeof(std::int64_t), "the Money kernels load amounts as 64-bit integers");
+
+// Per-row amount bounds of a rule table, laid out for lane-wise lookups by rule index
+struct CentBounds {
+    std::int64_t minCents[TRANSACTION_RULE_COUNT];
+    std::int64_t maxCents[TRANSACTION_RULE_COUNT];
+};
+
+struct DoubleBounds {
+    double minAmount[TRANSACTION_RULE_COUNT];
+    double maxAmount[TRANSACTION_RULE_COUNT];
+};
+
+CentBounds centBoundsOf(const TransactionRuleTable& rules) {
+    CentBounds bounds;
+    for (std::size_t row = 0; row < TRANSACTION_RULE_COUNT; ++row) {
+        bounds.minCents[row] = rules[row].minAmount.toCents();
+        bounds.maxCents[row] = rules[row].maxAmount.toCents();
+    }
+    return bounds;
+}
+
+// Bounds in units, the same doubles validateTransaction compares a raw amount against
+DoubleBounds doubleBoundsOf(const TransactionRuleTable& rules) {
+    DoubleBounds bounds;
+    for (std::size_t row = 0; row < TRANSACTION_RULE_COUNT; ++row) {
+        bounds.minAmount[row] = rules[row].minAmount.toDouble();
+        bounds.maxAmount[row] = rules[row].maxAmount.toDouble();
+    }
+    return bounds;
+}
+
+#if defined(TRANSACTION_VALIDATION_X86)
+bool cpuSupportsAvx2() {
+#if defined(_MSC_VER) && !defined(__clang__)
+    int registers[4];
+    __cpuid(registers, 1);
+    const bool osSavesYmm = (registers[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+    const bool hasAvx = (registers[2] & (1 << 28)) != 0;
+    __cpuidex(registers, 7, 0);
+    return osSavesYmm && hasAvx && (registers[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+ValidationKernel detectValidationKernel() {
+#if defined(TRANSACTION_VALIDATION_X86)
+    if (cpuSupportsAvx2()) {
+        return ValidationKernel::AVX2;
+    }
+#elif defined(TRANSACTION_VALIDATION_NEON)
+    return ValidationKernel::NEON;
+#endif
+    return ValidationKernel::SCALAR;
+}
+
+bool isKernelAvailable(ValidationKernel kernel) {
+    if (kernel == ValidationKernel::SCALAR) {
+        return true;
+    }
+    return kernel == TransactionProcessor::getValidationKernel();
+}
+
+} // namespace
+
+ValidationKernel TransactionProcessor::getValidationKernel() {
+    static const ValidationKernel kernel = detectValidationKernel();
+    return kernel;
+}
+
+void TransactionProcessor::validateTransactionBatch(const double* amounts, const TransactionType* types,
+                                                    std::size_t count, std::uint64_t* validMask) {
+    validateTransactionBatch(amounts, types, count, validMask, getValidationKernel());
+}
+
+void TransactionProcessor::validateTransactionBatch(const double* amounts, const TransactionType* types,
+                                                    std::size_t count, std::uint64_t* validMask,
+                                                    ValidationKernel kernel, AccountType product) {
+    const TransactionRuleTable& rules = TRANSACTION_POLICIES[accountRuleIndex(product)];
+    std::memset(validMask, 0, ((count + 63) / 64) * sizeof(std::uint64_t));
+
+    if (!isKernelAvailable(kernel)) {
+        kernel = ValidationKernel::SCALAR;
+    }
+
+    if (kernel == ValidationKernel::AVX2) {
+        validateBatchAvx2(amounts, types, count, validMask, rules);
+    } else if (kernel == ValidationKernel::NEON) {
+        validateBatchNeon(amounts, types, count, validMask, rules);
+    } else {
+        validateBatchScalar(amounts, types, 0, count, validMask, rules);
+    }
+}
+
+void TransactionProcessor::validateTransactionBatch(const Money* amounts, const TransactionType* types,
+                                                    std::size_t count, std::uint64_t* validMask) {
+    validateTransactionBatch(amounts, types, count, validMask, getValidationKernel());
+}
+
+void TransactionProcessor::validateTransactionBatch(const Money* amounts, const TransactionType* types,
+                                                    std::size_t count, std::uint64_t* validMask,
+                                                    ValidationKernel kernel, AccountType product) {
+    const TransactionRuleTable& rules = TRANSACTION_POLICIES[accountRuleIndex(product)];
+    std::memset(validMask, 0, ((count + 63) / 64) * sizeof(std::uint64_t));
+
+    if (!isKernelAvailable(kernel)) {
+        kernel = ValidationKernel::SCALAR;
+    }
+
+    if (kernel == ValidationKernel::AVX2) {
+        validateBatchAvx2(amounts, types, count, validMask, rules);
+    } else if (kernel == ValidationKernel::NEON) {
+        validateBatchNeon(amounts, types, count, validMask, rules);
+    } else {
+        validateBatchScalar(amounts, types, 0, count, validMask, rules);
+    }
+}
+
+void TransactionProcessor::validateBatchScalar(const double* amounts, const TransactionType* types,
+                                               std::size_t begin, std::size_t end, std::uint64_t* validMask,
+                                               const TransactionRuleTable& rules) {
+    const DoubleBounds bounds = doubleBoundsOf(rules);
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::size_t row = transactionRuleIndex(types[i]);
+
+        // Same comparisons as validateTransaction, so NaN and the boundaries behave identically
+        const bool valid = !(amounts[i] < bounds.minAmount[row]) & !(amounts[i] > bounds.maxAmount[row]);
+        validMask[i / 64] |= static_cast<std::uint64_t>(valid) << (i % 64);
+    }
+}
+
+void TransactionProcessor::validateBatchScalar(const Money* amounts, const TransactionType* types,
+                                               std::size_t begin, std::size_t end, std::uint64_t* validMask,
+                                               const TransactionRuleTable& rules) {
+    const CentBounds bounds = centBoundsOf(rules);
+
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::int64_t cents = amounts[i].toCents();
+        const std::size_t row = transactionRuleIndex(types[i]);
+
+        const bool valid = (cents >= bounds.minCents[row]) & (cents <= bounds.maxCents[row]);
+        validMask[i / 64] |= static_cast<std::uint64_t>(valid) << (i % 64);
+    }
+}
+
+#if defined(TRANSACTION_VALIDATION_X86)
+TRANSACTION_VALIDATION_TARGET_AVX2
+void TransactionProcessor::validateBatchAvx2(const double* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    const DoubleBounds bounds = doubleBoundsOf(rules);
+    const __m128i lastRow = _mm_set1_epi32(static_cast<int>(TRANSACTION_RULE_COUNT - 1));
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d allLanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d amount = _mm256_loadu_pd(amounts + i);
+        // Unsigned minimum maps every value outside the enum to the last row, as transactionRuleIndex does
+        const __m128i row = _mm_min_epu32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(types + i)), lastRow);
+        // The masked form with an explicit source, which the unmasked one leaves uninitialized
+        const __m256d minAmount = _mm256_mask_i32gather_pd(zero, bounds.minAmount, row, allLanes, sizeof(double));
+        const __m256d maxAmount = _mm256_mask_i32gather_pd(zero, bounds.maxAmount, row, allLanes, sizeof(double));
+
+        // Ordered, non-signalling compares: NaN fails every test and ends up valid, as in the scalar rules
+        const __m256d invalid = _mm256_or_pd(_mm256_cmp_pd(amount, minAmount, _CMP_LT_OQ),
+                                             _mm256_cmp_pd(amount, maxAmount, _CMP_GT_OQ));
+
+        const std::uint64_t validBits = static_cast<std::uint64_t>(~_mm256_movemask_pd(invalid) & 0xF);
+        validMask[i / 64] |= validBits << (i % 64);
+    }
+
+    validateBatchScalar(amounts, types, i, count, validMask, rules);
+}
+
+TRANSACTION_VALIDATION_TARGET_AVX2
+void TransactionProcessor::validateBatchAvx2(const Money* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    const CentBounds bounds = centBoundsOf(rules);
+    const long long* minTable = reinterpret_cast<const long long*>(bounds.minCents);
+    const long long* maxTable = reinterpret_cast<const long long*>(bounds.maxCents);
+    const __m128i lastRow = _mm_set1_epi32(static_cast<int>(TRANSACTION_RULE_COUNT - 1));
+
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i cents = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(amounts + i));
+        const __m128i row = _mm_min_epu32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(types + i)), lastRow);
+        const __m256i minCents = _mm256_i32gather_epi64(minTable, row, sizeof(std::int64_t));
+        const __m256i maxCents = _mm256_i32gather_epi64(maxTable, row, sizeof(std::int64_t));
+
+        const __m256i invalid = _mm256_or_si256(_mm256_cmpgt_epi64(minCents, cents), _mm256_cmpgt_epi64(cents, maxCents));
+
+        const std::uint64_t validBits =
+            static_cast<std::uint64_t>(~_mm256_movemask_pd(_mm256_castsi256_pd(invalid)) & 0xF);
+        validMask[i / 64] |= validBits << (i % 64);
+    }
+
+    validateBatchScalar(amounts, types, i, count, validMask, rules);
+}
+#else
+void TransactionProcessor::validateBatchAvx2(const double* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    validateBatchScalar(amounts, types, 0, count, validMask, rules);
+}
+
+void TransactionProcessor::validateBatchAvx2(const Money* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    validateBatchScalar(amounts, types, 0, count, validMask, rules);
+}
+#endif
+
+#if defined(TRANSACTION_VALIDATION_NEON)
+void TransactionProcessor::validateBatchNeon(const double* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    const DoubleBounds bounds = doubleBoundsOf(rules);
+
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const float64x2_t amount = vld1q_f64(amounts + i);
+        const std::size_t first = transactionRuleIndex(types[i]);
+        const std::size_t second = transactionRuleIndex(types[i + 1]);
+        const float64x2_t minAmount = vcombine_f64(vld1_f64(bounds.minAmount + first), vld1_f64(bounds.minAmount + second));
+        const float64x2_t maxAmount = vcombine_f64(vld1_f64(bounds.maxAmount + first), vld1_f64(bounds.maxAmount + second));
+
+        // NaN fails both compares and ends up valid, as in the scalar rules
+        const uint64x2_t invalid = vorrq_u64(vcltq_f64(amount, minAmount), vcgtq_f64(amount, maxAmount));
+
+        const std::uint64_t validBits = (vgetq_lane_u64(invalid, 0) == 0 ? 1u : 0u) |
+                                        (vgetq_lane_u64(invalid, 1) == 0 ? 2u : 0u);
+        validMask[i / 64] |= validBits << (i % 64);
+    }
+
+    validateBatchScalar(amounts, types, i, count, validMask, rules);
+}
+
+void TransactionProcessor::validateBatchNeon(const Money* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    const CentBounds bounds = centBoundsOf(rules);
+
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const int64x2_t cents = vld1q_s64(reinterpret_cast<const std::int64_t*>(amounts + i));
+        const std::size_t first = transactionRuleIndex(types[i]);
+        const std::size_t second = transactionRuleIndex(types[i + 1]);
+        const int64x2_t minCents = vcombine_s64(vld1_s64(bounds.minCents + first), vld1_s64(bounds.minCents + second));
+        const int64x2_t maxCents = vcombine_s64(vld1_s64(bounds.maxCents + first), vld1_s64(bounds.maxCents + second));
+
+        const uint64x2_t invalid = vorrq_u64(vcltq_s64(cents, minCents), vcgtq_s64(cents, maxCents));
+
+        const std::uint64_t validBits = (vgetq_lane_u64(invalid, 0) == 0 ? 1u : 0u) |
+                                        (vgetq_lane_u64(invalid, 1) == 0 ? 2u : 0u);
+        validMask[i / 64] |= validBits << (i % 64);
+    }
+
+    validateBatchScalar(amounts, types, i, count, validMask, rules);
+}
+#else
+void TransactionProcessor::validateBatchNeon(const double* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    validateBatchScalar(amounts, types, 0, count, validMask, rules);
+}
+
+void TransactionProcessor::validateBatchNeon(const Money* amounts, const TransactionType* types,
+                                             std::size_t count, std::uint64_t* validMask,
+                                             const TransactionRuleTable& rules) {
+    validateBatchScalar(amounts, types, 0, count, validMask, rules);
+}
+#endif
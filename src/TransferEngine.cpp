@@ -0,0 +1,33 @@
+#include "TransferEngine.hpp"
+#include "ConcurrentAccountManager.hpp"
+#include "TransactionProcessor.hpp"
+
+TransferEngine::TransferEngine(ConcurrentAccountManager& accounts, TransactionProcessor& processor)
+    : accounts(accounts), processor(processor), completedCount(0), declinedCount(0), refusedCount(0) {
+}
+
+TransactionStatus TransferEngine::transfer(double amount, const std::string& source, const std::string& destination,
+                                           bool isUrgent) {
+    // The balances move while the processor holds the daily usage of the transfer reserved
+    bool refused = false;
+    const TransactionStatus status = processor.processTransfer(amount, source, destination, isUrgent, [&]() {
+        refused = !accounts.transferBalance(source, destination, amount);
+        return !refused;
+    });
+    if (refused) {
+        refusedCount.fetch_add(1, std::memory_order_relaxed);
+    } else if (status != TransactionStatus::COMPLETED) {
+        declinedCount.fetch_add(1, std::memory_order_relaxed);
+    } else {
+        completedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    return status;
+}
+
+TransferEngineStats TransferEngine::getStats() const {
+    TransferEngineStats stats{};
+    stats.completedCount = completedCount.load(std::memory_order_relaxed);
+    stats.declinedCount = declinedCount.load(std::memory_order_relaxed);
+    stats.refusedCount = refusedCount.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,175 @@
+#include "WindowedRateLimiter.hpp"
+#include "Money.hpp"
+#include <algorithm>
+
+const std::size_t WindowedRateLimiter::MAX_BUCKETS;
+const std::size_t WindowedRateLimiter::MIN_SWEEP_THRESHOLD;
+
+WindowedRateLimiter::WindowedRateLimiter(std::int64_t windowSeconds, std::size_t bucketCount,
+                                         int maxTransactions, double maxVolume, Clock clock)
+    : bucketSeconds(1), bucketCount(std::min(std::max<std::size_t>(bucketCount, 1), MAX_BUCKETS)),
+      maxTransactions(maxTransactions), maxVolumeCents(Money(maxVolume).toCents()),
+      clock(clock ? std::move(clock) : Clock([]() { return time(nullptr); })),
+      shards(new Shard[SHARD_COUNT]) {
+    const std::int64_t buckets = static_cast<std::int64_t>(this->bucketCount);
+    bucketSeconds = std::max<std::int64_t>((windowSeconds + buckets - 1) / buckets, 1);
+    for (std::size_t i = 0; i < SHARD_COUNT; ++i) {
+        shards[i].sweepThreshold = MIN_SWEEP_THRESHOLD;
+    }
+}
+
+WindowedRateLimiter::Shard& WindowedRateLimiter::shardFor(const std::string& accountNumber) const {
+    return shards[std::hash<std::string>()(accountNumber) % SHARD_COUNT];
+}
+
+std::int64_t WindowedRateLimiter::bucketOf(std::time_t timestamp) const {
+    return timestamp < 0 ? 0 : static_cast<std::int64_t>(timestamp) / bucketSeconds;
+}
+
+void WindowedRateLimiter::advance(Window& window, std::int64_t bucket) const {
+    if (bucket <= window.newestBucket) {
+        return;
+    }
+
+    const std::int64_t buckets = static_cast<std::int64_t>(bucketCount);
+    if (bucket - window.newestBucket >= buckets) {
+        std::fill(window.bucketCounts, window.bucketCounts + bucketCount, 0u);
+        std::fill(window.bucketVolumes, window.bucketVolumes + bucketCount, 0);
+        window.transactionCount = 0;
+        window.volumeCents = 0;
+    } else {
+        for (std::int64_t expired = window.newestBucket + 1; expired <= bucket; ++expired) {
+            const std::size_t slot = static_cast<std::size_t>(expired % buckets);
+            window.transactionCount -= static_cast<int>(window.bucketCounts[slot]);
+            window.volumeCents -= window.bucketVolumes[slot];
+            window.bucketCounts[slot] = 0;
+            window.bucketVolumes[slot] = 0;
+        }
+    }
+    window.newestBucket = bucket;
+}
+
+bool WindowedRateLimiter::isIdle(const Window& window, std::int64_t bucket) const {
+    return window.transactionCount == 0 ||
+           window.newestBucket + static_cast<std::int64_t>(bucketCount) <= bucket;
+}
+
+std::size_t WindowedRateLimiter::sweep(Shard& shard, std::int64_t bucket) const {
+    std::size_t erased = 0;
+    for (auto it = shard.windows.begin(); it != shard.windows.end();) {
+        if (isIdle(it->second, bucket)) {
+            it = shard.windows.erase(it);
+            ++erased;
+        } else {
+            ++it;
+        }
+    }
+    return erased;
+}
+
+bool WindowedRateLimiter::tryAcquire(const std::string& accountNumber, std::time_t timestamp,
+                                     std::int64_t amountCents) {
+    const std::int64_t bucket = bucketOf(timestamp);
+    Shard& shard = shardFor(accountNumber);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto found = shard.windows.find(accountNumber);
+    if (found == shard.windows.end()) {
+        // Sweeping only when the shard has doubled keeps the cost per insertion O(1) amortized
+        if (shard.windows.size() >= shard.sweepThreshold) {
+            sweep(shard, bucket);
+            shard.sweepThreshold = std::max(MIN_SWEEP_THRESHOLD, 2 * shard.windows.size());
+        }
+        Window window{};
+        window.newestBucket = bucket;
+        found = shard.windows.emplace(accountNumber, window).first;
+    }
+
+    Window& window = found->second;
+    advance(window, bucket);
+    if (window.transactionCount >= maxTransactions || window.volumeCents + amountCents > maxVolumeCents) {
+        return false;
+    }
+
+    const std::size_t slot = static_cast<std::size_t>(window.newestBucket % static_cast<std::int64_t>(bucketCount));
+    window.bucketCounts[slot] += 1;
+    window.bucketVolumes[slot] += amountCents;
+    window.transactionCount += 1;
+    window.volumeCents += amountCents;
+    return true;
+}
+
+void WindowedRateLimiter::release(const std::string& accountNumber, std::time_t timestamp,
+                                  std::int64_t amountCents) {
+    const std::int64_t bucket = bucketOf(timestamp);
+    Shard& shard = shardFor(accountNumber);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto found = shard.windows.find(accountNumber);
+    if (found == shard.windows.end()) {
+        return;
+    }
+
+    // The transaction sits in its own bucket or, if it was stamped late, in the first newer one
+    // holding anything, so the search walks forward from its own bucket
+    Window& window = found->second;
+    const std::int64_t buckets = static_cast<std::int64_t>(bucketCount);
+    const std::int64_t first = std::max(bucket, window.newestBucket - buckets + 1);
+    for (std::int64_t candidate = first; candidate <= window.newestBucket; ++candidate) {
+        const std::size_t slot = static_cast<std::size_t>(candidate % buckets);
+        if (window.bucketCounts[slot] > 0) {
+            const std::int64_t volume = std::min(amountCents, window.bucketVolumes[slot]);
+            window.bucketCounts[slot] -= 1;
+            window.bucketVolumes[slot] -= volume;
+            window.transactionCount -= 1;
+            window.volumeCents -= volume;
+            return;
+        }
+    }
+}
+
+std::size_t WindowedRateLimiter::evictIdle() {
+    const std::int64_t bucket = bucketOf(clock());
+    std::size_t erased = 0;
+    for (std::size_t i = 0; i < SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        erased += sweep(shards[i], bucket);
+    }
+    return erased;
+}
+
+std::size_t WindowedRateLimiter::size() const {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < SHARD_COUNT; ++i) {
+        std::lock_guard<std::mutex> lock(shards[i].mutex);
+        total += shards[i].windows.size();
+    }
+    return total;
+}
+
+bool WindowedRateLimiter::checkRateLimit(const std::string& accountNumber) {
+    return getRemainingRequests(accountNumber) > 0;
+}
+
+bool WindowedRateLimiter::incrementRateCounter(const std::string& accountNumber) {
+    return tryAcquire(accountNumber, clock(), 0);
+}
+
+void WindowedRateLimiter::resetRateLimits(const std::string& accountNumber) {
+    Shard& shard = shardFor(accountNumber);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.windows.erase(accountNumber);
+}
+
+int WindowedRateLimiter::getRemainingRequests(const std::string& accountNumber) {
+    const std::int64_t bucket = bucketOf(clock());
+    Shard& shard = shardFor(accountNumber);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto found = shard.windows.find(accountNumber);
+    if (found == shard.windows.end()) {
+        return maxTransactions;
+    }
+    advance(found->second, bucket);
+    return std::max(maxTransactions - found->second.transactionCount, 0);
+}
@@ -0,0 +1,128 @@
+#include "WorkStealingPool.hpp"
+
+WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+    : generation(0), remainingCount(0), stopRequested(false), stolenCount(0) {
+    std::size_t count = threadCount != 0 ? threadCount : std::thread::hardware_concurrency();
+    if (count == 0) {
+        count = 1;
+    }
+
+    queues.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+    workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        workers.emplace_back(&WorkStealingPool::workerLoop, this, i);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    workAvailable.notify_all();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::run(std::size_t taskCount, const Task& task) {
+    if (taskCount == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> serialize(runMutex);
+
+    // Counted before dealing: a worker still busy with the previous run may already take these
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        remainingCount = taskCount;
+    }
+    for (std::size_t i = 0; i < taskCount; ++i) {
+        WorkerQueue& queue = *queues[i % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(QueuedTask{&task, i});
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    generation++;
+    workAvailable.notify_all();
+    runFinished.wait(lock, [this]() { return remainingCount == 0; });
+
+    // Cleared before rethrowing, so the next run starts without it
+    std::exception_ptr thrown = runException;
+    runException = nullptr;
+    lock.unlock();
+    if (thrown) {
+        std::rethrow_exception(thrown);
+    }
+}
+
+bool WorkStealingPool::takeTask(std::size_t worker, QueuedTask& next) {
+    {
+        WorkerQueue& own = *queues[worker];
+        std::lock_guard<std::mutex> lock(own.mutex);
+        if (!own.tasks.empty()) {
+            next = own.tasks.front();
+            own.tasks.pop_front();
+            return true;
+        }
+    }
+
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkerQueue& victim = *queues[(worker + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            next = victim.tasks.back();
+            victim.tasks.pop_back();
+            stolenCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(std::size_t worker) {
+    std::size_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            workAvailable.wait(lock, [this, seenGeneration]() {
+                return stopRequested || generation != seenGeneration;
+            });
+            if (stopRequested) {
+                return;
+            }
+            seenGeneration = generation;
+        }
+
+        // Each queued call carries its own task, so a worker that wakes late cannot mix up runs
+        QueuedTask next{nullptr, 0};
+        while (takeTask(worker, next)) {
+            std::exception_ptr thrown;
+            try {
+                (*next.task)(next.index);
+            } catch (...) {
+                thrown = std::current_exception();
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (thrown && !runException) {
+                runException = thrown;
+            }
+            if (--remainingCount == 0) {
+                runFinished.notify_all();
+            }
+        }
+    }
+}
+
+std::size_t WorkStealingPool::getThreadCount() const {
+    return workers.size();
+}
+
+std::size_t WorkStealingPool::getStolenCount() const {
+    return stolenCount.load(std::memory_order_relaxed);
+}
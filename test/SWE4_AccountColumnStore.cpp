@@ -0,0 +1,169 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../inc/AccountColumnStore.hpp"
+#include "../inc/AccountIndex.hpp"
+#include "../inc/AccountManager.hpp"
+#include "../inc/ProcessingContext.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountColumnStoreUnitTest : public ::testing::TestWithParam<bool> {
+protected:
+    AccountColumnStore sut;
+    AccountIndex index;
+    std::vector<int> txnCounts;
+    std::vector<double> volumes;
+
+    void SetUp() override {
+        // Every boundary of the scalar threshold ladders, crossed with both flags
+        const int counts[] = {0, 20, 21, 50, 51, 100, 101};
+        const double dayVolumes[] = {0.0, 100000.0, 100000.01, 500000.0, 500000.01, 1000000.0, 1000000.01};
+        int id = 1;
+        for (int verified = 0; verified < 2; ++verified) {
+            for (int fraud = 0; fraud < 2; ++fraud) {
+                for (int count : counts) {
+                    for (double volume : dayVolumes) {
+                        index.insert(id, Account{"ACC" + std::to_string(id), AccountType::CHECKING,
+                                                 AccountStatus::ACTIVE, 10.0, 0.0, 0,
+                                                 verified == 1, fraud == 1});
+                        txnCounts.push_back(count);
+                        volumes.push_back(volume);
+                        ++id;
+                    }
+                }
+            }
+        }
+    }
+
+    void TearDown() override {
+        ProcessingContext::global().complianceAuditMode = false;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SWE4_AccountColumnStore_AuditModes, AccountColumnStoreUnitTest, ::testing::Bool());
+
+// ============================================================================
+// Method: load()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountColumnStore::load()
+/// Test goal: Columns mirror the indexed accounts in insertion order
+/// In case: Load the boundary grid and compare every column entry
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_P(AccountColumnStoreUnitTest, SWE4_AccountColumnStore_load_Normal_Columns) {
+    sut.load(index);
+    ASSERT_EQ(sut.size(), index.size());
+    for (std::size_t i = 0; i < sut.size(); ++i) {
+        const Account& account = index.entryAt(i);
+        EXPECT_EQ(sut.getStatus()[i], static_cast<std::uint8_t>(account.status));
+        EXPECT_EQ(sut.getIsVerified()[i] != 0, account.isVerified);
+        EXPECT_EQ(sut.getHasFraudAlert()[i] != 0, account.hasFraudAlert);
+        EXPECT_EQ(sut.getBalance()[i], account.balance);
+        EXPECT_EQ(sut.getRiskScore()[i], account.riskScore);
+    }
+}
+
+// ============================================================================
+// Method: evaluateRisk()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountColumnStore::evaluateRisk()
+/// Test goal: Branch-free kernel matches AccountManager::evaluateAccountRisk at every boundary
+/// In case: Score each grid row in bulk and with a scalar AccountManager call
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_P(AccountColumnStoreUnitTest, SWE4_AccountColumnStore_evaluateRisk_Boundary_MatchesScalar) {
+    const bool auditMode = GetParam();
+    ProcessingContext::global().complianceAuditMode = auditMode;
+
+    sut.load(index);
+    sut.evaluateRisk(txnCounts.data(), volumes.data(), 75, auditMode);
+
+    for (std::size_t i = 0; i < sut.size(); ++i) {
+        AccountManager scalar;
+        std::string acc = scalar.createAccount(AccountType::CHECKING, 10.0);
+        Account* ptr = scalar.getAccount(acc);
+        ptr->isVerified = index.entryAt(i).isVerified;
+        ptr->hasFraudAlert = index.entryAt(i).hasFraudAlert;
+
+        AccountStatus expected = scalar.evaluateAccountRisk(acc, txnCounts[i], volumes[i]);
+        EXPECT_EQ(static_cast<AccountStatus>(sut.getEvaluatedStatus()[i]), expected)
+            << "count=" << txnCounts[i] << " volume=" << volumes[i];
+    }
+}
+
+/// ===========================================================================
+/// Verifies: AccountColumnStore::evaluateRisk() & getChangedRows()
+/// Test goal: Only rows with a new score or a high-risk outcome are listed for write-back
+/// In case: Score the grid, store the scores in the accounts, reload and score it again
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_P(AccountColumnStoreUnitTest, SWE4_AccountColumnStore_getChangedRows_Normal_OnlyChangedRows) {
+    const bool auditMode = GetParam();
+    sut.load(index);
+    sut.evaluateRisk(txnCounts.data(), volumes.data(), 75, auditMode);
+
+    // Every grid account starts at score 0, so each nonzero score is a change
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < sut.size(); ++i) {
+        if (sut.getEvaluatedScore()[i] != 0) {
+            expected.push_back(i);
+        }
+        index.entryAt(i).riskScore = sut.getEvaluatedScore()[i];
+    }
+    EXPECT_EQ(sut.getChangedRows(), expected);
+
+    // With the scores stored, only the high-risk rows still need their status written back
+    sut.load(index);
+    sut.evaluateRisk(txnCounts.data(), volumes.data(), 75, auditMode);
+    expected.clear();
+    for (std::size_t i = 0; i < sut.size(); ++i) {
+        if (sut.getEvaluatedScore()[i] >= 75) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), sut.size());
+    EXPECT_EQ(sut.getChangedRows(), expected);
+}
+
+// ============================================================================
+// Method: AccountManager::evaluateAllAccountsRisk()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAllAccountsRisk()
+/// Test goal: Bulk evaluation applies the same status side effects as the scalar call
+/// In case: Three accounts scored safe, elevated and high risk
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_P(AccountColumnStoreUnitTest, SWE4_AccountColumnStore_evaluateAllAccountsRisk_Normal_SideEffects) {
+    const bool auditMode = GetParam();
+    ProcessingContext::global().complianceAuditMode = auditMode;
+
+    AccountManager bulk;
+    AccountManager scalar;
+    const int counts[] = {5, 60, 101};
+    const double dayVolumes[] = {0.0, 150000.0, 1000000.01};
+    std::vector<std::string> scalarAccounts;
+    for (int i = 0; i < 3; ++i) {
+        bulk.createAccount(AccountType::SAVINGS, 10.0);
+        scalarAccounts.push_back(scalar.createAccount(AccountType::SAVINGS, 10.0));
+    }
+
+    AccountStatus results[3];
+    bulk.evaluateAllAccountsRisk(counts, dayVolumes, results);
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(results[i], scalar.evaluateAccountRisk(scalarAccounts[i], counts[i], dayVolumes[i]));
+        EXPECT_EQ(bulk.getAccountAt(i)->status, scalar.getAccount(scalarAccounts[i])->status);
+    }
+    EXPECT_EQ(bulk.getSuspendedAccountCount(), scalar.getSuspendedAccountCount());
+    EXPECT_EQ(bulk.getAccountAt(3), nullptr);
+}
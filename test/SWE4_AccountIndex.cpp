@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <tuple>
+
+#include "../inc/AccountIndex.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountIndexUnitTest : public ::testing::Test {
+protected:
+    AccountIndex sut;
+
+    Account makeAccount(int accountId) {
+        return Account{"ACC" + std::to_string(accountId), AccountType::CHECKING,
+                       AccountStatus::PENDING_VERIFICATION, 10.0, 0.0, 0, false, false};
+    }
+};
+
+// ============================================================================
+// Method: parseAccountId()
+// ============================================================================
+
+class ParseAccountIdParamTest : public ::testing::TestWithParam<std::tuple<std::string, bool, int>> {
+};
+
+// Parameters: accountNumber, expectedCanonical, expectedId
+INSTANTIATE_TEST_SUITE_P(
+    SWE4_AccountIndex_ParseCases,
+    ParseAccountIdParamTest,
+    ::testing::Values(
+        std::make_tuple("ACC500001", true, 500001),
+        std::make_tuple("ACC0", true, 0),
+        std::make_tuple("ACC2147483647", true, 2147483647),   // INT_MAX
+        std::make_tuple("ACC2147483648", false, 0),           // INT_MAX + 1
+        std::make_tuple("ACC0500001", false, 0),              // Leading zero aliases ACC500001
+        std::make_tuple("ACC", false, 0),
+        std::make_tuple("ACC12a", false, 0),
+        std::make_tuple("acc500001", false, 0),
+        std::make_tuple("SRC", false, 0)
+    )
+);
+
+/// ===========================================================================
+/// Verifies: AccountIndex::parseAccountId()
+/// Test goal: Only canonical ACC<digits> numbers parse, without aliasing
+/// In case: Canonical, boundary and malformed account numbers
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_P(ParseAccountIdParamTest, SWE4_AccountIndex_parseAccountId_Cases) {
+    auto [accountNumber, expectedCanonical, expectedId] = GetParam();
+    int accountId = -1;
+    EXPECT_EQ(AccountIndex::parseAccountId(accountNumber, accountId), expectedCanonical);
+    if (expectedCanonical) {
+        EXPECT_EQ(accountId, expectedId);
+    }
+}
+
+// ============================================================================
+// Method: formatAccountNumber()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountIndex::formatAccountNumber()
+/// Test goal: Formatted numbers are canonical and parse back to the same id
+/// In case: 0, a one-digit id, the first counter id, INT_MAX and a sweep of ids
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(AccountIndexUnitTest, SWE4_AccountIndex_formatAccountNumber_Boundary_RoundTrip) {
+    EXPECT_EQ(AccountIndex::formatAccountNumber(0), "ACC0");
+    EXPECT_EQ(AccountIndex::formatAccountNumber(7), "ACC7");
+    EXPECT_EQ(AccountIndex::formatAccountNumber(500001), "ACC500001");
+    EXPECT_EQ(AccountIndex::formatAccountNumber(2147483647), "ACC2147483647");
+
+    for (int id = 0; id < 2000000; id += 997) {
+        int parsed = -1;
+        ASSERT_TRUE(AccountIndex::parseAccountId(AccountIndex::formatAccountNumber(id), parsed));
+        ASSERT_EQ(parsed, id);
+    }
+}
+
+// ============================================================================
+// Method: insert() & find()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountIndex::insert() & find()
+/// Test goal: Accounts are found by id and by account number
+/// In case: Insert one account, look it up both ways
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AccountIndexUnitTest, SWE4_AccountIndex_find_Normal_ByIdAndNumber) {
+    Account* stored = sut.insert(500001, makeAccount(500001));
+    ASSERT_NE(stored, nullptr);
+
+    EXPECT_EQ(sut.find(500001), stored);
+    EXPECT_EQ(sut.find(std::string("ACC500001")), stored);
+    EXPECT_EQ(sut.find(500002), nullptr);
+    EXPECT_EQ(sut.find(std::string("ACC0500001")), nullptr);
+    EXPECT_EQ(sut.size(), 1u);
+}
+
+/// ===========================================================================
+/// Verifies: AccountIndex::insert()
+/// Test goal: Duplicate and negative ids are refused
+/// In case: Insert the same id twice and a negative id
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AccountIndexUnitTest, SWE4_AccountIndex_insert_Error_DuplicateOrNegative) {
+    ASSERT_NE(sut.insert(7, makeAccount(7)), nullptr);
+    EXPECT_EQ(sut.insert(7, makeAccount(7)), nullptr);
+    EXPECT_EQ(sut.insert(-1, makeAccount(-1)), nullptr);
+    EXPECT_EQ(sut.find(-1), nullptr);
+    EXPECT_EQ(sut.size(), 1u);
+}
+
+/// ===========================================================================
+/// Verifies: AccountIndex::insert() & rehash
+/// Test goal: Growth keeps every account reachable and addresses stable
+/// In case: Insert 10000 sequential ids, keep the first pointer, look all up
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountIndexUnitTest, SWE4_AccountIndex_insert_Normal_GrowthKeepsAddresses) {
+    Account* first = sut.insert(500001, makeAccount(500001));
+    for (int id = 500002; id <= 510000; ++id) {
+        ASSERT_NE(sut.insert(id, makeAccount(id)), nullptr);
+    }
+
+    EXPECT_EQ(sut.find(500001), first);
+    for (int id = 500001; id <= 510000; ++id) {
+        const Account* account = sut.find(id);
+        ASSERT_NE(account, nullptr);
+        EXPECT_EQ(account->accountNumber, "ACC" + std::to_string(id));
+    }
+    EXPECT_EQ(sut.size(), 10000u);
+    EXPECT_EQ(sut.entryAt(0).accountNumber, "ACC500001");
+}
+
+/// ===========================================================================
+/// Verifies: AccountIndex::reserve() & clear()
+/// Test goal: Reserve keeps contents, clear empties the index
+/// In case: Insert, reserve, look up, clear, look up
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AccountIndexUnitTest, SWE4_AccountIndex_reserve_Normal_ThenClear) {
+    sut.insert(42, makeAccount(42));
+    sut.reserve(5000);
+    EXPECT_NE(sut.find(42), nullptr);
+
+    sut.clear();
+    EXPECT_EQ(sut.find(42), nullptr);
+    EXPECT_EQ(sut.size(), 0u);
+}
@@ -0,0 +1,326 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountJournal.hpp"
+#include "../inc/AccountManager.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountJournalUnitTest : public ::testing::Test {
+protected:
+    std::string walPath;
+    std::string snapshotPath;
+
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        walPath = ::testing::TempDir() + "SWE4_AccountJournal_" + name + ".wal";
+        snapshotPath = ::testing::TempDir() + "SWE4_AccountJournal_" + name + ".snap";
+        std::remove(walPath.c_str());
+        std::remove(snapshotPath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(walPath.c_str());
+        std::remove(snapshotPath.c_str());
+    }
+
+    static AccountLogRecord makeRecord(int accountId) {
+        Account account{"ACC" + std::to_string(accountId), AccountType::SAVINGS, AccountStatus::ACTIVE,
+                        accountId * 2.0, 0.0, 0, true, false};
+        return AccountLogRecord::fromAccount(AccountLogOperation::CREATE, accountId, account, 0);
+    }
+
+    std::vector<AccountLogRecord> readAll() {
+        std::vector<AccountLogRecord> records;
+        AccountWriteAheadLog::readRecords(walPath, [&records](const AccountLogRecord& record) {
+            records.push_back(record);
+        });
+        return records;
+    }
+};
+
+// ============================================================================
+// Class: AccountWriteAheadLog
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountWriteAheadLog::append() & sync() & readRecords()
+/// Test goal: Appended records read back intact, in sequence order
+/// In case: Five records followed by one sync
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_append_Normal_RoundTrip) {
+    AccountWriteAheadLog sut;
+    ASSERT_TRUE(sut.open(walPath));
+    for (int i = 1; i <= 5; ++i) {
+        EXPECT_EQ(sut.append(makeRecord(500000 + i)), static_cast<std::uint64_t>(i));
+    }
+    ASSERT_TRUE(sut.sync());
+    sut.close();
+
+    std::vector<AccountLogRecord> records = readAll();
+    ASSERT_EQ(records.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ(records[i].sequence, static_cast<std::uint64_t>(i + 1));
+        EXPECT_EQ(records[i].accountId, 500001 + i);
+        Account account = records[i].toAccount();
+        EXPECT_EQ(account.accountNumber, "ACC" + std::to_string(500001 + i));
+        EXPECT_EQ(account.balance, (500001 + i) * 2.0);
+        EXPECT_TRUE(account.isVerified);
+    }
+    EXPECT_EQ(sut.append(makeRecord(1)), 0u);
+}
+
+/// ===========================================================================
+/// Verifies: AccountWriteAheadLog::waitDurable()
+/// Test goal: Concurrent committers share fsyncs instead of paying one each
+/// In case: Four threads each append and wait for 250 records
+/// Method for Verification: Invariant check on the sync counter
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_waitDurable_Normal_GroupCommit) {
+    AccountWriteAheadLog sut(std::chrono::milliseconds(2), 64);
+    ASSERT_TRUE(sut.open(walPath));
+
+    std::vector<std::thread> committers;
+    for (int t = 0; t < 4; ++t) {
+        committers.emplace_back([&sut, t]() {
+            for (int i = 0; i < 250; ++i) {
+                std::uint64_t sequence = sut.append(makeRecord(t * 1000 + i + 1));
+                if (i % 50 == 49) {
+                    EXPECT_TRUE(sut.waitDurable(sequence));
+                }
+            }
+        });
+    }
+    for (std::thread& committer : committers) {
+        committer.join();
+    }
+    ASSERT_TRUE(sut.sync());
+
+    EXPECT_EQ(sut.getLastSequence(), 1000u);
+    EXPECT_LT(sut.getSyncCount(), 1000u / 4);
+    sut.close();
+    EXPECT_EQ(readAll().size(), 1000u);
+}
+
+/// ===========================================================================
+/// Verifies: AccountWriteAheadLog::open()
+/// Test goal: A torn record at the end is cut off and appends continue after the intact prefix
+/// In case: Three records followed by half a record of garbage
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_open_Error_TornTail) {
+    {
+        AccountWriteAheadLog first;
+        ASSERT_TRUE(first.open(walPath));
+        for (int i = 1; i <= 3; ++i) {
+            first.append(makeRecord(i));
+        }
+    }
+    std::FILE* file = std::fopen(walPath.c_str(), "ab");
+    ASSERT_NE(file, nullptr);
+    const char garbage[sizeof(AccountLogRecord) / 2] = {1, 2, 3};
+    std::fwrite(garbage, sizeof(garbage), 1, file);
+    std::fclose(file);
+    EXPECT_EQ(readAll().size(), 3u);
+
+    AccountWriteAheadLog sut;
+    ASSERT_TRUE(sut.open(walPath));
+    EXPECT_EQ(sut.getLastSequence(), 3u);
+    EXPECT_EQ(sut.append(makeRecord(4)), 4u);
+    sut.close();
+
+    std::vector<AccountLogRecord> records = readAll();
+    ASSERT_EQ(records.size(), 4u);
+    EXPECT_EQ(records[3].accountId, 4);
+}
+
+/// ===========================================================================
+/// Verifies: AccountWriteAheadLog::open()
+/// Test goal: A file with a foreign layout is rejected and left untouched
+/// In case: Log path holding arbitrary bytes
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_open_Error_ForeignFile) {
+    std::FILE* file = std::fopen(walPath.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a write-ahead log", file);
+    std::fclose(file);
+
+    AccountWriteAheadLog sut;
+    EXPECT_FALSE(sut.open(walPath));
+    EXPECT_FALSE(sut.isOpen());
+    EXPECT_FALSE(AccountWriteAheadLog::readRecords(walPath, [](const AccountLogRecord&) {}));
+
+    file = std::fopen(walPath.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, 0, SEEK_END);
+    EXPECT_EQ(std::ftell(file), 21L);
+    std::fclose(file);
+}
+
+// ============================================================================
+// Method: AccountManager::recover()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::recover() & writeSnapshot() & setSnapshotPolicy()
+/// Test goal: Snapshot plus WAL tail restore every account and counter of the original manager
+/// In case: Mutations before and after a periodic snapshot, WAL reopened after the snapshot
+/// Method for Verification: Comparison against the original state
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_recover_Normal_SnapshotPlusTail) {
+    std::vector<std::string> numbers;
+    AccountManager original;
+    {
+        AccountWriteAheadLog wal;
+        ASSERT_TRUE(wal.open(walPath));
+        original.setWriteAheadLog(&wal);
+        original.setSnapshotPolicy(snapshotPath, 6);
+
+        for (int i = 0; i < 5; ++i) {
+            numbers.push_back(original.createAccount(AccountType::CHECKING, 100.0 + i));
+        }
+        original.verifyAccount(numbers[0], true);
+        EXPECT_EQ(wal.getLastSequence(), 6u);
+
+        // WAL tail after the snapshot
+        original.suspendAccount(numbers[1], "review");
+        original.updateAccountStatus(numbers[0], AccountStatus::FROZEN);
+        original.evaluateAccountRisk(numbers[2], 150, 2000000.0);
+        numbers.push_back(original.createAccount(AccountType::BUSINESS, 7.5));
+        ASSERT_TRUE(wal.sync());
+    }
+
+    AccountManager sut;
+    ASSERT_TRUE(sut.recover(snapshotPath, walPath));
+
+    ASSERT_EQ(sut.getAccountCount(), original.getAccountCount());
+    EXPECT_EQ(sut.getSuspendedAccountCount(), original.getSuspendedAccountCount());
+    EXPECT_DOUBLE_EQ(sut.getTotalManagedBalance(), original.getTotalManagedBalance());
+    for (const std::string& number : numbers) {
+        const Account* expected = original.getAccount(number);
+        const Account* recovered = sut.getAccount(number);
+        ASSERT_NE(recovered, nullptr);
+        EXPECT_EQ(recovered->type, expected->type);
+        EXPECT_EQ(recovered->status, expected->status);
+        EXPECT_EQ(recovered->balance, expected->balance);
+        EXPECT_EQ(recovered->isVerified, expected->isVerified);
+    }
+
+    // Sequences continue past the snapshot, and new ids do not reuse recovered ones
+    AccountWriteAheadLog reopened;
+    ASSERT_TRUE(reopened.open(walPath));
+    EXPECT_EQ(reopened.getLastSequence(), 10u);
+    int lastId = 0;
+    AccountIndex::parseAccountId(numbers.back(), lastId);
+    int nextId = 0;
+    AccountIndex::parseAccountId(sut.createAccount(AccountType::SAVINGS, 1.0), nextId);
+    EXPECT_GT(nextId, lastId);
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::recover()
+/// Test goal: A corrupt snapshot or a non-empty manager is refused
+/// In case: One byte of a snapshot flipped; recover called on a manager with accounts
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_recover_Error_CorruptSnapshot) {
+    AccountManager original;
+    original.createAccount(AccountType::CHECKING, 10.0);
+    ASSERT_TRUE(original.writeSnapshot(snapshotPath));
+    EXPECT_FALSE(original.recover(snapshotPath, walPath));
+
+    std::FILE* file = std::fopen(snapshotPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, sizeof(AccountSnapshotHeader) + 16, SEEK_SET);
+    std::fputc(0x7F, file);
+    std::fclose(file);
+
+    AccountManager sut;
+    EXPECT_FALSE(sut.recover(snapshotPath, walPath));
+
+    AccountManager empty;
+    EXPECT_TRUE(empty.recover(snapshotPath + ".missing", walPath + ".missing"));
+    EXPECT_EQ(empty.getAccountCount(), 0);
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::recover() & openSnapshot() & getOwnerAccountCount()
+/// Test goal: Owners survive the snapshot and the WAL, so the per-owner limit holds after a restart
+/// In case: Owner 5 at its limit partly in the snapshot and partly in the WAL tail, restored both ways
+/// Method for Verification: Comparison against the original state
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_recover_Boundary_OwnerLimitSurvives) {
+    const int limit = AccountManager::getMaxAccountsPerUser();
+    const std::vector<double> balances(static_cast<std::size_t>(limit), 25.0);
+    const std::vector<std::uint32_t> owners(static_cast<std::size_t>(limit), 5);
+    {
+        AccountWriteAheadLog wal;
+        ASSERT_TRUE(wal.open(walPath));
+        AccountManager original;
+        original.setWriteAheadLog(&wal);
+        original.createAccounts(3, AccountType::SAVINGS, balances.data(), owners.data());
+        ASSERT_TRUE(original.writeSnapshot(snapshotPath));
+        original.createAccounts(static_cast<std::size_t>(limit - 3), AccountType::SAVINGS, balances.data(),
+                                owners.data());
+        original.createAccount(AccountType::CHECKING, 10.0, 6);
+        ASSERT_TRUE(wal.sync());
+    }
+
+    AccountManager recovered;
+    ASSERT_TRUE(recovered.recover(snapshotPath, walPath));
+    AccountManager mapped;
+    ASSERT_TRUE(mapped.openSnapshot(snapshotPath, walPath));
+    for (AccountManager* sut : {&recovered, &mapped}) {
+        EXPECT_EQ(sut->getOwnerAccountCount(5), limit);
+        EXPECT_EQ(sut->getOwnerAccountCount(6), 1);
+        EXPECT_TRUE(sut->createAccount(AccountType::SAVINGS, 25.0, 5).empty());
+        const std::string other = sut->createAccount(AccountType::SAVINGS, 25.0, 6);
+        ASSERT_FALSE(other.empty());
+        EXPECT_EQ(sut->getAccount(other)->ownerId, 6u);
+        EXPECT_EQ(sut->getOwnerAccountCount(6), 2);
+    }
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::recover() & openSnapshot() & adjustBalance()
+/// Test goal: Balance adjustments logged after the snapshot are replayed onto both balances and the total
+/// In case: Two accounts in the snapshot, then a debit and a credit of 40.00 in the WAL tail
+/// Method for Verification: Comparison against the original state
+/// ===========================================================================
+TEST_F(AccountJournalUnitTest, SWE4_AccountJournal_recover_Normal_BalanceAdjustments) {
+    std::string source;
+    std::string destination;
+    {
+        AccountWriteAheadLog wal;
+        ASSERT_TRUE(wal.open(walPath));
+        AccountManager original;
+        original.setWriteAheadLog(&wal);
+        source = original.createAccount(AccountType::CHECKING, 100.0, 1);
+        destination = original.createAccount(AccountType::CHECKING, 100.0, 2);
+        original.verifyAccount(source, true);
+        original.verifyAccount(destination, true);
+        ASSERT_TRUE(original.writeSnapshot(snapshotPath));
+        ASSERT_TRUE(original.adjustBalance(source, -Money::fromCents(4000)));
+        ASSERT_TRUE(original.adjustBalance(destination, Money::fromCents(4000)));
+        EXPECT_FALSE(original.adjustBalance(source, -Money::fromCents(6001)));
+        ASSERT_TRUE(wal.sync());
+    }
+
+    AccountManager recovered;
+    ASSERT_TRUE(recovered.recover(snapshotPath, walPath));
+    AccountManager mapped;
+    ASSERT_TRUE(mapped.openSnapshot(snapshotPath, walPath));
+    for (AccountManager* sut : {&recovered, &mapped}) {
+        EXPECT_EQ(sut->getAccountBalance(source), 60.0);
+        EXPECT_EQ(sut->getAccountBalance(destination), 140.0);
+        EXPECT_EQ(sut->getTotalManagedBalance(), 200.0);
+    }
+}
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <future>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountLinkGraph.hpp"
+#include "../inc/AccountManager.hpp"
+#include "../inc/AsyncExternalServices.hpp"
+#include "../inc/ExternalServices.hpp"
+
+// ============================================================================
+// Stub Classes
+// ============================================================================
+
+// Answers getLinkedAccounts from a table and counts the lookups
+class LinkTableDataService : public ExternalDataService {
+public:
+    std::map<std::string, std::vector<std::string>> links;
+    int calls = 0;
+
+    std::string getCreditScore(const std::string&) override { return "720"; }
+    std::string getIdentityVerificationStatus(const std::string&) override { return "VERIFIED"; }
+    bool validateBankAccount(const std::string&, const std::string&) override { return true; }
+    std::vector<std::string> getLinkedAccounts(const std::string& primaryAccount) override {
+        calls++;
+        return links[primaryAccount];
+    }
+};
+
+// Completes every lookup of the table service before returning its future
+class ReadyAsyncDataService : public AsyncExternalDataService {
+public:
+    explicit ReadyAsyncDataService(LinkTableDataService& service) : service(service) {}
+
+    std::future<std::string> getCreditScoreAsync(const std::string& accountNumber) override {
+        return ready(service.getCreditScore(accountNumber));
+    }
+    std::future<std::string> getIdentityVerificationStatusAsync(const std::string& accountNumber) override {
+        return ready(service.getIdentityVerificationStatus(accountNumber));
+    }
+    std::future<std::vector<std::string>> getLinkedAccountsAsync(const std::string& primaryAccount) override {
+        return ready(service.getLinkedAccounts(primaryAccount));
+    }
+
+private:
+    LinkTableDataService& service;
+
+    template <typename T>
+    static std::future<T> ready(T value) {
+        std::promise<T> promise;
+        promise.set_value(std::move(value));
+        return promise.get_future();
+    }
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountLinkGraphUnitTest : public ::testing::Test {
+protected:
+    AccountLinkGraph sut;
+    AccountLinkGraph::Clock::time_point start = AccountLinkGraph::Clock::now();
+
+    std::vector<int> linksOf(int accountId) const {
+        const int* links = nullptr;
+        std::size_t count = 0;
+        sut.findLinks(accountId, links, count);
+        return std::vector<int>(links, links + count);
+    }
+};
+
+// Fixture with a manager whose second and third accounts are linked to a flagged first account
+class AccountLinkGraphManagerTest : public ::testing::Test {
+protected:
+    LinkTableDataService dataService;
+    AccountManager manager;
+    std::string flagged;
+    std::string linked;
+    std::string unlinked;
+
+    void SetUp() override {
+        manager.setExternalDataService(&dataService);
+        flagged = manager.createAccount(AccountType::CHECKING, 100.0, 1);
+        linked = manager.createAccount(AccountType::CHECKING, 100.0, 2);
+        unlinked = manager.createAccount(AccountType::CHECKING, 100.0, 3);
+        manager.getAccount(flagged)->hasFraudAlert = true;
+        dataService.links[linked] = {flagged, "L1", linked};
+        dataService.links[unlinked] = {"ACC1"};
+    }
+};
+
+// ============================================================================
+// Method: setLinks()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountLinkGraph::setLinks() & findLinks() & getLinkCount()
+/// Test goal: Rows can be replaced with shorter and longer links without disturbing other rows
+/// In case: Three rows, one shrunk, one grown many times so that the edge array is compacted
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountLinkGraphUnitTest, SWE4_AccountLinkGraph_setLinks_Normal_ReplaceAndCompact) {
+    sut.setLinks(1, {2, 3}, start);
+    sut.setLinks(2, {1}, start);
+    sut.setLinks(3, {}, start);
+    EXPECT_EQ(sut.size(), 3u);
+    EXPECT_EQ(sut.getLinkCount(), 3u);
+
+    sut.setLinks(1, {3}, start);
+    EXPECT_EQ(linksOf(1), (std::vector<int>{3}));
+    EXPECT_EQ(sut.getLinkCount(), 2u);
+
+    std::vector<int> growing;
+    for (int i = 0; i < 50; ++i) {
+        growing.push_back(100 + i);
+        sut.setLinks(3, growing, start);
+        ASSERT_EQ(linksOf(3), growing);
+    }
+    EXPECT_EQ(linksOf(1), (std::vector<int>{3}));
+    EXPECT_EQ(linksOf(2), (std::vector<int>{1}));
+    EXPECT_EQ(sut.getLinkCount(), 52u);
+    EXPECT_EQ(sut.size(), 3u);
+
+    const int* links = nullptr;
+    std::size_t count = 7;
+    EXPECT_FALSE(sut.findLinks(4, links, count));
+    EXPECT_EQ(count, 0u);
+    sut.clear();
+    EXPECT_EQ(sut.size(), 0u);
+    EXPECT_FALSE(sut.findLinks(1, links, count));
+}
+
+// ============================================================================
+// Method: isFresh()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountLinkGraph::isFresh()
+/// Test goal: A row is fresh up to and including its maximum age and an unknown account never is
+/// In case: A row fetched at a fixed time, checked just before, at and after a 10 s maximum age
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(AccountLinkGraphUnitTest, SWE4_AccountLinkGraph_isFresh_Boundary_MaxAge) {
+    const std::chrono::seconds maxAge(10);
+    sut.setLinks(1, {2}, start);
+    EXPECT_TRUE(sut.isFresh(1, start + std::chrono::seconds(9), maxAge));
+    EXPECT_TRUE(sut.isFresh(1, start + maxAge, maxAge));
+    EXPECT_FALSE(sut.isFresh(1, start + maxAge + std::chrono::nanoseconds(1), maxAge));
+    EXPECT_FALSE(sut.isFresh(2, start, maxAge));
+
+    // A refresh restarts the age of the row
+    sut.setLinks(1, {2}, start + maxAge);
+    EXPECT_TRUE(sut.isFresh(1, start + std::chrono::seconds(15), maxAge));
+}
+
+// ============================================================================
+// Method: AccountManager::evaluateAccountRisk()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAccountRisk() & setLinkCacheTtl()
+/// Test goal: A linked fraud alert raises the score, and links are fetched once per TTL
+/// In case: Unverified accounts scoring 70 on activity, one linked to a flagged account, evaluated twice
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(AccountLinkGraphManagerTest, SWE4_AccountLinkGraph_evaluateAccountRisk_Normal_LinkedFraudAlert) {
+    // 30 for activity, 20 for volume, 20 unverified, 15 for the linked alert
+    EXPECT_EQ(manager.evaluateAccountRisk(linked, 101, 600000.0), AccountStatus::SUSPENDED);
+    EXPECT_EQ(manager.getAccount(linked)->riskScore, 85);
+    EXPECT_EQ(manager.evaluateAccountRisk(unlinked, 101, 600000.0), AccountStatus::PENDING_VERIFICATION);
+    EXPECT_EQ(dataService.calls, 2);
+
+    // Self links and numbers that are not canonical are dropped
+    EXPECT_EQ(manager.getLinkGraph().size(), 2u);
+    EXPECT_EQ(manager.getLinkGraph().getLinkCount(), 2u);
+
+    EXPECT_EQ(manager.evaluateAccountRisk(linked, 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(manager.getAccount(linked)->riskScore, 35);
+    EXPECT_EQ(dataService.calls, 2);
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAccountRisk() & setLinkCacheTtl()
+/// Test goal: Links older than the TTL are fetched again and replace only the row of that account
+/// In case: Zero TTL, the link to the flagged account removed after the first evaluation
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AccountLinkGraphManagerTest, SWE4_AccountLinkGraph_evaluateAccountRisk_Error_StaleLinksRefreshed) {
+    manager.setLinkCacheTtl(std::chrono::milliseconds(0));
+    EXPECT_EQ(manager.evaluateAccountRisk(linked, 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(manager.getAccount(linked)->riskScore, 35);
+
+    dataService.links[linked] = {unlinked};
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    EXPECT_EQ(manager.evaluateAccountRisk(linked, 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(manager.getAccount(linked)->riskScore, 20);
+    EXPECT_EQ(dataService.calls, 2);
+    EXPECT_EQ(manager.getLinkGraph().size(), 1u);
+}
+
+// ============================================================================
+// Method: AccountManager::evaluateAllAccountsRisk()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAllAccountsRisk() & evaluateAccountRiskAsync()
+/// Test goal: Links fetched asynchronously count from the first outcome, and bulk evaluation reuses them
+/// In case: One asynchronous evaluation, then a bulk pass over the three accounts
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_F(AccountLinkGraphManagerTest, SWE4_AccountLinkGraph_evaluateAllAccountsRisk_Normal_CachedLinks) {
+    ReadyAsyncDataService asyncDataService(dataService);
+    manager.setAsyncExternalDataService(&asyncDataService);
+
+    // The fetched links are cached before the rules run, so the first outcome already counts them
+    EXPECT_EQ(manager.evaluateAccountRiskAsync(linked, 101, 600000.0).get(), AccountStatus::SUSPENDED);
+    EXPECT_EQ(manager.getLinkGraph().size(), 1u);
+    EXPECT_EQ(manager.evaluateAccountRiskAsync(linked, 101, 600000.0).get(), AccountStatus::SUSPENDED);
+    EXPECT_EQ(dataService.calls, 1);
+    EXPECT_EQ(manager.getLinkGraph().size(), 1u);
+
+    std::vector<int> counts(3, 101);
+    std::vector<double> volumes(3, 600000.0);
+    std::vector<AccountStatus> results(3);
+    manager.evaluateAllAccountsRisk(counts.data(), volumes.data(), results.data());
+    for (int i = 0; i < 3; ++i) {
+        const Account* account = manager.getAccountAt(static_cast<std::size_t>(i));
+        if (account->accountNumber == linked) {
+            EXPECT_EQ(results[i], AccountStatus::SUSPENDED);
+            EXPECT_EQ(account->riskScore, 85);
+        } else if (account->accountNumber == unlinked) {
+            EXPECT_EQ(results[i], AccountStatus::PENDING_VERIFICATION);
+            EXPECT_EQ(account->riskScore, 70);
+        }
+    }
+    EXPECT_EQ(dataService.calls, 1);
+}
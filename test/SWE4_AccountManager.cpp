@@ -1,10 +1,14 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <cstdint>
 #include <limits>
 #include <tuple>
+#include <vector>
 
+#include "../inc/AccountIndex.hpp"
 #include "../inc/AccountManager.hpp"
 #include "../inc/ExternalServices.hpp"
+#include "../inc/ProcessingContext.hpp"
 
 using ::testing::NiceMock;
 using ::testing::Return;
@@ -90,6 +94,26 @@ TEST_F(AccountManagerUnitTest, SWE4_AccountManager_createAccount_Error_Below_Min
     EXPECT_TRUE(acc.empty());
 }
 
+/// ===========================================================================
+/// Verifies: AccountManager::createAccount()
+/// Test goal: Initial balances are rounded to the nearest cent, as processTransaction rounds amounts
+/// In case: 0.1 + 0.2 and 10.004 are created as 0.30 and 10.00; 0.005, NaN and infinity are refused
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(AccountManagerUnitTest, SWE4_AccountManager_createAccount_Boundary_RoundsToCents) {
+    std::string sum = sut.createAccount(AccountType::CHECKING, 0.1 + 0.2);
+    ASSERT_FALSE(sum.empty());
+    EXPECT_EQ(sut.getAccountBalance(sum), 0.3);
+
+    std::string rounded = sut.createAccount(AccountType::SAVINGS, 10.004);
+    ASSERT_FALSE(rounded.empty());
+    EXPECT_EQ(sut.getAccountBalance(rounded), 10.0);
+
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, 0.005).empty());
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, std::numeric_limits<double>::quiet_NaN()).empty());
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, std::numeric_limits<double>::infinity()).empty());
+}
+
 /// ===========================================================================
 /// Verifies: AccountManager::createAccount()
 /// Test goal: Refuse creating more accounts than MAX_ACCOUNTS_PER_USER
@@ -106,6 +130,103 @@ TEST_F(AccountManagerUnitTest, SWE4_AccountManager_createAccount_Error_Max_Accou
     EXPECT_TRUE(accOver.empty());
 }
 
+/// ===========================================================================
+/// Verifies: AccountManager::createAccount() & getOwnerAccountCount()
+/// Test goal: MAX_ACCOUNTS_PER_USER applies per owner, not per manager
+/// In case: Owner 7 fills its limit, then owner 8 and the default owner still create accounts
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(AccountManagerUnitTest, SWE4_AccountManager_createAccount_Boundary_LimitPerOwner) {
+    for (int i = 0; i < AccountManager::getMaxAccountsPerUser(); ++i) {
+        ASSERT_FALSE(sut.createAccount(AccountType::CHECKING, 10.0, 7).empty());
+    }
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, 10.0, 7).empty());
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, 0.0, 8).empty());
+
+    const std::string other = sut.createAccount(AccountType::SAVINGS, 10.0, 8);
+    ASSERT_FALSE(other.empty());
+    EXPECT_EQ(sut.getAccount(other)->ownerId, 8u);
+    EXPECT_FALSE(sut.createAccount(AccountType::SAVINGS, 10.0).empty());
+
+    EXPECT_EQ(sut.getOwnerAccountCount(7), AccountManager::getMaxAccountsPerUser());
+    EXPECT_EQ(sut.getOwnerAccountCount(8), 1);
+    EXPECT_EQ(sut.getOwnerAccountCount(AccountManager::DEFAULT_OWNER_ID), 1);
+    EXPECT_EQ(sut.getOwnerAccountCount(9), 0);
+    EXPECT_EQ(sut.getAccountCount(), AccountManager::getMaxAccountsPerUser() + 2);
+}
+
+// ============================================================================
+// Method: createAccounts()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::createAccounts()
+/// Test goal: Accepted accounts take consecutive ids in input order; refused ones stay empty
+/// In case: 25000 accounts over 2500 owners, plus an invalid balance and one account over an owner limit
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountManagerUnitTest, SWE4_AccountManager_createAccounts_Normal_ContiguousIdsPerOwner) {
+    ProcessingContext context;
+    sut.setProcessingContext(&context);
+
+    const std::size_t count = 25002;
+    std::vector<double> balances(count);
+    std::vector<std::uint32_t> ownerIds(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        balances[i] = 1.0 + static_cast<double>(i % 100);
+        ownerIds[i] = static_cast<std::uint32_t>(i / 10 + 1);
+    }
+    balances[3] = 0.004;           // not a whole number of cents
+    ownerIds[25000] = 1;           // owner 1 already holds 9 new accounts and then gets its 10th
+    ownerIds[25001] = 1;           // 11th for owner 1
+
+    const std::vector<std::string> numbers = sut.createAccounts(count, AccountType::BUSINESS, balances.data(),
+                                                                ownerIds.data());
+    ASSERT_EQ(numbers.size(), count);
+    EXPECT_TRUE(numbers[3].empty());
+    EXPECT_FALSE(numbers[25000].empty());
+    EXPECT_TRUE(numbers[25001].empty());
+
+    int previousId = 0;
+    std::size_t created = 0;
+    long long expectedCents = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (numbers[i].empty()) {
+            continue;
+        }
+        int accountId = 0;
+        ASSERT_TRUE(AccountIndex::parseAccountId(numbers[i], accountId));
+        if (created != 0) {
+            ASSERT_EQ(accountId, previousId + 1);
+        }
+        previousId = accountId;
+        created++;
+        expectedCents += Money(balances[i]).toCents();
+
+        const Account* account = sut.getAccount(numbers[i]);
+        ASSERT_NE(account, nullptr);
+        ASSERT_EQ(account->ownerId, ownerIds[i]);
+        ASSERT_EQ(account->type, AccountType::BUSINESS);
+        ASSERT_EQ(account->status, AccountStatus::PENDING_VERIFICATION);
+    }
+
+    EXPECT_EQ(created, count - 2);
+    EXPECT_EQ(sut.getAccountCount(), static_cast<int>(created));
+    EXPECT_EQ(sut.getOwnerAccountCount(1), AccountManager::getMaxAccountsPerUser());
+    EXPECT_EQ(sut.getOwnerAccountCount(AccountManager::DEFAULT_OWNER_ID), 0);
+    EXPECT_EQ(sut.getOwnerAccountCount(2500), AccountManager::getMaxAccountsPerUser());
+    EXPECT_EQ(context.totalAccountsCreated.load(), static_cast<int>(created));
+    EXPECT_EQ(context.systemTotalBalanceCents.load(), expectedCents);
+    EXPECT_EQ(Money(sut.getTotalManagedBalance()).toCents(), expectedCents);
+
+    // The default owner has no accounts of its own yet
+    const std::vector<std::string> defaults = sut.createAccounts(12, AccountType::CHECKING, balances.data());
+    EXPECT_TRUE(defaults[3].empty());
+    EXPECT_FALSE(defaults[10].empty());
+    EXPECT_TRUE(defaults[11].empty());
+    EXPECT_TRUE(sut.createAccounts(0, AccountType::CHECKING, nullptr).empty());
+}
+
 
 // ============================================================================
 // Method: activateAccount()
@@ -284,8 +405,6 @@ protected:
     }
 };
 
-extern bool g_complianceAuditMode; // To modify the global variable
-
 // Parameters:
 // transactionCount, volumeLastDay, isVerified, hasFraudAlert, complianceAuditMode, ExpectedStatus
 INSTANTIATE_TEST_SUITE_P(
@@ -318,7 +437,7 @@ INSTANTIATE_TEST_SUITE_P(
 TEST_P(EvaluateRiskParamTest, SWE4_AccountManager_evaluateAccountRisk_MCDC) {
     auto [txCount, volLatest, isVerified, fraudAlert, auditMode, expectedStatus] = GetParam();
     
-    g_complianceAuditMode = auditMode;
+    ProcessingContext::global().complianceAuditMode = auditMode;
     std::string acc = sut.createAccount(AccountType::BUSINESS, 100.0);
     Account* ptr = sut.getAccount(acc);
     ptr->isVerified = isVerified;
@@ -331,7 +450,7 @@ TEST_P(EvaluateRiskParamTest, SWE4_AccountManager_evaluateAccountRisk_MCDC) {
     EXPECT_EQ(st, expectedStatus);
     
     // Reset global state
-    g_complianceAuditMode = false;
+    ProcessingContext::global().complianceAuditMode = false;
 }
 
 // Ensure unknown evaluateAccountRisk returns CLOSED
@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../inc/AccountJournal.hpp"
+#include "../inc/AccountManager.hpp"
+#include "../inc/AccountStatusIndex.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountStatusIndexUnitTest : public ::testing::Test {
+protected:
+    AccountStatusIndex sut;
+    std::string snapshotPath;
+    std::string walPath;
+
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        snapshotPath = ::testing::TempDir() + "SWE4_AccountStatusIndex_" + name + ".snap";
+        walPath = ::testing::TempDir() + "SWE4_AccountStatusIndex_" + name + ".wal";
+        std::remove(snapshotPath.c_str());
+        std::remove(walPath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(snapshotPath.c_str());
+        std::remove(walPath.c_str());
+    }
+
+    static std::vector<int> sorted(std::vector<int> ids) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> numbers) {
+        std::sort(numbers.begin(), numbers.end());
+        return numbers;
+    }
+
+    std::vector<int> withStatus(AccountStatus status) const {
+        std::vector<int> ids;
+        sut.collectWithStatus(status, ids);
+        return sorted(ids);
+    }
+};
+
+// ============================================================================
+// Method: update()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountStatusIndex::update() & collectWithStatus() & countWithStatus()
+/// Test goal: Moving an account leaves every other member of its old list in place
+/// In case: Four active accounts, the second one suspended, then frozen with a fraud alert
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountStatusIndexUnitTest, SWE4_AccountStatusIndex_update_Normal_MovesBetweenLists) {
+    for (int id = 1; id <= 4; ++id) {
+        sut.update(id, AccountStatus::ACTIVE, false, 0);
+    }
+    sut.update(2, AccountStatus::SUSPENDED, false, 0);
+    EXPECT_EQ(withStatus(AccountStatus::ACTIVE), (std::vector<int>{1, 3, 4}));
+    EXPECT_EQ(withStatus(AccountStatus::SUSPENDED), (std::vector<int>{2}));
+
+    sut.update(2, AccountStatus::FROZEN, true, 0);
+    sut.update(4, AccountStatus::FROZEN, false, 0);
+    EXPECT_EQ(sut.size(), 4u);
+    EXPECT_EQ(sut.countWithStatus(AccountStatus::SUSPENDED), 0u);
+    EXPECT_EQ(sut.countWithStatus(AccountStatus::FROZEN), 2u);
+    EXPECT_EQ(withStatus(AccountStatus::FROZEN), (std::vector<int>{2, 4}));
+
+    std::vector<int> flagged;
+    sut.collectWithStatus(AccountStatus::FROZEN, true, flagged);
+    EXPECT_EQ(flagged, (std::vector<int>{2}));
+    EXPECT_EQ(withStatus(AccountStatus::ACTIVE), (std::vector<int>{1, 3}));
+
+    sut.clear();
+    EXPECT_EQ(sut.size(), 0u);
+    EXPECT_TRUE(withStatus(AccountStatus::ACTIVE).empty());
+}
+
+// ============================================================================
+// Method: collectWithRiskAtLeast()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountStatusIndex::collectWithRiskAtLeast() & riskBucketOf()
+/// Test goal: Only the bucket holding the minimum is filtered and the last bucket is open-ended
+/// In case: Scores on both sides of the high-risk threshold and of every bucket bound, one rescored
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(AccountStatusIndexUnitTest, SWE4_AccountStatusIndex_collectWithRiskAtLeast_Boundary_BucketEdges) {
+    const int scores[] = {-5, 0, 24, 25, 74, 75, 76, 99, 100, 250};
+    for (int i = 0; i < 10; ++i) {
+        sut.update(i + 1, AccountStatus::ACTIVE, false, scores[i]);
+    }
+    EXPECT_EQ(AccountStatusIndex::riskBucketOf(-5), 0u);
+    EXPECT_EQ(AccountStatusIndex::riskBucketOf(25), 1u);
+    EXPECT_EQ(AccountStatusIndex::riskBucketOf(250), AccountStatusIndex::RISK_BUCKET_COUNT - 1);
+
+    std::vector<int> ids;
+    sut.collectWithRiskAtLeast(75, ids);
+    EXPECT_EQ(sorted(ids), (std::vector<int>{6, 7, 8, 9, 10}));
+    ids.clear();
+    sut.collectWithRiskAtLeast(76, ids);
+    EXPECT_EQ(sorted(ids), (std::vector<int>{7, 8, 9, 10}));
+    ids.clear();
+    sut.collectWithRiskAtLeast(-100, ids);
+    EXPECT_EQ(ids.size(), 10u);
+
+    // Rescoring moves the account out of the high buckets
+    sut.update(10, AccountStatus::ACTIVE, false, 10);
+    ids.clear();
+    sut.collectWithRiskAtLeast(100, ids);
+    EXPECT_EQ(ids, (std::vector<int>{9}));
+}
+
+// ============================================================================
+// Method: AccountManager::getAccountsByStatus()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::getAccountsByStatus() & getHighRiskAccounts() & getSuspendedAccountCount()
+/// Test goal: Every status change through the manager is reflected by the queries and the suspended count
+/// In case: Verify, suspend twice, reactivate, freeze with a fraud alert and a high-risk evaluation
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AccountStatusIndexUnitTest, SWE4_AccountStatusIndex_getAccountsByStatus_Normal_FollowsTransitions) {
+    AccountManager manager;
+    std::vector<std::string> numbers;
+    for (std::uint32_t owner = 1; owner <= 4; ++owner) {
+        numbers.push_back(manager.createAccount(AccountType::CHECKING, 100.0, owner));
+    }
+    EXPECT_EQ(manager.getAccountCountByStatus(AccountStatus::PENDING_VERIFICATION), 4);
+
+    ASSERT_TRUE(manager.verifyAccount(numbers[0], true));
+    ASSERT_TRUE(manager.verifyAccount(numbers[1], true));
+    EXPECT_EQ(sorted(manager.getAccountsByStatus(AccountStatus::ACTIVE)), sorted({numbers[0], numbers[1]}));
+
+    // A repeated suspension counts once, and reactivation leaves SUSPENDED
+    ASSERT_TRUE(manager.suspendAccount(numbers[0], "review"));
+    ASSERT_TRUE(manager.suspendAccount(numbers[0], "review"));
+    EXPECT_EQ(manager.getSuspendedAccountCount(), 1);
+    ASSERT_TRUE(manager.activateAccount(numbers[0]));
+    EXPECT_EQ(manager.getSuspendedAccountCount(), 0);
+    EXPECT_TRUE(manager.getAccountsByStatus(AccountStatus::SUSPENDED).empty());
+
+    // The alert written through the pointer is indexed by the next change of the account
+    manager.getAccount(numbers[1])->hasFraudAlert = true;
+    ASSERT_TRUE(manager.updateAccountStatus(numbers[1], AccountStatus::FROZEN));
+    EXPECT_EQ(manager.getAccountsByStatus(AccountStatus::FROZEN, true), std::vector<std::string>{numbers[1]});
+    EXPECT_TRUE(manager.getAccountsByStatus(AccountStatus::FROZEN, false).empty());
+
+    // Unverified with high activity scores 90 and is suspended
+    EXPECT_EQ(manager.evaluateAccountRisk(numbers[2], 150, 2000000.0), AccountStatus::SUSPENDED);
+    EXPECT_EQ(manager.getAccount(numbers[2])->riskScore, 90);
+    EXPECT_EQ(manager.evaluateAccountRisk(numbers[3], 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(manager.getAccount(numbers[3])->riskScore, 20);
+    EXPECT_EQ(manager.getHighRiskAccounts(), std::vector<std::string>{numbers[2]});
+    EXPECT_EQ(manager.getAccountsByStatus(AccountStatus::SUSPENDED), std::vector<std::string>{numbers[2]});
+    EXPECT_EQ(manager.getSuspendedAccountCount(), 1);
+    EXPECT_EQ(sorted(manager.getAccountsWithRiskAtLeast(1)), sorted({numbers[2], numbers[3]}));
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::getAccountsByStatus() & openSnapshot() & evaluateAllAccountsRisk()
+/// Test goal: The first query after opening a snapshot indexes the mapped accounts, and later changes follow
+/// In case: Mapped snapshot of six accounts in three statuses, one suspended after opening, then bulk evaluation
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(AccountStatusIndexUnitTest, SWE4_AccountStatusIndex_getAccountsByStatus_Normal_AfterOpenSnapshot) {
+    const AccountStatus statuses[] = {AccountStatus::ACTIVE, AccountStatus::ACTIVE, AccountStatus::FROZEN,
+                                      AccountStatus::FROZEN, AccountStatus::CLOSED, AccountStatus::ACTIVE};
+    std::vector<AccountLogRecord> records;
+    for (int i = 0; i < 6; ++i) {
+        const int accountId = 910000 + i;
+        Account account{"ACC" + std::to_string(accountId), AccountType::SAVINGS, statuses[i], 0.0, 0.0, 80 * (i % 2),
+                        true, i == 3};
+        records.push_back(AccountLogRecord::fromAccount(AccountLogOperation::CREATE, accountId, account, 0));
+    }
+    AccountSnapshotHeader header{};
+    header.accountCounter = 910006;
+    ASSERT_TRUE(AccountSnapshot::write(snapshotPath, header, records));
+
+    AccountManager manager;
+    ASSERT_TRUE(manager.openSnapshot(snapshotPath, walPath));
+    EXPECT_EQ(sorted(manager.getAccountsByStatus(AccountStatus::ACTIVE)),
+              sorted({"ACC910000", "ACC910001", "ACC910005"}));
+    EXPECT_EQ(manager.getAccountsByStatus(AccountStatus::FROZEN, true), std::vector<std::string>{"ACC910003"});
+    EXPECT_EQ(sorted(manager.getHighRiskAccounts()), sorted({"ACC910001", "ACC910003", "ACC910005"}));
+
+    ASSERT_TRUE(manager.suspendAccount("ACC910000", "review"));
+    EXPECT_EQ(manager.getAccountsByStatus(AccountStatus::SUSPENDED), std::vector<std::string>{"ACC910000"});
+    EXPECT_EQ(manager.getAccountCountByStatus(AccountStatus::ACTIVE), 2);
+
+    // Verified accounts without an alert and without activity score zero in bulk
+    std::vector<int> counts(6, 0);
+    std::vector<double> volumes(6, 0.0);
+    manager.evaluateAllAccountsRisk(counts.data(), volumes.data());
+    EXPECT_EQ(manager.getHighRiskAccounts(), std::vector<std::string>{});
+    EXPECT_EQ(manager.getAccountsWithRiskAtLeast(25), std::vector<std::string>{"ACC910003"});
+}
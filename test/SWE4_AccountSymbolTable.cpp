@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountSymbolTable.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Stub audit service consuming the entry views without copying them
+// ============================================================================
+
+class ViewAuditLoggingService : public AuditLoggingService {
+public:
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+
+    bool logTransaction(const std::string&, const std::string&, const std::string&) override { return true; }
+    bool logAccountEvent(const std::string&, const std::string&, const std::string&) override { return true; }
+    std::vector<std::string> getAuditTrail(const std::string&) override { return {}; }
+    bool archiveAuditLogs(const std::string&) override { return true; }
+
+    bool logTransactionEntry(const AuditEntry& entry) override {
+        entries++;
+        bytes += entry.accountNumber.size() + entry.transactionDetails.size() + entry.eventDetails.size();
+        return true;
+    }
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AccountSymbolTableUnitTest : public ::testing::Test {
+protected:
+    AccountSymbolTable sut;
+};
+
+// ============================================================================
+// Method: intern()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountSymbolTable::intern() & name()
+/// Test goal: Equal account numbers share one symbol and names round-trip
+/// In case: Intern enough distinct names to force several rehashes, then repeat them
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountSymbolTableUnitTest, SWE4_AccountSymbolTable_intern_Normal_StableSymbols) {
+    std::vector<AccountSymbol> symbols;
+    for (int i = 0; i < 1000; ++i) {
+        symbols.push_back(sut.intern("ACC" + std::to_string(500000 + i)));
+    }
+
+    for (int i = 0; i < 1000; ++i) {
+        std::string accountNumber = "ACC" + std::to_string(500000 + i);
+        EXPECT_EQ(sut.intern(accountNumber), symbols[i]);
+        EXPECT_EQ(sut.name(symbols[i]), accountNumber);
+    }
+    EXPECT_EQ(sut.size(), 1001u);
+}
+
+/// ===========================================================================
+/// Verifies: AccountSymbolTable::intern() & find()
+/// Test goal: The empty account number maps to EMPTY_ACCOUNT and unknown names are not interned by find
+/// In case: Empty string, unknown name, unknown symbol
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(AccountSymbolTableUnitTest, SWE4_AccountSymbolTable_find_Boundary_EmptyAndUnknown) {
+    EXPECT_EQ(sut.intern(""), AccountSymbolTable::EMPTY_ACCOUNT);
+    EXPECT_EQ(sut.name(AccountSymbolTable::EMPTY_ACCOUNT), "");
+    EXPECT_EQ(sut.find("ACC1"), AccountSymbolTable::NO_SYMBOL);
+    EXPECT_EQ(sut.size(), 1u);
+    EXPECT_EQ(sut.name(12345), "");
+
+    AccountSymbol symbol = sut.intern("ACC1");
+    EXPECT_EQ(sut.find("ACC1"), symbol);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & getAccountName()
+/// Test goal: Concurrent transactions intern each account once, in the table of their own processor
+/// In case: Four threads deposit to the same 200 accounts in different orders; a second processor
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AccountSymbolTableUnitTest, SWE4_AccountSymbolTable_processTransaction_Normal_ConcurrentInterning) {
+    const int names = 200;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&processor, t]() {
+            for (int n = 0; n < names; ++n) {
+                int i = (t % 2 == 0) ? n : names - 1 - n;
+                processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC" + std::to_string(i), "");
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(processor.getTransactionCount(), 4 * names);
+    EXPECT_EQ(processor.getAccountSymbolCount(), static_cast<std::size_t>(names + 1));
+    for (int i = 0; i < names; ++i) {
+        const AccountSymbol symbol = processor.internAccount("ACC" + std::to_string(i));
+        EXPECT_EQ(processor.getAccountName(symbol), "ACC" + std::to_string(i));
+    }
+    EXPECT_EQ(processor.getAccountSymbolCount(), static_cast<std::size_t>(names + 1));
+
+    // Symbols are scoped to their processor, so another one starts with only the empty account
+    TransactionProcessor other;
+    EXPECT_EQ(other.getAccountSymbolCount(), 1u);
+    EXPECT_EQ(other.getAccountName(AccountSymbolTable::EMPTY_ACCOUNT), "");
+}
+
+/// ===========================================================================
+/// Verifies: AuditLoggingService::logTransactionEntry()
+/// Test goal: The default implementation forwards the same text the string-based audit used
+/// In case: Process a deposit through a service that only overrides the string methods
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(AccountSymbolTableUnitTest, SWE4_AccountSymbolTable_logTransactionEntry_Normal_DefaultForwards) {
+    class RecordingAuditLoggingService : public ViewAuditLoggingService {
+    public:
+        std::vector<std::string> calls;
+        bool logTransaction(const std::string& account, const std::string& details, const std::string&) override {
+            calls.push_back(account + "|" + details);
+            return true;
+        }
+        bool logAccountEvent(const std::string& account, const std::string& type, const std::string& details) override {
+            calls.push_back(account + "|" + type + "|" + details.substr(0, 13));
+            return true;
+        }
+        bool logTransactionEntry(const AuditEntry& entry) override {
+            return AuditLoggingService::logTransactionEntry(entry);
+        }
+    };
+
+    RecordingAuditLoggingService audit;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setAuditService(&audit);
+    processor.processTransaction(TransactionType::DEPOSIT, 12.5, "ACC7", "");
+
+    ASSERT_EQ(audit.calls.size(), 2u);
+    EXPECT_EQ(audit.calls[0], "ACC7|" + std::to_string(12.5));
+    EXPECT_EQ(audit.calls[1], "ACC7|TRANSACTION_PROCESSED|Transaction: ");
+}
@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/AsyncExternalServices.hpp"
+#include "../inc/ConcurrentAccountManager.hpp"
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+// ============================================================================
+// Stub and mock classes for the blocking services
+// ============================================================================
+
+// Every lookup takes a fixed time and records how many lookups overlap
+class SlowExternalDataService : public ExternalDataService {
+public:
+    std::atomic<int> inFlight{0};
+    std::atomic<int> maxInFlight{0};
+    std::atomic<int> calls{0};
+
+    std::string getCreditScore(const std::string&) override {
+        lookup();
+        return "720";
+    }
+    std::string getIdentityVerificationStatus(const std::string&) override {
+        lookup();
+        return "VERIFIED";
+    }
+    bool validateBankAccount(const std::string&, const std::string&) override { return true; }
+    std::vector<std::string> getLinkedAccounts(const std::string&) override {
+        lookup();
+        return {"ACC1"};
+    }
+
+private:
+    void lookup() {
+        calls++;
+        int now = ++inFlight;
+        int seen = maxInFlight.load();
+        while (now > seen && !maxInFlight.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        inFlight--;
+    }
+};
+
+class MockNotificationService : public NotificationService {
+public:
+    MOCK_METHOD(bool, sendEmailNotification, (const std::string& email, const std::string& subject, const std::string& body), (override));
+    MOCK_METHOD(bool, sendSmsNotification, (const std::string& phoneNumber, const std::string& message), (override));
+    MOCK_METHOD(bool, sendPushNotification, (const std::string& deviceToken, const std::string& title, const std::string& message), (override));
+    MOCK_METHOD(bool, subscribeToNotifications, (const std::string& accountNumber, const std::string& notificationType), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AsyncExternalServicesUnitTest : public ::testing::Test {
+protected:
+    SlowExternalDataService dataService;
+    NiceMock<MockNotificationService> notificationService;
+    ServiceCallExecutor executor{4};
+    ExecutorExternalDataService asyncDataService{dataService, executor};
+    ExecutorNotificationService asyncNotificationService{notificationService, executor};
+    AccountManager sut;
+
+    void SetUp() override {
+        ON_CALL(notificationService, sendEmailNotification(_, _, _)).WillByDefault(Return(true));
+        sut.setAsyncExternalDataService(&asyncDataService);
+        sut.setAsyncNotificationService(&asyncNotificationService);
+    }
+};
+
+// ============================================================================
+// Class: ServiceCallExecutor
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ServiceCallExecutor::submit() & drain()
+/// Test goal: Results and exceptions reach the futures, and drain waits for posted tasks
+/// In case: One value-returning call, one throwing call, several posted tasks
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_submit_Normal_ResultsAndErrors) {
+    std::future<int> value = executor.submit([]() { return 42; });
+    std::future<int> failure = executor.submit([]() -> int { throw std::runtime_error("backend down"); });
+    std::atomic<int> posted{0};
+    for (int i = 0; i < 10; ++i) {
+        executor.post([&posted]() { posted++; });
+    }
+
+    EXPECT_EQ(value.get(), 42);
+    EXPECT_THROW(failure.get(), std::runtime_error);
+    executor.drain();
+    EXPECT_EQ(posted.load(), 10);
+    EXPECT_EQ(executor.getPendingCount(), 0u);
+}
+
+// ============================================================================
+// Method: AccountManager::verifyAccountAsync()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::verifyAccountAsync()
+/// Test goal: The identity and credit lookups of one verification overlap
+/// In case: Verify a pending account through the executor-backed services
+/// Method for Verification: Concurrency check on the stub service
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_verifyAccountAsync_Normal_ConcurrentLookups) {
+    EXPECT_CALL(notificationService, sendEmailNotification("user@example.com", "Account Verified", _)).Times(1);
+    std::string acc = sut.createAccount(AccountType::CHECKING, 100.0);
+
+    std::future<bool> result = sut.verifyAccountAsync(acc, true);
+
+    // The account is updated before the future completes
+    EXPECT_EQ(sut.getAccount(acc)->status, AccountStatus::ACTIVE);
+    EXPECT_TRUE(sut.getAccount(acc)->isVerified);
+    EXPECT_TRUE(result.get());
+    EXPECT_EQ(dataService.calls.load(), 2);
+    EXPECT_EQ(dataService.maxInFlight.load(), 2);
+    executor.drain();
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::verifyAccountAsync()
+/// Test goal: Many verifications can be in flight from a single caller thread
+/// In case: Issue every verification before waiting on any
+/// Method for Verification: Concurrency check on the stub service
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_verifyAccountAsync_Normal_ManyInFlight) {
+    std::vector<std::string> accounts;
+    for (int i = 0; i < AccountManager::getMaxAccountsPerUser(); ++i) {
+        accounts.push_back(sut.createAccount(AccountType::SAVINGS, 50.0));
+    }
+
+    std::vector<std::future<bool>> results;
+    for (const std::string& acc : accounts) {
+        results.push_back(sut.verifyAccountAsync(acc, true));
+    }
+    for (std::future<bool>& result : results) {
+        EXPECT_TRUE(result.get());
+    }
+
+    EXPECT_EQ(dataService.calls.load(), 2 * AccountManager::getMaxAccountsPerUser());
+    EXPECT_GE(dataService.maxInFlight.load(), 2);
+    EXPECT_LE(dataService.maxInFlight.load(), 4);
+    executor.drain();
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::verifyAccountAsync()
+/// Test goal: Unknown accounts complete immediately without any service call
+/// In case: Account number that was never created
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_verifyAccountAsync_Error_NotFound) {
+    EXPECT_CALL(notificationService, sendEmailNotification(_, _, _)).Times(0);
+    std::future<bool> result = sut.verifyAccountAsync("ACC1", true);
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_FALSE(result.get());
+    EXPECT_EQ(dataService.calls.load(), 0);
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::verifyAccountAsync()
+/// Test goal: Without an async data service the blocking services are used, as in verifyAccount
+/// In case: Only the blocking data and notification services are set
+/// Method for Verification: Comparison against the synchronous implementation
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_verifyAccountAsync_Normal_BlockingFallback) {
+    AccountManager blocking;
+    blocking.setExternalDataService(&dataService);
+    blocking.setNotificationService(&notificationService);
+    EXPECT_CALL(notificationService, sendEmailNotification(_, _, _)).Times(1);
+    std::string acc = blocking.createAccount(AccountType::CHECKING, 100.0);
+
+    std::future<bool> result = blocking.verifyAccountAsync(acc, true);
+    EXPECT_EQ(result.wait_for(std::chrono::seconds(0)), std::future_status::ready);
+    EXPECT_TRUE(result.get());
+    EXPECT_EQ(dataService.calls.load(), 2);
+    EXPECT_EQ(dataService.maxInFlight.load(), 1);
+}
+
+// ============================================================================
+// Method: AccountManager::evaluateAccountRiskAsync()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAccountRiskAsync()
+/// Test goal: The asynchronous evaluation returns and stores the synchronous outcome
+/// In case: High-risk inputs that suspend the account
+/// Method for Verification: Comparison against the synchronous implementation
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_evaluateAccountRiskAsync_Normal_MatchesSync) {
+    AccountManager reference;
+    std::string referenceAcc = reference.createAccount(AccountType::BUSINESS, 100.0);
+    std::string acc = sut.createAccount(AccountType::BUSINESS, 100.0);
+
+    std::future<AccountStatus> result = sut.evaluateAccountRiskAsync(acc, 150, 2000000.0);
+    AccountStatus expected = reference.evaluateAccountRisk(referenceAcc, 150, 2000000.0);
+
+    EXPECT_EQ(result.get(), expected);
+    EXPECT_EQ(sut.getAccount(acc)->status, expected);
+    EXPECT_EQ(sut.getSuspendedAccountCount(), reference.getSuspendedAccountCount());
+    EXPECT_EQ(dataService.calls.load(), 1);
+    EXPECT_EQ(sut.evaluateAccountRiskAsync("ACC1", 0, 0.0).get(), AccountStatus::CLOSED);
+}
+
+// ============================================================================
+// Class: ExecutorNotificationService
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ExecutorNotificationService::sendEmailNotificationAsync()
+/// Test goal: Failed and throwing deliveries are counted without reaching the caller
+/// In case: Back end returns false once and throws once
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_sendEmailNotificationAsync_Error_FailuresCounted) {
+    EXPECT_CALL(notificationService, sendEmailNotification(_, _, _))
+        .WillOnce(Return(false))
+        .WillOnce([](const std::string&, const std::string&, const std::string&) -> bool {
+            throw std::runtime_error("smtp down");
+        })
+        .WillOnce(Return(true));
+
+    asyncNotificationService.sendEmailNotificationAsync("a@example.com", "s", "b");
+    asyncNotificationService.sendEmailNotificationAsync("b@example.com", "s", "b");
+    asyncNotificationService.sendEmailNotificationAsync("c@example.com", "s", "b");
+    executor.drain();
+
+    EXPECT_EQ(asyncNotificationService.getFailedCount(), 2u);
+}
+
+// ============================================================================
+// Method: ConcurrentAccountManager::verifyAccountAsync()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::verifyAccountAsync()
+/// Test goal: The sharded manager forwards the async entry points to the owning shard
+/// In case: Verify and evaluate one account through the executor-backed services
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(AsyncExternalServicesUnitTest, SWE4_AsyncExternalServices_ConcurrentAccountManager_Normal_Forwards) {
+    ConcurrentAccountManager concurrent{4};
+    concurrent.setAsyncExternalDataService(&asyncDataService);
+    concurrent.setAsyncNotificationService(&asyncNotificationService);
+    std::string acc = concurrent.createAccount(AccountType::CHECKING, 100.0);
+
+    EXPECT_TRUE(concurrent.verifyAccountAsync(acc, true).get());
+    EXPECT_EQ(concurrent.evaluateAccountRiskAsync(acc, 5, 10.0).get(), AccountStatus::ACTIVE);
+    EXPECT_EQ(dataService.calls.load(), 3);
+    executor.drain();
+}
@@ -0,0 +1,315 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountSymbolTable.hpp"
+#include "../inc/BatchedAuditWriter.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Stub Classes
+// ============================================================================
+
+// Copies every batch it receives, with the thread that delivered it
+class RecordingAuditService : public AuditLoggingService {
+public:
+    struct LoggedEntry {
+        std::string accountNumber;
+        std::string transactionDetails;
+        std::string timestamp;
+        std::string eventDetails;
+    };
+
+    mutable std::mutex mutex;
+    std::vector<std::vector<LoggedEntry>> batches;
+    std::vector<std::thread::id> threads;
+    std::atomic<bool> accepting{true};
+
+    bool logTransaction(const std::string&, const std::string&, const std::string&) override { return true; }
+    bool logAccountEvent(const std::string&, const std::string&, const std::string&) override { return true; }
+    std::vector<std::string> getAuditTrail(const std::string&) override { return {}; }
+    bool archiveAuditLogs(const std::string&) override { return true; }
+
+    bool logTransactionEntry(const AuditEntry& entry) override {
+        return logTransactionBatch(std::vector<AuditEntry>{entry});
+    }
+
+    bool logTransactionBatch(const std::vector<AuditEntry>& entries) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        batches.emplace_back();
+        for (const AuditEntry& entry : entries) {
+            batches.back().push_back(LoggedEntry{std::string(entry.accountNumber), std::string(entry.transactionDetails),
+                                                 std::string(entry.timestamp), std::string(entry.eventDetails)});
+        }
+        threads.push_back(std::this_thread::get_id());
+        return accepting.load();
+    }
+
+    std::vector<LoggedEntry> entries() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<LoggedEntry> all;
+        for (const std::vector<LoggedEntry>& batch : batches) {
+            all.insert(all.end(), batch.begin(), batch.end());
+        }
+        return all;
+    }
+
+    // Polls until the given number of entries arrived; false after two seconds
+    bool waitForEntries(std::size_t count) const {
+        for (int i = 0; i < 2000; ++i) {
+            if (entries().size() >= count) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    }
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class BatchedAuditWriterUnitTest : public ::testing::Test {
+protected:
+    RecordingAuditService service;
+
+    AuditRecord record(int transactionId, double amount = 10.0) const {
+        const Transaction transaction{transactionId, TransactionType::DEPOSIT, Money(amount),
+                                      AccountSymbolTable::EMPTY_ACCOUNT, AccountSymbolTable::EMPTY_ACCOUNT, 0,
+                                      TransactionStatus::COMPLETED};
+        return BatchedAuditWriter::makeRecord(transaction, static_cast<std::time_t>(1700000000));
+    }
+};
+
+// ============================================================================
+// Method: formatEntry()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::formatEntry()
+/// Test goal: A record is formatted into the text the audit service always received
+/// In case: A record with a fractional amount
+/// Method for Verification: Comparison against the std::to_string formatting
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_formatEntry_Normal_LegacyText) {
+    char text[BatchedAuditWriter::ENTRY_TEXT_SIZE];
+    const AuditEntry entry = BatchedAuditWriter::formatEntry(record(42, 1250.75), "ACC1", text);
+    EXPECT_EQ(entry.accountNumber, "ACC1");
+    EXPECT_EQ(entry.transactionDetails, std::to_string(1250.75));
+    EXPECT_EQ(entry.timestamp, std::to_string(1700000000LL));
+    EXPECT_EQ(entry.eventType, "TRANSACTION_PROCESSED");
+    EXPECT_EQ(entry.eventDetails, "Transaction: 42");
+}
+
+// ============================================================================
+// Method: submit()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::submit() & flush()
+/// Test goal: A full thread buffer wakes the flush thread, and no batch exceeds the batch size
+/// In case: Ten records with a batch size of four and a flush interval that never expires
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_submit_Boundary_SizeBoundBatches) {
+    BatchedAuditWriter sut(service, 4, std::chrono::hours(1));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_TRUE(sut.submit(record(i), "ACC1"));
+    }
+    EXPECT_TRUE(service.waitForEntries(8));
+
+    EXPECT_TRUE(sut.flush());
+    const std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), 10u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(entries[i].eventDetails, "Transaction: " + std::to_string(i));
+    }
+    for (const std::vector<RecordingAuditService::LoggedEntry>& batch : service.batches) {
+        EXPECT_LE(batch.size(), 4u);
+    }
+    EXPECT_NE(service.threads.front(), std::this_thread::get_id());
+
+    const BatchedAuditWriterStats stats = sut.getStats();
+    EXPECT_EQ(stats.submittedCount, 10u);
+    EXPECT_EQ(stats.writtenCount, 10u);
+    EXPECT_EQ(stats.batchCount, service.batches.size());
+}
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::submit()
+/// Test goal: Buffered records are written by the flush thread once the flush interval passes
+/// In case: Three records, far below the batch size, with a 5 ms flush interval
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_submit_Normal_TimeBoundFlush) {
+    BatchedAuditWriter sut(service, 1000, std::chrono::milliseconds(5));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_TRUE(sut.submit(record(i), "ACC1"));
+    }
+
+    ASSERT_TRUE(service.waitForEntries(3));
+    std::lock_guard<std::mutex> lock(service.mutex);
+    for (std::thread::id thread : service.threads) {
+        EXPECT_NE(thread, std::this_thread::get_id());
+    }
+}
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::submit()
+/// Test goal: A durable record is written before submit returns, after the records buffered before it
+/// In case: Two buffered records followed by a durable one, then a durable one the service refuses
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_submit_Error_DurableWritesThrough) {
+    BatchedAuditWriter sut(service, 1000, std::chrono::hours(1));
+    EXPECT_TRUE(sut.submit(record(1), "ACC1"));
+    EXPECT_TRUE(sut.submit(record(2), "ACC1"));
+    EXPECT_TRUE(service.entries().empty());
+
+    EXPECT_TRUE(sut.submit(record(3), "ACC1", AuditDurability::DURABLE));
+    std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), 3u);
+    EXPECT_EQ(entries[0].eventDetails, "Transaction: 1");
+    EXPECT_EQ(entries[2].eventDetails, "Transaction: 3");
+
+    service.accepting = false;
+    EXPECT_FALSE(sut.submit(record(4), "ACC1", AuditDurability::DURABLE));
+    const BatchedAuditWriterStats stats = sut.getStats();
+    EXPECT_EQ(stats.durableCount, 2u);
+    EXPECT_EQ(stats.writtenCount, 3u);
+    EXPECT_EQ(stats.failedCount, 1u);
+}
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::submit() & flush()
+/// Test goal: Source accounts of any length reach the service in full, buffered or written through
+/// In case: A 34-character IBAN, an empty account and a short one buffered, then a durable IBAN
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_submit_Boundary_LongAccount) {
+    const std::string iban = "GB33BUKB20201555555555DE8912345678";
+    ASSERT_EQ(iban.size(), 34u);
+    BatchedAuditWriter sut(service, 1000, std::chrono::hours(1));
+
+    EXPECT_TRUE(sut.submit(record(1), iban));
+    EXPECT_TRUE(sut.submit(record(2), ""));
+    EXPECT_TRUE(sut.submit(record(3), "ACC3"));
+    EXPECT_TRUE(sut.flush());
+    EXPECT_TRUE(sut.submit(record(4), "ACC4"));
+    EXPECT_TRUE(sut.submit(record(5), iban + "X", AuditDurability::DURABLE));
+
+    const std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), 5u);
+    EXPECT_EQ(entries[0].accountNumber, iban);
+    EXPECT_EQ(entries[1].accountNumber, "");
+    EXPECT_EQ(entries[2].accountNumber, "ACC3");
+    EXPECT_EQ(entries[3].accountNumber, "ACC4");
+    EXPECT_EQ(entries[4].accountNumber, iban + "X");
+}
+
+/// ===========================================================================
+/// Verifies: BatchedAuditWriter::submit() & flush()
+/// Test goal: Records of concurrent producers all arrive, each producer's in submission order
+/// In case: Four threads of 2000 records each, batches of 64 and a 1 ms flush interval
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_submit_Normal_ConcurrentProducers) {
+    const int threadCount = 4;
+    const int perThread = 2000;
+    {
+        BatchedAuditWriter sut(service, 64, std::chrono::milliseconds(1));
+        std::vector<std::thread> producers;
+        for (int t = 0; t < threadCount; ++t) {
+            producers.emplace_back([&sut, this, t]() {
+                const std::string account = "ACC" + std::to_string(t);
+                for (int i = 0; i < perThread; ++i) {
+                    sut.submit(record(t * perThread + i), account);
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        EXPECT_EQ(sut.getStats().submittedCount, static_cast<std::size_t>(threadCount * perThread));
+    }
+
+    // The destructor wrote what was left
+    const std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), static_cast<std::size_t>(threadCount * perThread));
+    std::vector<int> next(threadCount, 0);
+    for (const RecordingAuditService::LoggedEntry& entry : entries) {
+        const int id = std::stoi(entry.eventDetails.substr(std::string("Transaction: ").size()));
+        const int thread = id / perThread;
+        ASSERT_EQ(id % perThread, next[thread]);
+        ASSERT_EQ(entry.accountNumber, "ACC" + std::to_string(thread));
+        next[thread]++;
+    }
+}
+
+// ============================================================================
+// Method: TransactionProcessor::setAuditWriter()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::setAuditWriter() & processTransaction() & processBatch()
+/// Test goal: The processor submits records to the writer, writing large transactions through
+/// In case: A small deposit, a batch of small deposits, then a deposit above the urgent-transfer threshold
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_setAuditWriter_Normal_ProcessorRecords) {
+    ProcessingContext context;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setProcessingContext(&context);
+    BatchedAuditWriter sut(service, 1000, std::chrono::hours(1));
+    processor.setAuditWriter(&sut);
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 100.0, "ACC7", ""), TransactionStatus::COMPLETED);
+    std::vector<TransactionRequest> requests(3, TransactionRequest{TransactionType::DEPOSIT, 5.0, "ACC8", ""});
+    processor.processBatch(requests);
+    EXPECT_TRUE(service.entries().empty());
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 150000.0, "ACC9", ""), TransactionStatus::COMPLETED);
+    const std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), 5u);
+    EXPECT_EQ(entries[0].accountNumber, "ACC7");
+    EXPECT_EQ(entries[0].transactionDetails, std::to_string(100.0));
+    EXPECT_EQ(entries[1].accountNumber, "ACC8");
+    EXPECT_EQ(entries[4].accountNumber, "ACC9");
+    EXPECT_EQ(entries[4].transactionDetails, std::to_string(150000.0));
+    EXPECT_EQ(sut.getStats().durableCount, 1u);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & processBatch()
+/// Test goal: Without a writer the audit entries view the source account in full
+/// In case: A 34-character IBAN as the source of a deposit and of a batch of two deposits
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(BatchedAuditWriterUnitTest, SWE4_BatchedAuditWriter_processTransaction_Boundary_DirectLongAccount) {
+    const std::string iban = "GB33BUKB20201555555555DE8912345678";
+    ProcessingContext context;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setProcessingContext(&context);
+    processor.setAuditService(&service);
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 100.0, iban, ""), TransactionStatus::COMPLETED);
+    std::vector<TransactionRequest> requests(2, TransactionRequest{TransactionType::DEPOSIT, 5.0, iban, ""});
+    processor.processBatch(requests);
+
+    const std::vector<RecordingAuditService::LoggedEntry> entries = service.entries();
+    ASSERT_EQ(entries.size(), 3u);
+    for (const RecordingAuditService::LoggedEntry& entry : entries) {
+        EXPECT_EQ(entry.accountNumber, iban);
+    }
+}
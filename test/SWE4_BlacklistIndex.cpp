@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/BlacklistIndex.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockBlacklistBackend : public ComplianceCheckService {
+public:
+    MOCK_METHOD(ComplianceLevel, checkComplianceLevel, (const std::string& accountNumber), (override));
+    MOCK_METHOD(bool, reportSuspiciousActivity, (const std::string& accountNumber, const std::string& description), (override));
+    MOCK_METHOD(std::vector<std::string>, getBlacklist, (), (override));
+    MOCK_METHOD(bool, isAccountBlacklisted, (const std::string& accountNumber), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class BlacklistIndexUnitTest : public ::testing::Test {
+protected:
+    BlacklistIndex sut;
+    NiceMock<MockBlacklistBackend> backend;
+
+    static std::vector<std::string> makeIds(int first, int count) {
+        std::vector<std::string> ids;
+        for (int i = 0; i < count; ++i) {
+            ids.push_back("ACC" + std::to_string(first + i));
+        }
+        return ids;
+    }
+};
+
+// ============================================================================
+// Method: contains()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: BlacklistIndex::load() & contains()
+/// Test goal: Every loaded id is found and nothing is found before the first load
+/// In case: Unsorted ids with a duplicate
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_contains_Normal_LoadedIds) {
+    EXPECT_FALSE(sut.contains("ACC1"));
+    EXPECT_FALSE(sut.mayContain("ACC1"));
+    EXPECT_EQ(sut.size(), 0u);
+
+    sut.load({"ACC3", "ACC1", "ACC2", "ACC1"});
+
+    EXPECT_EQ(sut.size(), 3u);
+    EXPECT_TRUE(sut.contains("ACC1"));
+    EXPECT_TRUE(sut.contains("ACC2"));
+    EXPECT_TRUE(sut.contains("ACC3"));
+    EXPECT_TRUE(sut.mayContain("ACC2"));
+    EXPECT_FALSE(sut.contains("ACC4"));
+    EXPECT_FALSE(sut.contains(""));
+}
+
+/// ===========================================================================
+/// Verifies: BlacklistIndex::mayContain()
+/// Test goal: The filter alone clears at least 99% of clean accounts at the default size
+/// In case: 100000 blacklisted ids probed with 100000 clean ids
+/// Method for Verification: False positive rate measurement
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_mayContain_Normal_FalsePositiveRate) {
+    sut.load(makeIds(1000000, 100000));
+
+    int falsePositives = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const std::string clean = "ACC" + std::to_string(5000000 + i);
+        if (sut.mayContain(clean)) {
+            falsePositives++;
+        }
+        EXPECT_FALSE(sut.contains(clean));
+    }
+
+    EXPECT_LT(falsePositives, 1000);
+    // Filter at 16 bits per id plus headroom, exact set at one small string per id
+    EXPECT_LT(sut.getMemoryUsage(), 100000u * (16 / 8 + 1 + sizeof(std::string)) + 4096u);
+}
+
+// ============================================================================
+// Method: load()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: BlacklistIndex::load()
+/// Test goal: Additions extend the filter in place, removals rebuild it
+/// In case: Initial load, superset load, load with one id removed
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_load_Normal_IncrementalAndRebuild) {
+    sut.load(makeIds(1, 100));
+    EXPECT_EQ(sut.getRebuildCount(), 1u);
+
+    sut.load(makeIds(1, 110));
+    EXPECT_EQ(sut.getRebuildCount(), 1u);
+    EXPECT_TRUE(sut.contains("ACC110"));
+
+    sut.load(makeIds(2, 109));
+    EXPECT_EQ(sut.getRebuildCount(), 2u);
+    EXPECT_FALSE(sut.contains("ACC1"));
+    EXPECT_TRUE(sut.contains("ACC110"));
+    EXPECT_EQ(sut.getRefreshCount(), 3u);
+}
+
+/// ===========================================================================
+/// Verifies: BlacklistIndex::load()
+/// Test goal: Additions beyond the filter headroom force a rebuild and stay findable
+/// In case: Grow from 10 ids to 1000 ids
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_load_Boundary_HeadroomExhausted) {
+    sut.load(makeIds(1, 10));
+    sut.load(makeIds(1, 1000));
+
+    EXPECT_EQ(sut.getRebuildCount(), 2u);
+    for (const std::string& id : makeIds(1, 1000)) {
+        EXPECT_TRUE(sut.contains(id));
+    }
+}
+
+// ============================================================================
+// Method: startBackgroundRefresh()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: BlacklistIndex::startBackgroundRefresh() & stopBackgroundRefresh()
+/// Test goal: The background thread picks up new blacklist ids and survives a failing back end
+/// In case: Back end answers, throws, then answers with an added id
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_startBackgroundRefresh_Error_BackendThrows) {
+    std::atomic<int> calls{0};
+    ON_CALL(backend, getBlacklist()).WillByDefault([&calls]() -> std::vector<std::string> {
+        int call = ++calls;
+        if (call == 1) {
+            return {"ACC1"};
+        }
+        if (call == 2) {
+            throw std::runtime_error("compliance back end down");
+        }
+        return {"ACC1", "ACC2"};
+    });
+
+    sut.startBackgroundRefresh(backend, std::chrono::milliseconds(1));
+    for (int i = 0; i < 2000 && !sut.contains("ACC2"); ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    sut.stopBackgroundRefresh();
+
+    EXPECT_TRUE(sut.contains("ACC1"));
+    EXPECT_TRUE(sut.contains("ACC2"));
+    EXPECT_GE(calls.load(), 3);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & processBatch()
+/// Test goal: Blacklisted sources are rejected without calling the compliance service
+/// In case: One blacklisted and one clean source, single and batched
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(BlacklistIndexUnitTest, SWE4_BlacklistIndex_processTransaction_Normal_RejectsLocally) {
+    ON_CALL(backend, checkComplianceLevel(_)).WillByDefault(Return(ComplianceLevel::LOW_RISK));
+    EXPECT_CALL(backend, checkComplianceLevel("ACC666")).Times(0);
+    EXPECT_CALL(backend, checkComplianceLevel("ACC500001")).Times(2);
+    sut.load({"ACC666"});
+
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setComplianceService(&backend);
+    processor.setBlacklistIndex(&sut);
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC666", ""),
+              TransactionStatus::REJECTED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC500001", ""),
+              TransactionStatus::COMPLETED);
+
+    std::vector<TransactionRequest> batch = {
+        {TransactionType::DEPOSIT, 10.0, "ACC666", ""},
+        {TransactionType::DEPOSIT, 10.0, "ACC500001", ""}
+    };
+    std::vector<TransactionStatus> results = processor.processBatch(batch);
+    EXPECT_EQ(results[0], TransactionStatus::REJECTED);
+    EXPECT_EQ(results[1], TransactionStatus::COMPLETED);
+}
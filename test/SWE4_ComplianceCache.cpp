@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <string>
+
+#include "../inc/ComplianceCache.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockComplianceBackend : public ComplianceCheckService {
+public:
+    MOCK_METHOD(ComplianceLevel, checkComplianceLevel, (const std::string& accountNumber), (override));
+    MOCK_METHOD(bool, reportSuspiciousActivity, (const std::string& accountNumber, const std::string& description), (override));
+    MOCK_METHOD(std::vector<std::string>, getBlacklist, (), (override));
+    MOCK_METHOD(bool, isAccountBlacklisted, (const std::string& accountNumber), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class ComplianceCacheUnitTest : public ::testing::Test {
+protected:
+    NiceMock<MockComplianceBackend> backend;
+    std::chrono::steady_clock::time_point now{};
+    CachingComplianceCheckService sut{backend, std::chrono::seconds(60), std::chrono::seconds(600), 3,
+                                      [this]() { return now; }};
+
+    void SetUp() override {
+        ON_CALL(backend, checkComplianceLevel(_)).WillByDefault(Return(ComplianceLevel::LOW_RISK));
+        ON_CALL(backend, reportSuspiciousActivity(_, _)).WillByDefault(Return(true));
+    }
+};
+
+// ============================================================================
+// Method: checkComplianceLevel()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::checkComplianceLevel()
+/// Test goal: Repeated checks within the TTL are served from the cache and counted as hits
+/// In case: Same account checked three times at the same instant
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_checkComplianceLevel_Normal_HitWithinTtl) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC1")).Times(1).WillOnce(Return(ComplianceLevel::MEDIUM_RISK));
+
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::MEDIUM_RISK);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::MEDIUM_RISK);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::MEDIUM_RISK);
+
+    EXPECT_EQ(sut.getMissCount(), 1u);
+    EXPECT_EQ(sut.getHitCount(), 2u);
+    EXPECT_EQ(sut.size(), 1u);
+}
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::checkComplianceLevel()
+/// Test goal: A HIGH_RISK decision is not served once its TTL has elapsed
+/// In case: Clock exactly at and just before the expiry
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_checkComplianceLevel_Boundary_HighRiskExpires) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC1"))
+        .WillOnce(Return(ComplianceLevel::HIGH_RISK))
+        .WillOnce(Return(ComplianceLevel::LOW_RISK));
+
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::HIGH_RISK);
+    now += std::chrono::seconds(60) - std::chrono::nanoseconds(1);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::HIGH_RISK);
+    now += std::chrono::nanoseconds(1);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::LOW_RISK);
+
+    EXPECT_EQ(sut.getMissCount(), 2u);
+    EXPECT_EQ(sut.getHitCount(), 1u);
+}
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::checkComplianceLevel()
+/// Test goal: BLOCKED decisions are negatively cached with their own, longer TTL
+/// In case: Clock past the regular TTL but before the BLOCKED TTL, then past it
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_checkComplianceLevel_Boundary_BlockedTtl) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC9"))
+        .WillOnce(Return(ComplianceLevel::BLOCKED))
+        .WillOnce(Return(ComplianceLevel::LOW_RISK));
+
+    EXPECT_EQ(sut.checkComplianceLevel("ACC9"), ComplianceLevel::BLOCKED);
+    now += std::chrono::seconds(300);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC9"), ComplianceLevel::BLOCKED);
+    now += std::chrono::seconds(300);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC9"), ComplianceLevel::LOW_RISK);
+}
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::checkComplianceLevel()
+/// Test goal: The cache stays bounded and evicts the least recently used account
+/// In case: Four accounts in a cache of three, the first one touched again before the fourth
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_checkComplianceLevel_Boundary_EvictsLeastRecentlyUsed) {
+    sut.checkComplianceLevel("ACC1");
+    sut.checkComplianceLevel("ACC2");
+    sut.checkComplianceLevel("ACC3");
+    sut.checkComplianceLevel("ACC1");
+    sut.checkComplianceLevel("ACC4");
+    EXPECT_EQ(sut.size(), 3u);
+
+    EXPECT_CALL(backend, checkComplianceLevel("ACC1")).Times(0);
+    EXPECT_CALL(backend, checkComplianceLevel("ACC2")).Times(1);
+    sut.checkComplianceLevel("ACC1");
+    sut.checkComplianceLevel("ACC2");
+    EXPECT_EQ(sut.size(), 3u);
+}
+
+// ============================================================================
+// Method: reportSuspiciousActivity()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::reportSuspiciousActivity()
+/// Test goal: Reporting forwards to the back end and invalidates the cached decision
+/// In case: LOW_RISK cached, then reported, back end now answers BLOCKED
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_reportSuspiciousActivity_Normal_Invalidates) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC1"))
+        .WillOnce(Return(ComplianceLevel::LOW_RISK))
+        .WillOnce(Return(ComplianceLevel::BLOCKED));
+    EXPECT_CALL(backend, reportSuspiciousActivity("ACC1", "structuring")).WillOnce(Return(true));
+
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::LOW_RISK);
+    EXPECT_TRUE(sut.reportSuspiciousActivity("ACC1", "structuring"));
+    EXPECT_EQ(sut.size(), 0u);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::BLOCKED);
+}
+
+/// ===========================================================================
+/// Verifies: CachingComplianceCheckService::checkComplianceLevel()
+/// Test goal: A decision fetched before an invalidation is returned but not cached
+/// In case: The back end lookup itself triggers an invalidation of the account
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_checkComplianceLevel_Error_InvalidatedDuringLookup) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC1"))
+        .WillOnce([this](const std::string& accountNumber) {
+            sut.invalidate(accountNumber);
+            return ComplianceLevel::LOW_RISK;
+        })
+        .WillOnce(Return(ComplianceLevel::HIGH_RISK));
+
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::LOW_RISK);
+    EXPECT_EQ(sut.size(), 0u);
+    EXPECT_EQ(sut.checkComplianceLevel("ACC1"), ComplianceLevel::HIGH_RISK);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction()
+/// Test goal: The cache sits in front of the back end in the transaction path
+/// In case: 100 deposits from one account, then a cached BLOCKED account
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ComplianceCacheUnitTest, SWE4_ComplianceCache_processTransaction_Normal_OneBackendCallPerAccount) {
+    EXPECT_CALL(backend, checkComplianceLevel("ACC500001")).Times(1);
+    EXPECT_CALL(backend, checkComplianceLevel("ACC500002")).Times(1).WillOnce(Return(ComplianceLevel::BLOCKED));
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setComplianceService(&sut);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC500001", ""),
+                  TransactionStatus::COMPLETED);
+    }
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC500002", ""),
+              TransactionStatus::REJECTED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC500002", ""),
+              TransactionStatus::REJECTED);
+
+    EXPECT_EQ(sut.getHitCount(), 100u);
+    EXPECT_EQ(sut.getMissCount(), 2u);
+}
@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "../inc/ConcurrentAccountManager.hpp"
+#include "../inc/ExternalServices.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class ConcurrentAccountManagerUnitTest : public ::testing::Test {
+protected:
+    ConcurrentAccountManager sut{8};
+};
+
+// ============================================================================
+// Method: createAccount() & getAccount()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::createAccount() & getAccount()
+/// Test goal: Created accounts are reachable through a handle and balance lookup
+/// In case: Create one account, fetch it, read the balance
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_getAccount_Normal_Handle) {
+    std::string acc = sut.createAccount(AccountType::CHECKING, 100.0);
+    ASSERT_FALSE(acc.empty());
+
+    {
+        AccountHandle handle = sut.getAccount(acc);
+        ASSERT_TRUE(handle);
+        EXPECT_EQ(handle->accountNumber, acc);
+        EXPECT_EQ((*handle).status, AccountStatus::PENDING_VERIFICATION);
+    }
+    EXPECT_EQ(sut.getAccountBalance(acc), 100.0);
+    EXPECT_EQ(sut.getAccountCount(), 1);
+}
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::getAccount()
+/// Test goal: Unknown and malformed account numbers give an empty handle
+/// In case: Look up a missing ACC id and a non-ACC string
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_getAccount_Error_NotFound) {
+    EXPECT_FALSE(sut.getAccount("ACC1"));
+    EXPECT_FALSE(sut.getAccount("unknown"));
+    EXPECT_EQ(sut.getAccountBalance("unknown"), -1.0);
+}
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::createAccount()
+/// Test goal: Invalid balance does not consume a slot of the account limit
+/// In case: Create with zero balance, then fill the limit
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_createAccount_Error_Below_Min_Balance) {
+    EXPECT_TRUE(sut.createAccount(AccountType::CHECKING, 0.0).empty());
+    EXPECT_EQ(sut.getAccountCount(), 0);
+}
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::createAccount()
+/// Test goal: Concurrent creators never exceed the account limit
+/// In case: Four threads each try to create ten accounts
+/// Method for Verification: Concurrency invariant
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_createAccount_Boundary_ConcurrentLimit) {
+    std::vector<std::vector<std::string>> created(4);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < created.size(); ++t) {
+        workers.emplace_back([this, &created, t]() {
+            for (int i = 0; i < 10; ++i) {
+                std::string acc = sut.createAccount(AccountType::SAVINGS, 10.0);
+                if (!acc.empty()) {
+                    created[t].push_back(acc);
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    std::set<std::string> unique;
+    for (const std::vector<std::string>& accounts : created) {
+        unique.insert(accounts.begin(), accounts.end());
+    }
+    EXPECT_EQ(unique.size(), static_cast<std::size_t>(AccountManager::getMaxAccountsPerUser()));
+    EXPECT_EQ(sut.getAccountCount(), AccountManager::getMaxAccountsPerUser());
+    EXPECT_DOUBLE_EQ(sut.getTotalManagedBalance(), 10.0 * AccountManager::getMaxAccountsPerUser());
+}
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::createAccount()
+/// Test goal: The owner limit holds across shards for every owner, independently of the others
+/// In case: 4 threads each creating 10 accounts for each of owners 1..4
+/// Method for Verification: Concurrency invariant
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_createAccount_Boundary_LimitPerOwner) {
+    const std::uint32_t ownerCount = 4;
+    std::vector<std::vector<std::string>> created(ownerCount + 1);
+    std::vector<std::mutex> createdMutex(ownerCount + 1);
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([this, &created, &createdMutex, ownerCount]() {
+            for (int i = 0; i < 10; ++i) {
+                for (std::uint32_t owner = 1; owner <= ownerCount; ++owner) {
+                    std::string acc = sut.createAccount(AccountType::CHECKING, 10.0, owner);
+                    if (!acc.empty()) {
+                        std::lock_guard<std::mutex> lock(createdMutex[owner]);
+                        created[owner].push_back(acc);
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (std::uint32_t owner = 1; owner <= ownerCount; ++owner) {
+        ASSERT_EQ(created[owner].size(), static_cast<std::size_t>(AccountManager::getMaxAccountsPerUser()));
+        for (const std::string& acc : created[owner]) {
+            AccountHandle handle = sut.getAccount(acc);
+            ASSERT_TRUE(handle);
+            EXPECT_EQ(handle->ownerId, owner);
+        }
+    }
+    EXPECT_EQ(sut.getAccountCount(), static_cast<int>(ownerCount) * AccountManager::getMaxAccountsPerUser());
+}
+
+// ============================================================================
+// Method: getSuspendedAccountCount()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::getSuspendedAccountCount()
+/// Test goal: Per-shard counters are summed on read
+/// In case: Suspend accounts from several threads, read the aggregate
+/// Method for Verification: Concurrency invariant
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_getSuspendedAccountCount_Normal_Sum) {
+    std::vector<std::string> accounts;
+    for (int i = 0; i < 8; ++i) {
+        accounts.push_back(sut.createAccount(AccountType::BUSINESS, 50.0));
+    }
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; ++t) {
+        workers.emplace_back([this, &accounts, t]() {
+            EXPECT_TRUE(sut.suspendAccount(accounts[t * 2], "audit"));
+            EXPECT_TRUE(sut.suspendAccount(accounts[t * 2 + 1], "audit"));
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    EXPECT_EQ(sut.getSuspendedAccountCount(), 8);
+    EXPECT_EQ(sut.getAccount(accounts[3])->status, AccountStatus::SUSPENDED);
+}
+
+// ============================================================================
+// Method: getTotalManagedBalance()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::getTotalManagedBalance()
+/// Test goal: The shard totals are summed exactly, so the total is the sum of the balances in cents
+/// In case: Ten accounts of 0.10 on 256 shards; adding their shard totals as doubles gives 0.9999999999999999
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_getTotalManagedBalance_Boundary_ExactCents) {
+    ConcurrentAccountManager wide(256);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_FALSE(wide.createAccount(AccountType::CHECKING, 0.1, static_cast<std::uint32_t>(i + 1)).empty());
+    }
+    EXPECT_EQ(wide.getTotalManagedBalance(), 1.0);
+}
+
+// ============================================================================
+// Forwarded account operations
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ConcurrentAccountManager::verifyAccount(), updateAccountStatus(), deactivateAccount()
+/// Test goal: Operations are forwarded to the owning shard with AccountManager rules
+/// In case: Verify, freeze, refuse activation, evaluate risk
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ConcurrentAccountManagerUnitTest, SWE4_ConcurrentAccountManager_Forwarding_Normal_Rules) {
+    std::string acc = sut.createAccount(AccountType::INVESTMENT, 20.0);
+
+    EXPECT_TRUE(sut.verifyAccount(acc, true));
+    EXPECT_EQ(sut.getAccount(acc)->status, AccountStatus::ACTIVE);
+    EXPECT_TRUE(sut.updateAccountStatus(acc, AccountStatus::FROZEN));
+    EXPECT_FALSE(sut.activateAccount(acc));
+    EXPECT_FALSE(sut.deactivateAccount(acc));
+    EXPECT_EQ(sut.evaluateAccountRisk(acc, 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(sut.evaluateAccountRisk("ACC1", 0, 0.0), AccountStatus::CLOSED);
+}
@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "../inc/DailyUsageCounter.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class DailyUsageCounterUnitTest : public ::testing::Test {
+protected:
+    DailyUsageCounter sut;
+};
+
+// ============================================================================
+// Method: compareExchange()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: DailyUsageCounter::compareExchange() & load() & reset()
+/// Test goal: An exchange based on a stale usage fails and hands back the current one
+/// In case: Two exchanges from the same snapshot, then a reset
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(DailyUsageCounterUnitTest, SWE4_DailyUsageCounter_compareExchange_Normal_StaleSnapshot) {
+    DailyUsage first = sut.load();
+    DailyUsage stale = first;
+    EXPECT_TRUE(sut.compareExchange(first, DailyUsage{1, 12345}));
+
+    EXPECT_FALSE(sut.compareExchange(stale, DailyUsage{1, 99}));
+    EXPECT_EQ(stale.transactionCount, 1);
+    EXPECT_EQ(stale.volumeCents, 12345);
+
+    sut.reset();
+    EXPECT_EQ(sut.load().transactionCount, 0);
+    EXPECT_EQ(sut.load().volumeCents, 0);
+}
+
+// ============================================================================
+// Method: fits()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: DailyUsageCounter::fits()
+/// Test goal: The largest packable usage round-trips and anything beyond it is refused
+/// In case: Field maxima, one past each maximum, negative values
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(DailyUsageCounterUnitTest, SWE4_DailyUsageCounter_fits_Boundary_FieldWidths) {
+    const DailyUsage largest{DailyUsageCounter::MAX_TRANSACTION_COUNT, DailyUsageCounter::MAX_VOLUME_CENTS};
+    ASSERT_TRUE(DailyUsageCounter::fits(largest));
+    DailyUsage expected = sut.load();
+    ASSERT_TRUE(sut.compareExchange(expected, largest));
+    EXPECT_EQ(sut.load().transactionCount, largest.transactionCount);
+    EXPECT_EQ(sut.load().volumeCents, largest.volumeCents);
+
+    EXPECT_FALSE(DailyUsageCounter::fits(DailyUsage{DailyUsageCounter::MAX_TRANSACTION_COUNT + 1, 0}));
+    EXPECT_FALSE(DailyUsageCounter::fits(DailyUsage{0, DailyUsageCounter::MAX_VOLUME_CENTS + 1}));
+    EXPECT_FALSE(DailyUsageCounter::fits(DailyUsage{-1, 0}));
+    EXPECT_FALSE(DailyUsageCounter::fits(DailyUsage{0, -1}));
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & resetDailyLimits()
+/// Test goal: Concurrent callers never push a processor past MAX_DAILY_TRANSACTIONS
+/// In case: Eight threads each submit 250 deposits to one processor (2000 against a limit of 1000)
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(DailyUsageCounterUnitTest, SWE4_DailyUsageCounter_processTransaction_Boundary_ConcurrentDailyLimit) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    std::atomic<int> completed(0);
+
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 8; ++t) {
+        callers.emplace_back([&processor, &completed]() {
+            for (int i = 0; i < 250; ++i) {
+                if (processor.processTransaction(TransactionType::DEPOSIT, 2.5, "SRC", "") ==
+                    TransactionStatus::COMPLETED) {
+                    completed.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (std::thread& caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(completed.load(), 1000);
+    EXPECT_EQ(processor.getTransactionCount(), 1000);
+    EXPECT_EQ(processor.getDailyVolume(), 2500.0);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 1000u);
+
+    // A reset racing with traffic counts every accepted deposit exactly once
+    std::thread resetter([&processor]() {
+        for (int i = 0; i < 100; ++i) {
+            processor.resetDailyLimits();
+        }
+    });
+    int accepted = 0;
+    for (int i = 0; i < 500; ++i) {
+        if (processor.processTransaction(TransactionType::DEPOSIT, 1.0, "SRC", "") == TransactionStatus::COMPLETED) {
+            ++accepted;
+        }
+    }
+    resetter.join();
+    EXPECT_LE(processor.getTransactionCount(), accepted);
+    EXPECT_EQ(processor.getDailyVolume(), static_cast<double>(processor.getTransactionCount()));
+}
+
+// ============================================================================
+// Class: DailyUsageWindow
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: DailyUsageWindow::counterFor() & load()
+/// Test goal: A new day starts from zero by itself, a straggler still counts against its own day, and
+///            a day no longer kept has no counter
+/// In case: Usage on day 20000, first transaction of day 20001, late one stamped on day 20000, day 20002,
+///          then one stamped on day 20000 again
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(DailyUsageCounterUnitTest, SWE4_DailyUsageCounter_counterFor_Normal_DayRollover) {
+    DailyUsageWindow window;
+    const std::time_t day = static_cast<std::time_t>(20000) * DailyUsageWindow::SECONDS_PER_DAY;
+    EXPECT_EQ(window.load(day).transactionCount, 0);
+
+    DailyUsage usage = window.counterFor(day + 10)->load();
+    ASSERT_TRUE(window.counterFor(day + 10)->compareExchange(usage, DailyUsage{7, 700}));
+
+    const std::time_t nextDay = day + DailyUsageWindow::SECONDS_PER_DAY;
+    EXPECT_EQ(window.counterFor(nextDay)->load().transactionCount, 0);
+    DailyUsage straggler = window.counterFor(nextDay - 1)->load();
+    EXPECT_EQ(straggler.transactionCount, 7);
+    ASSERT_TRUE(window.counterFor(nextDay - 1)->compareExchange(straggler, DailyUsage{8, 800}));
+    EXPECT_EQ(window.load(day).transactionCount, 8);
+    EXPECT_EQ(window.load(nextDay).transactionCount, 0);
+
+    // Day 20002 reuses the slot of day 20000
+    const std::time_t dayAfter = nextDay + DailyUsageWindow::SECONDS_PER_DAY;
+    EXPECT_EQ(window.counterFor(dayAfter)->load().transactionCount, 0);
+    EXPECT_EQ(window.load(day).transactionCount, 0);
+    EXPECT_EQ(window.counterFor(day + 10), nullptr);
+    EXPECT_EQ(window.load(dayAfter).transactionCount, 0);
+    EXPECT_EQ(DailyUsageWindow::dayOf(-5), 0);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & DailyUsageWindow::counterFor()
+/// Test goal: A transaction stamped on a day no longer kept is rejected and counts against no day
+/// In case: A deposit on day 20002, then one stamped on day 20000, then one stamped on day 20001
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(DailyUsageCounterUnitTest, SWE4_DailyUsageCounter_counterFor_Error_StaleDayRejected) {
+    const std::time_t day = static_cast<std::time_t>(20000) * DailyUsageWindow::SECONDS_PER_DAY;
+    ProcessingContext context;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setProcessingContext(&context);
+    std::time_t now = day + 2 * DailyUsageWindow::SECONDS_PER_DAY;
+    processor.setClock([&now]() { return now; });
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC", ""), TransactionStatus::COMPLETED);
+    now = day;
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC", ""), TransactionStatus::REJECTED);
+    now = day + DailyUsageWindow::SECONDS_PER_DAY;
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC", ""), TransactionStatus::COMPLETED);
+
+    now = day + 2 * DailyUsageWindow::SECONDS_PER_DAY;
+    EXPECT_EQ(processor.getTransactionCount(), 1);
+    EXPECT_EQ(processor.getDailyVolume(), 10.0);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 2u);
+}
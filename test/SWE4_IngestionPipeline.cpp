@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountSymbolTable.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/IngestionPipeline.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionHistory.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockComplianceCheckService : public ComplianceCheckService {
+public:
+    MOCK_METHOD(ComplianceLevel, checkComplianceLevel, (const std::string& accountNumber), (override));
+    MOCK_METHOD(bool, reportSuspiciousActivity, (const std::string& accountNumber, const std::string& description), (override));
+    MOCK_METHOD(std::vector<std::string>, getBlacklist, (), (override));
+    MOCK_METHOD(bool, isAccountBlacklisted, (const std::string& accountNumber), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class IngestionPipelineUnitTest : public ::testing::Test {
+protected:
+    ProcessingContext context;
+    TransactionProcessor processor;
+    std::string filePath;
+
+    void SetUp() override {
+        processor.setTransactionLogSink(nullptr);
+        processor.setProcessingContext(&context);
+        processor.setClock([]() { return static_cast<std::time_t>(1700000000); });
+        filePath = ::testing::TempDir() + "SWE4_IngestionPipeline_" +
+                   ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".dat";
+        std::remove(filePath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(filePath.c_str());
+    }
+};
+
+// ============================================================================
+// Method: parseCsvRow()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: IngestionPipeline::parseCsvRow()
+/// Test goal: Well-formed rows fill every field and anything else is refused
+/// In case: Rows with and without destination and account type, and malformed rows of every field
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(IngestionPipelineUnitTest, SWE4_IngestionPipeline_parseCsvRow_Boundary_Fields) {
+    TransactionRequest request{};
+    ASSERT_TRUE(IngestionPipeline::parseCsvRow("TRANSFER,1250.75,ACC1,ACC2,SAVINGS", request));
+    EXPECT_EQ(request.type, TransactionType::TRANSFER);
+    EXPECT_DOUBLE_EQ(request.amount, 1250.75);
+    EXPECT_EQ(request.sourceAccount, "ACC1");
+    EXPECT_EQ(request.destAccount, "ACC2");
+    EXPECT_EQ(request.sourceAccountType, AccountType::SAVINGS);
+
+    ASSERT_TRUE(IngestionPipeline::parseCsvRow("DEPOSIT,5,ACC3,", request));
+    EXPECT_EQ(request.type, TransactionType::DEPOSIT);
+    EXPECT_EQ(request.sourceAccount, "ACC3");
+    EXPECT_EQ(request.destAccount, "");
+    EXPECT_EQ(request.sourceAccountType, DEFAULT_TRANSACTION_PRODUCT);
+    EXPECT_TRUE(IngestionPipeline::parseCsvRow("REFUND,0.01,ACC3,,", request));
+
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("deposit,5,ACC3,", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,,ACC3,", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,5x,ACC3,", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,5,,ACC2", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,5,ACC3", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,5,ACC3,ACC2,PREMIUM", request));
+    EXPECT_FALSE(IngestionPipeline::parseCsvRow("DEPOSIT,5,ACC3,ACC2,CHECKING,extra", request));
+}
+
+// ============================================================================
+// Method: ingest()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: IngestionPipeline::ingest() & TransactionProcessor::validateBatch() & screenBatch() & executeBatch()
+/// Test goal: Streaming a CSV gives the same statuses and daily totals as processBatch over the same rows
+/// In case: 3000 rows with a header, CRLF endings, blank and malformed lines, invalid amounts and the daily count limit
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(IngestionPipelineUnitTest, SWE4_IngestionPipeline_ingest_Normal_MatchesProcessBatch) {
+    static const char* const TYPES[] = {"DEPOSIT", "WITHDRAWAL", "TRANSFER", "REFUND"};
+    std::string csv = "type,amount,source,destination,accountType\r\n";
+    std::vector<TransactionRequest> requests;
+    std::size_t malformed = 0;
+    for (int i = 0; i < 3000; ++i) {
+        if (i % 101 == 0) {
+            csv += "\r\n";
+            continue;
+        }
+        if (i % 89 == 0) {
+            csv += "WIRE,10,SRC,DST\r\n";
+            malformed++;
+            continue;
+        }
+        const double amount = (i % 53 == 0) ? 0.005 : 5.0 + (i % 700) * 1.25;
+        const std::string source = "SRC" + std::to_string(i % 30);
+        const std::string dest = (i % 3 == 0) ? "" : "DST" + std::to_string(i % 5);
+        const AccountType product = (i % 7 == 0) ? AccountType::SAVINGS : AccountType::CHECKING;
+        const std::string row = std::string(TYPES[i % 4]) + "," + std::to_string(amount) + "," + source + "," +
+                                dest + (product == AccountType::SAVINGS ? ",SAVINGS" : "");
+        csv += row + "\r\n";
+        TransactionRequest request{};
+        ASSERT_TRUE(IngestionPipeline::parseCsvRow(row, request));
+        requests.push_back(request);
+    }
+    csv += "DEPOSIT,10,SRC0";   // last line without terminator and without destination
+
+    IngestionPipeline sut(processor, 64, 2);
+    const IngestionReport report = sut.ingest(csv.data(), csv.size(), IngestionFormat::CSV);
+    EXPECT_EQ(report.rowCount, requests.size());
+    EXPECT_EQ(report.malformedCount, malformed + 1);
+    EXPECT_EQ(report.batchCount, (requests.size() + 63) / 64);
+    for (std::size_t depth : report.peakQueueDepths) {
+        EXPECT_LE(depth, 2u);
+    }
+
+    ProcessingContext referenceContext;
+    TransactionProcessor reference;
+    reference.setTransactionLogSink(nullptr);
+    reference.setProcessingContext(&referenceContext);
+    reference.setClock([]() { return static_cast<std::time_t>(1700000000); });
+    std::array<std::size_t, 5> expectedCounts{};
+    for (std::size_t first = 0; first < requests.size(); first += 64) {
+        const std::size_t count = std::min<std::size_t>(64, requests.size() - first);
+        for (TransactionStatus status : reference.processBatch(requests.data() + first, count)) {
+            expectedCounts[static_cast<std::size_t>(status)]++;
+        }
+    }
+    EXPECT_EQ(report.statusCounts, expectedCounts);
+    EXPECT_GT(expectedCounts[static_cast<std::size_t>(TransactionStatus::REJECTED)], 0u);
+    EXPECT_GT(expectedCounts[static_cast<std::size_t>(TransactionStatus::COMPLETED)], 0u);
+    EXPECT_EQ(processor.getTransactionCount(), reference.getTransactionCount());
+    EXPECT_DOUBLE_EQ(processor.getDailyVolume(), reference.getDailyVolume());
+    EXPECT_EQ(context.totalTransactionsProcessed.load(), referenceContext.totalTransactionsProcessed.load());
+
+    // The batches are recycled: a second run over the same pipeline sees the same rows
+    const IngestionReport again = sut.ingest(csv.data(), csv.size(), IngestionFormat::CSV);
+    EXPECT_EQ(again.rowCount, report.rowCount);
+    EXPECT_EQ(sut.getQueueDepths(), (std::array<std::size_t, INGESTION_QUEUE_COUNT>{}));
+}
+
+/// ===========================================================================
+/// Verifies: IngestionPipeline::ingest() & getQueueDepths()
+/// Test goal: A slow stage holds back the stages before it within the queue capacity
+/// In case: A compliance service taking 1 ms per source, batches of 4 rows and queues of one slot
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(IngestionPipelineUnitTest, SWE4_IngestionPipeline_ingest_Boundary_Backpressure) {
+    NiceMock<MockComplianceCheckService> compliance;
+    EXPECT_CALL(compliance, checkComplianceLevel(_)).Times(80).WillRepeatedly(Invoke([](const std::string&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return ComplianceLevel::LOW_RISK;
+    }));
+    processor.setComplianceService(&compliance);
+
+    std::string csv;
+    for (int i = 0; i < 80; ++i) {
+        csv += "DEPOSIT,100,SRC" + std::to_string(i) + ",\n";
+    }
+
+    IngestionPipeline sut(processor, 4, 1);
+    EXPECT_EQ(sut.getBatchSize(), 4u);
+    const IngestionReport report = sut.ingest(csv.data(), csv.size(), IngestionFormat::CSV);
+    EXPECT_EQ(report.rowCount, 80u);
+    EXPECT_EQ(report.batchCount, 20u);
+    EXPECT_EQ(report.statusCounts[static_cast<std::size_t>(TransactionStatus::COMPLETED)], 80u);
+    EXPECT_EQ(report.peakQueueDepths[static_cast<std::size_t>(IngestionStage::VALIDATE)], 1u);
+    EXPECT_EQ(report.peakQueueDepths[static_cast<std::size_t>(IngestionStage::SCREEN)], 1u);
+    EXPECT_LE(report.peakQueueDepths[static_cast<std::size_t>(IngestionStage::EXECUTE)], 1u);
+}
+
+// ============================================================================
+// Method: ingestFile()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: IngestionPipeline::ingestFile()
+/// Test goal: Binary records are read from the mapping, bad records are counted and missing files fail
+/// In case: 100 records with one unknown type and a truncated tail, a missing file
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(IngestionPipelineUnitTest, SWE4_IngestionPipeline_ingestFile_Error_BinaryRecords) {
+    IngestionPipeline sut(processor);
+    IngestionReport report{};
+    EXPECT_FALSE(sut.ingestFile(filePath, IngestionFormat::BINARY, report));
+
+    AccountSymbolTable symbols;
+    std::vector<TransactionHistoryRecord> records(100);
+    for (int i = 0; i < 100; ++i) {
+        const Transaction transaction{i, TransactionType::REFUND, Money::fromCents(100 + i), symbols.intern("SRC1"),
+                                      symbols.intern("DST1"), 1700000000, TransactionStatus::COMPLETED};
+        TransactionHistory::toRecord(transaction, symbols, records[i]);
+    }
+    records[42].type = 9;
+    {
+        std::ofstream file(filePath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() * sizeof(TransactionHistoryRecord)));
+        file.write("tail", 4);
+    }
+
+    ASSERT_TRUE(sut.ingestFile(filePath, IngestionFormat::BINARY, report));
+    EXPECT_EQ(report.rowCount, 99u);
+    EXPECT_EQ(report.malformedCount, 2u);
+    EXPECT_EQ(report.batchCount, 1u);
+    EXPECT_EQ(report.statusCounts[static_cast<std::size_t>(TransactionStatus::COMPLETED)], 99u);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 99u);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/Instrumentation.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+using ::testing::_;
+using ::testing::Invoke;
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockSlowComplianceService : public ComplianceCheckService {
+public:
+    MOCK_METHOD(ComplianceLevel, checkComplianceLevel, (const std::string& accountNumber), (override));
+    MOCK_METHOD(bool, reportSuspiciousActivity, (const std::string& accountNumber, const std::string& description), (override));
+    MOCK_METHOD(std::vector<std::string>, getBlacklist, (), (override));
+    MOCK_METHOD(bool, isAccountBlacklisted, (const std::string& accountNumber), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class InstrumentationUnitTest : public ::testing::Test {
+protected:
+    LatencyHistogramSnapshot sut{};
+
+    void SetUp() override {
+        Instrumentation::reset();
+    }
+};
+
+// ============================================================================
+// Method: latencyBucketIndex()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: latencyBucketIndex() & latencyBucketLowerBound() & LatencyHistogramSnapshot::valueAtPercentile()
+/// Test goal: Small latencies are exact, larger ones keep 1/16 precision, and percentiles read the buckets
+/// In case: Every value up to 2^16 ns, the maximum, and a histogram of 1..100 us
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(InstrumentationUnitTest, SWE4_Instrumentation_latencyBucketIndex_Boundary_RelativePrecision) {
+    EXPECT_EQ(latencyBucketIndex(0), 0u);
+    EXPECT_EQ(latencyBucketIndex(31), 31u);
+    EXPECT_EQ(latencyBucketIndex(LATENCY_MAX_NANOSECONDS), LATENCY_BUCKET_COUNT - 1);
+    EXPECT_EQ(latencyBucketIndex(~0ULL), LATENCY_BUCKET_COUNT - 1);
+
+    std::size_t previous = 0;
+    for (std::uint64_t value = 1; value < (1ULL << 16); ++value) {
+        const std::size_t bucket = latencyBucketIndex(value);
+        ASSERT_GE(bucket, previous);
+        ASSERT_LE(bucket, previous + 1);
+        ASSERT_LE(latencyBucketLowerBound(bucket), value);
+        ASSERT_LE(value - latencyBucketLowerBound(bucket), latencyBucketLowerBound(bucket) / LATENCY_SUB_BUCKET_COUNT);
+        previous = bucket;
+    }
+
+    EXPECT_EQ(sut.valueAtPercentile(50.0), 0u);
+    for (std::uint64_t micros = 1; micros <= 100; ++micros) {
+        ++sut.buckets[latencyBucketIndex(micros * 1000)];
+        sut.totalNanoseconds += micros * 1000;
+    }
+    sut.count = 100;
+    sut.maxNanoseconds = 100000;
+    EXPECT_NEAR(static_cast<double>(sut.valueAtPercentile(50.0)), 50000.0, 50000.0 / 16);
+    EXPECT_NEAR(static_cast<double>(sut.valueAtPercentile(99.0)), 99000.0, 99000.0 / 16);
+    EXPECT_EQ(sut.valueAtPercentile(100.0), latencyBucketLowerBound(latencyBucketIndex(100000)));
+    EXPECT_DOUBLE_EQ(sut.meanNanoseconds(), 50500.0);
+}
+
+// ============================================================================
+// Method: Instrumentation::snapshot()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: Instrumentation::recordLatency() & snapshot() & reset()
+/// Test goal: Samples of live and exited threads are merged; nothing is collected when compiled out
+/// In case: Samples on the test thread and on a joined worker thread, then a reset
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(InstrumentationUnitTest, SWE4_Instrumentation_snapshot_Normal_MergesThreads) {
+    Instrumentation::recordLatency(LatencyMetric::AUDIT_LOG, 1000);
+    std::thread worker([]() {
+        Instrumentation::recordLatency(LatencyMetric::AUDIT_LOG, 3000);
+        Instrumentation::countTransactionOutcome(TransactionStatus::APPROVED);
+    });
+    worker.join();
+
+    InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+    if (!Instrumentation::ENABLED) {
+        EXPECT_EQ(snapshot.latency(LatencyMetric::AUDIT_LOG).count, 0u);
+        EXPECT_EQ(snapshot.transactionOutcome(TransactionStatus::APPROVED), 0u);
+        return;
+    }
+
+    const LatencyHistogramSnapshot& audit = snapshot.latency(LatencyMetric::AUDIT_LOG);
+    EXPECT_EQ(audit.count, 2u);
+    EXPECT_EQ(audit.totalNanoseconds, 4000u);
+    EXPECT_EQ(audit.maxNanoseconds, 3000u);
+    EXPECT_EQ(snapshot.transactionOutcome(TransactionStatus::APPROVED), 1u);
+    EXPECT_EQ(snapshot.latency(LatencyMetric::CREDIT_SCORE).count, 0u);
+
+    Instrumentation::reset();
+    snapshot = Instrumentation::snapshot();
+    EXPECT_EQ(snapshot.latency(LatencyMetric::AUDIT_LOG).count, 0u);
+    EXPECT_EQ(snapshot.transactionOutcome(TransactionStatus::APPROVED), 0u);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & processBatch() & executeTransfer()
+/// Test goal: Every returned status is counted, and a slow dependency shows up in its own histogram
+/// In case: A compliance service taking 2 ms per call, single, batched and transfer calls
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(InstrumentationUnitTest, SWE4_Instrumentation_processTransaction_Normal_OutcomesAndServiceTime) {
+    if (!Instrumentation::ENABLED) {
+        GTEST_SKIP() << "built with ENABLE_INSTRUMENTATION=OFF";
+    }
+
+    MockSlowComplianceService compliance;
+    EXPECT_CALL(compliance, checkComplianceLevel(_)).Times(2).WillRepeatedly(Invoke([](const std::string&) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        return ComplianceLevel::LOW_RISK;
+    }));
+
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setComplianceService(&compliance);
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 100.0, "SRC", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, -1.0, "SRC", ""), TransactionStatus::REJECTED);
+    std::vector<TransactionRequest> batch = {
+        {TransactionType::REFUND, 10.0, "OTHER", ""},
+        {TransactionType::REFUND, 0.0, "OTHER", ""}
+    };
+    processor.processBatch(batch);
+    EXPECT_EQ(processor.executeTransfer(10.0, "A", "A", false), TransactionStatus::REJECTED);
+
+    const InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+    EXPECT_EQ(snapshot.transactionOutcome(TransactionStatus::COMPLETED), 2u);
+    EXPECT_EQ(snapshot.transactionOutcome(TransactionStatus::REJECTED), 3u);
+    EXPECT_EQ(snapshot.latency(LatencyMetric::PROCESS_TRANSACTION).count, 2u);
+    EXPECT_EQ(snapshot.latency(LatencyMetric::EXECUTE_TRANSFER).count, 1u);
+
+    const LatencyHistogramSnapshot& dependency = snapshot.latency(LatencyMetric::COMPLIANCE_CHECK);
+    EXPECT_EQ(dependency.count, 2u);
+    EXPECT_GE(dependency.valueAtPercentile(50.0), 1800000u);
+    EXPECT_GE(snapshot.latency(LatencyMetric::PROCESS_TRANSACTION).maxNanoseconds, dependency.valueAtPercentile(0.0));
+}
+
+// ============================================================================
+// Method: AccountManager::evaluateAccountRisk()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::evaluateAccountRisk() & verifyAccount()
+/// Test goal: Risk results are counted per AccountStatus and both calls are timed
+/// In case: A low-risk, a high-risk and an unknown account, one verification
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(InstrumentationUnitTest, SWE4_Instrumentation_evaluateAccountRisk_Normal_AccountOutcomes) {
+    if (!Instrumentation::ENABLED) {
+        GTEST_SKIP() << "built with ENABLE_INSTRUMENTATION=OFF";
+    }
+
+    AccountManager manager;
+    const std::string account = manager.createAccount(AccountType::CHECKING, 100.0);
+    ASSERT_TRUE(manager.verifyAccount(account, true));
+
+    EXPECT_EQ(manager.evaluateAccountRisk(account, 0, 0.0), AccountStatus::ACTIVE);
+    EXPECT_EQ(manager.evaluateAccountRisk("ACC0", 0, 0.0), AccountStatus::CLOSED);
+    manager.evaluateAccountRisk(account, 500, 5000000.0);
+
+    const InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+    EXPECT_EQ(snapshot.accountOutcome(AccountStatus::ACTIVE), 1u);
+    EXPECT_EQ(snapshot.accountOutcome(AccountStatus::CLOSED), 1u);
+    std::uint64_t evaluations = 0;
+    for (std::uint64_t outcome : snapshot.accountOutcomes) {
+        evaluations += outcome;
+    }
+    EXPECT_EQ(evaluations, 3u);
+    EXPECT_EQ(snapshot.latency(LatencyMetric::EVALUATE_ACCOUNT_RISK).count, 3u);
+    EXPECT_EQ(snapshot.latency(LatencyMetric::VERIFY_ACCOUNT).count, 1u);
+}
@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/MappedAccountBook.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class MappedAccountBookUnitTest : public ::testing::Test {
+protected:
+    std::string snapshotPath;
+    std::string walPath;
+
+    void SetUp() override {
+        const std::string name = ::testing::UnitTest::GetInstance()->current_test_info()->name();
+        snapshotPath = ::testing::TempDir() + "SWE4_MappedAccountBook_" + name + ".snap";
+        walPath = ::testing::TempDir() + "SWE4_MappedAccountBook_" + name + ".wal";
+        std::remove(snapshotPath.c_str());
+        std::remove(walPath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(snapshotPath.c_str());
+        std::remove(walPath.c_str());
+    }
+
+    // Writes a snapshot of every id in [firstId, firstId + count) whose offset is not a multiple of gapEvery
+    void writeBook(int firstId, int count, int gapEvery, std::vector<int>& ids) {
+        std::vector<AccountLogRecord> records;
+        Money balance;
+        for (int i = 0; i < count; ++i) {
+            if (gapEvery != 0 && i % gapEvery == 0) {
+                continue;
+            }
+            const int accountId = firstId + i;
+            Account account{"ACC" + std::to_string(accountId), AccountType::CHECKING, AccountStatus::ACTIVE,
+                            accountId * 0.5, 0.0, 0, true, false};
+            records.push_back(AccountLogRecord::fromAccount(AccountLogOperation::CREATE, accountId, account, 0));
+            ids.push_back(accountId);
+            balance += account.balance;
+        }
+        AccountSnapshotHeader header{};
+        header.accountCounter = firstId + count;
+        header.totalManagedBalance = balance;
+        // Written in reverse to show the writer sorts by id
+        std::vector<AccountLogRecord> reversed(records.rbegin(), records.rend());
+        ASSERT_TRUE(AccountSnapshot::write(snapshotPath, header, reversed));
+    }
+};
+
+// ============================================================================
+// Method: find()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: MappedAccountBook::open() & find()
+/// Test goal: Every stored id is found in place and ids in gaps or outside the range are not
+/// In case: 20000 ids with every seventh one missing, written out of order
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(MappedAccountBookUnitTest, SWE4_MappedAccountBook_find_Normal_SparseIds) {
+    std::vector<int> ids;
+    writeBook(700000, 20000, 7, ids);
+
+    MappedAccountBook sut;
+    ASSERT_TRUE(sut.open(snapshotPath));
+    ASSERT_EQ(sut.size(), ids.size());
+    EXPECT_TRUE(sut.verify());
+
+    for (int accountId : ids) {
+        const AccountLogRecord* record = sut.find(accountId);
+        ASSERT_NE(record, nullptr);
+        EXPECT_EQ(record->accountId, accountId);
+        EXPECT_EQ(record->balance, accountId * 0.5);
+    }
+    EXPECT_EQ(sut.find(700000), nullptr);
+    EXPECT_EQ(sut.find(700007), nullptr);
+    EXPECT_EQ(sut.find(699999), nullptr);
+    EXPECT_EQ(sut.find(720000), nullptr);
+    EXPECT_EQ(sut.find("ACC700001")->accountId, 700001);
+    EXPECT_EQ(sut.find("ACCX"), nullptr);
+}
+
+// ============================================================================
+// Method: open()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: MappedAccountBook::open()
+/// Test goal: Truncated snapshots and snapshots not sorted by id are refused
+/// In case: One byte cut off; sorted flag cleared; missing file
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(MappedAccountBookUnitTest, SWE4_MappedAccountBook_open_Error_InvalidFiles) {
+    std::vector<int> ids;
+    writeBook(1, 10, 0, ids);
+    MappedAccountBook sut;
+    EXPECT_FALSE(sut.open(snapshotPath + ".missing"));
+
+    std::FILE* file = std::fopen(snapshotPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, 12, SEEK_SET);
+    std::fputc(0, file);
+    std::fclose(file);
+    EXPECT_FALSE(sut.open(snapshotPath));
+
+    ids.clear();
+    writeBook(1, 10, 0, ids);
+    std::FILE* source = std::fopen(snapshotPath.c_str(), "rb");
+    ASSERT_NE(source, nullptr);
+    std::vector<char> bytes(sizeof(AccountSnapshotHeader) + 10 * sizeof(AccountLogRecord));
+    ASSERT_EQ(std::fread(bytes.data(), 1, bytes.size(), source), bytes.size());
+    std::fclose(source);
+    std::FILE* truncated = std::fopen(snapshotPath.c_str(), "wb");
+    std::fwrite(bytes.data(), 1, bytes.size() - 1, truncated);
+    std::fclose(truncated);
+    EXPECT_FALSE(sut.open(snapshotPath));
+    EXPECT_FALSE(sut.isOpen());
+    EXPECT_EQ(sut.find(1), nullptr);
+}
+
+// ============================================================================
+// Method: AccountManager::openSnapshot()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::openSnapshot() & getAccountBalance() & getAccount()
+/// Test goal: A mapped book serves reads at once and mutations go to the overlay, not the file
+/// In case: 100000-account snapshot, one account suspended after opening
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(MappedAccountBookUnitTest, SWE4_MappedAccountBook_openSnapshot_Normal_CopyOnWrite) {
+    std::vector<int> ids;
+    writeBook(800000, 100000, 0, ids);
+
+    AccountManager sut;
+    ASSERT_TRUE(sut.openSnapshot(snapshotPath, walPath));
+    EXPECT_EQ(sut.getAccountCount(), 100000);
+    EXPECT_EQ(sut.getAccountBalance("ACC850000"), 425000.0);
+    EXPECT_EQ(sut.getAccountBalance("ACC1"), -1.0);
+
+    ASSERT_TRUE(sut.suspendAccount("ACC850000", "review"));
+    EXPECT_EQ(sut.getAccount("ACC850000")->status, AccountStatus::SUSPENDED);
+    EXPECT_EQ(sut.getSuspendedAccountCount(), 1);
+    EXPECT_EQ(sut.getAccountCount(), 100000);
+    EXPECT_FALSE(sut.openSnapshot(snapshotPath, walPath));
+
+    // The file still holds the original image
+    MappedAccountBook book;
+    ASSERT_TRUE(book.open(snapshotPath));
+    EXPECT_TRUE(book.verify());
+    EXPECT_EQ(static_cast<AccountStatus>(book.find(850000)->status), AccountStatus::ACTIVE);
+
+    // Ids inside the book are not handed out again; the mapped images all belong to the default owner
+    int nextId = 0;
+    AccountIndex::parseAccountId(sut.createAccount(AccountType::SAVINGS, 5.0, 1), nextId);
+    EXPECT_GT(nextId, 899999);
+    EXPECT_EQ(sut.getAccountCount(), 100001);
+}
+
+/// ===========================================================================
+/// Verifies: AccountManager::openSnapshot() & writeSnapshot()
+/// Test goal: The WAL tail is applied on top of the mapped book and a new snapshot merges both
+/// In case: Mutations logged after the snapshot, replayed into a second manager, then re-snapshotted
+/// Method for Verification: Comparison against the original state
+/// ===========================================================================
+TEST_F(MappedAccountBookUnitTest, SWE4_MappedAccountBook_openSnapshot_Normal_WalTailAndResnapshot) {
+    std::vector<int> ids;
+    writeBook(900000, 50, 0, ids);
+    {
+        AccountWriteAheadLog wal;
+        ASSERT_TRUE(wal.open(walPath));
+        AccountManager writer;
+        ASSERT_TRUE(writer.openSnapshot(snapshotPath, walPath));
+        writer.setWriteAheadLog(&wal);
+        writer.updateAccountStatus("ACC900010", AccountStatus::FROZEN);
+        writer.createAccount(AccountType::BUSINESS, 12.0, 1);
+        ASSERT_TRUE(wal.sync());
+    }
+
+    AccountManager sut;
+    ASSERT_TRUE(sut.openSnapshot(snapshotPath, walPath));
+    EXPECT_EQ(sut.getAccountCount(), 51);
+    EXPECT_EQ(sut.getAccount("ACC900010")->status, AccountStatus::FROZEN);
+
+    const std::string merged = snapshotPath + ".merged";
+    ASSERT_TRUE(sut.writeSnapshot(merged));
+    AccountManager reloaded;
+    ASSERT_TRUE(reloaded.recover(merged, walPath + ".none"));
+    EXPECT_EQ(reloaded.getAccountCount(), 51);
+    EXPECT_EQ(reloaded.getAccount("ACC900010")->status, AccountStatus::FROZEN);
+    EXPECT_EQ(reloaded.getAccountBalance("ACC900020"), 450010.0);
+    EXPECT_DOUBLE_EQ(reloaded.getTotalManagedBalance(), sut.getTotalManagedBalance());
+    std::remove(merged.c_str());
+}
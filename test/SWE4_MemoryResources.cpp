@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/MemoryResources.hpp"
+#include "../inc/TransactionHistory.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class MemoryResourcesUnitTest : public ::testing::Test {
+protected:
+    CountingMemoryResource sut;
+};
+
+// ============================================================================
+// Method: CountingMemoryResource::getStats()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: CountingMemoryResource::allocate() & deallocate() & getStats() & getUpstream()
+/// Test goal: Every request is forwarded and counted, the peak survives releases
+/// In case: Two allocations released in turn, default and explicit upstream
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(MemoryResourcesUnitTest, SWE4_MemoryResources_getStats_Normal_CountsRequests) {
+    EXPECT_EQ(sut.getUpstream(), std::pmr::get_default_resource());
+
+    void* first = sut.allocate(64, 8);
+    void* second = sut.allocate(192, 16);
+    AllocationStats stats = sut.getStats();
+    EXPECT_EQ(stats.allocationCount, 2u);
+    EXPECT_EQ(stats.bytesAllocated, 256u);
+    EXPECT_EQ(stats.bytesInUse, 256u);
+
+    sut.deallocate(first, 64, 8);
+    sut.deallocate(second, 192, 16);
+    stats = sut.getStats();
+    EXPECT_EQ(stats.deallocationCount, 2u);
+    EXPECT_EQ(stats.bytesInUse, 0u);
+    EXPECT_EQ(stats.peakBytesInUse, 256u);
+
+    CountingMemoryResource layered(&sut);
+    EXPECT_EQ(layered.getUpstream(), &sut);
+    EXPECT_TRUE(layered.is_equal(layered));
+    EXPECT_FALSE(layered.is_equal(sut));
+}
+
+// ============================================================================
+// Method: ThreadScratchPool::local()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ThreadScratchPool::local() & TransactionProcessor::processBatch()
+/// Test goal: Each thread has its own pool, and repeated batches reuse its blocks
+/// In case: Twenty batches of the same size after one warm-up batch, a second thread
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(MemoryResourcesUnitTest, SWE4_MemoryResources_local_Normal_ReusesScratchPerThread) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    std::vector<TransactionRequest> batch(256, TransactionRequest{TransactionType::REFUND, 10.0, "SRC", ""});
+
+    processor.processBatch(batch);
+    const AllocationStats warm = ThreadScratchPool::getStats();
+    for (int i = 0; i < 20; ++i) {
+        processor.processBatch(batch);
+    }
+    EXPECT_EQ(ThreadScratchPool::getStats().allocationCount, warm.allocationCount);
+
+    std::pmr::memory_resource* mainPool = ThreadScratchPool::local();
+    std::pmr::memory_resource* otherPool = nullptr;
+    std::thread worker([&otherPool]() { otherPool = ThreadScratchPool::local(); });
+    worker.join();
+    EXPECT_EQ(ThreadScratchPool::local(), mainPool);
+    EXPECT_NE(otherPool, mainPool);
+}
+
+// ============================================================================
+// Method: AccountManager::getAllocationStats()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::AccountManager(std::pmr::memory_resource*) & getAllocationStats()
+/// Test goal: The account storage is counted and comes from the given resource
+/// In case: 10 accounts on a monotonic arena over a counted heap, released with the arena
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(MemoryResourcesUnitTest, SWE4_MemoryResources_getAllocationStats_Normal_AccountStorage) {
+    std::pmr::monotonic_buffer_resource arena(&sut);
+    {
+        AccountManager manager(&arena);
+        const AllocationStats empty = manager.getAllocationStats();
+        EXPECT_GT(empty.allocationCount, 0u);
+
+        // Up to the per-manager account limit
+        for (int i = 0; i < 10; ++i) {
+            ASSERT_FALSE(manager.createAccount(AccountType::SAVINGS, 10.0).empty());
+        }
+        const AllocationStats filled = manager.getAllocationStats();
+        EXPECT_GT(filled.allocationCount, empty.allocationCount);
+        EXPECT_GT(filled.bytesInUse, empty.bytesInUse);
+        EXPECT_GE(filled.peakBytesInUse, filled.bytesInUse);
+        EXPECT_GT(sut.getStats().bytesInUse, 0u);
+    }
+
+    // The arena keeps its blocks until it is released, then returns them all at once
+    EXPECT_GT(sut.getStats().bytesInUse, 0u);
+    arena.release();
+    EXPECT_EQ(sut.getStats().bytesInUse, 0u);
+
+    AccountManager heapManager;
+    EXPECT_EQ(heapManager.getAllocationStats().bytesInUse, heapManager.getAllocationStats().bytesAllocated);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::getAllocationStats()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::TransactionProcessor(std::pmr::memory_resource*) & getAllocationStats()
+/// Test goal: The history ring is allocated once up front and steady-state processing adds nothing
+/// In case: One processor on a monotonic arena processing 1000 transactions
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(MemoryResourcesUnitTest, SWE4_MemoryResources_getAllocationStats_Boundary_ProcessorSteadyState) {
+    std::pmr::monotonic_buffer_resource arena(&sut);
+    TransactionProcessor processor(&arena);
+    processor.setTransactionLogSink(nullptr);
+
+    const AllocationStats initial = processor.getAllocationStats();
+    EXPECT_GE(initial.bytesInUse, TransactionHistory::DEFAULT_RING_CAPACITY * sizeof(TransactionHistoryRecord));
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(processor.processTransaction(TransactionType::REFUND, 10.0, "SRC", ""),
+                  TransactionStatus::COMPLETED);
+    }
+    const AllocationStats steady = processor.getAllocationStats();
+    EXPECT_EQ(steady.allocationCount, initial.allocationCount);
+    EXPECT_EQ(steady.bytesInUse, initial.bytesInUse);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 1000u);
+}
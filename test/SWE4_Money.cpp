@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+#include "../inc/Money.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class MoneyUnitTest : public ::testing::Test {
+protected:
+    Money sut;
+};
+
+// ============================================================================
+// Method: Money(double)
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: Money::Money(double) & toCents() & toDouble() & operator<<
+/// Test goal: Conversion rounds to the nearest cent, halves away from zero, and saturates
+/// In case: Inexact sums, half cents of both signs, NaN, infinities, printing
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(MoneyUnitTest, SWE4_Money_Money_Normal_RoundsToNearestCent) {
+    EXPECT_EQ(sut.toCents(), 0);
+    EXPECT_EQ(Money(0.1 + 0.2).toCents(), 30);
+    EXPECT_EQ(Money(4999950.0).toCents(), 499995000);
+    EXPECT_EQ(Money(0.125).toCents(), 13);
+    EXPECT_EQ(Money(-0.125).toCents(), -13);
+    EXPECT_EQ(Money(0.004).toCents(), 0);
+    EXPECT_EQ(Money(std::numeric_limits<double>::quiet_NaN()).toCents(), 0);
+    EXPECT_EQ(Money(std::numeric_limits<double>::infinity()), Money::max());
+    EXPECT_EQ(Money(-std::numeric_limits<double>::infinity()), Money::min());
+    EXPECT_EQ(Money(12.5).toDouble(), 12.5);
+
+    static_assert(Money(50000.0) == Money::fromCents(5000000), "conversion is usable in constant expressions");
+
+    std::ostringstream text;
+    text << Money(-12.05) << ' ' << Money(7.5) << ' ' << Money();
+    EXPECT_EQ(text.str(), "-12.05 7.50 0.00");
+}
+
+// ============================================================================
+// Method: fromExactAmount()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: Money::fromExactAmount()
+/// Test goal: Only doubles that denote a whole number of cents are accepted
+/// In case: Two-decimal amounts, sub-cent amounts, NaN, infinities, values beyond 64 bits
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(MoneyUnitTest, SWE4_Money_fromExactAmount_Boundary_WholeCents) {
+    ASSERT_TRUE(Money::fromExactAmount(0.07, sut));
+    EXPECT_EQ(sut.toCents(), 7);
+    ASSERT_TRUE(Money::fromExactAmount(1000000.01, sut));
+    EXPECT_EQ(sut.toCents(), 100000001);
+    ASSERT_TRUE(Money::fromExactAmount(-0.0, sut));
+    EXPECT_EQ(sut.toCents(), 0);
+
+    sut = Money::fromCents(42);
+    EXPECT_FALSE(Money::fromExactAmount(0.009, sut));
+    EXPECT_FALSE(Money::fromExactAmount(100.001, sut));
+    EXPECT_FALSE(Money::fromExactAmount(std::numeric_limits<double>::quiet_NaN(), sut));
+    EXPECT_FALSE(Money::fromExactAmount(std::numeric_limits<double>::infinity(), sut));
+    EXPECT_FALSE(Money::fromExactAmount(1.0e300, sut));
+    EXPECT_EQ(sut.toCents(), 42);
+
+    // Exact at any magnitude: the neighbours of a whole-cent double are refused
+    EXPECT_FALSE(Money::fromExactAmount(std::nextafter(1000000.0, 1.0e300), sut));
+    EXPECT_FALSE(Money::fromExactAmount(1000000.0009, sut));
+    EXPECT_FALSE(Money::fromExactAmount(std::nextafter(0.01, 0.0), sut));
+    ASSERT_TRUE(Money::fromExactAmount(12345678901234.56, sut));
+    EXPECT_EQ(sut.toCents(), 1234567890123456LL);
+
+    // The processor validates the amount as given and processes it rounded to the cent
+    TransactionProcessor processor;
+    EXPECT_TRUE(processor.validateTransaction(100.001, TransactionType::DEPOSIT));
+    EXPECT_FALSE(processor.validateTransaction(std::nextafter(1000000.0, 1.0e300), TransactionType::DEPOSIT));
+}
+
+// ============================================================================
+// Method: checkedAdd() & checkedSubtract()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: Money::checkedAdd() & checkedSubtract() & operator+ & operator-
+/// Test goal: Overflow is reported by the checked variants and saturates the operators
+/// In case: Sums and differences at both ends of the range
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(MoneyUnitTest, SWE4_Money_checkedAdd_Boundary_Overflow) {
+    const Money one = Money::fromCents(1);
+    EXPECT_TRUE(Money::checkedAdd(Money::max() - one, one, sut));
+    EXPECT_EQ(sut, Money::max());
+    EXPECT_FALSE(Money::checkedAdd(Money::max(), one, sut));
+    EXPECT_FALSE(Money::checkedAdd(Money::min(), -one, sut));
+    EXPECT_FALSE(Money::checkedSubtract(Money::min(), one, sut));
+    EXPECT_FALSE(Money::checkedSubtract(Money::max(), -one, sut));
+    EXPECT_TRUE(Money::checkedSubtract(Money::min() + one, one, sut));
+    EXPECT_EQ(sut, Money::min());
+
+    EXPECT_EQ(Money::max() + one, Money::max());
+    EXPECT_EQ(Money::min() - one, Money::min());
+    EXPECT_EQ(-Money::max(), Money::min());
+    EXPECT_EQ(Money(2.5) - Money(0.75), Money(1.75));
+}
+
+// ============================================================================
+// Method: operator+=
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: Money::operator+=
+/// Test goal: Summing many small amounts is exact, unlike a double accumulator
+/// In case: One million additions of 0.1
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(MoneyUnitTest, SWE4_Money_operatorPlusAssign_Normal_NoDrift) {
+    double drifting = 0.0;
+    for (int i = 0; i < 1000000; ++i) {
+        sut += Money(0.1);
+        drifting += 0.1;
+    }
+    EXPECT_EQ(sut, Money::fromCents(10000000));
+    EXPECT_NE(drifting, 100000.0);
+}
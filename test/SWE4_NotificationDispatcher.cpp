@@ -0,0 +1,276 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/ExternalServices.hpp"
+#include "../inc/Instrumentation.hpp"
+#include "../inc/NotificationDispatcher.hpp"
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+static const char* const GATE_RECIPIENT = "gate@example.com";
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockNotificationService : public NotificationService {
+public:
+    MOCK_METHOD(bool, sendEmailNotification, (const std::string& email, const std::string& subject, const std::string& body), (override));
+    MOCK_METHOD(bool, sendSmsNotification, (const std::string& phoneNumber, const std::string& message), (override));
+    MOCK_METHOD(bool, sendPushNotification, (const std::string& deviceToken, const std::string& title, const std::string& message), (override));
+    MOCK_METHOD(bool, subscribeToNotifications, (const std::string& accountNumber, const std::string& notificationType), (override));
+};
+
+// Gateway with a bulk endpoint
+class MockBulkNotificationService : public MockNotificationService {
+public:
+    MOCK_METHOD(std::vector<bool>, sendEmailNotificationBatch, (const std::vector<EmailNotification>& notifications), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class NotificationDispatcherUnitTest : public ::testing::Test {
+protected:
+    NiceMock<MockNotificationService> service;
+    std::promise<void> gateEntered;
+    std::promise<void> gateReleased;
+    std::shared_future<void> gateOpen{gateReleased.get_future().share()};
+
+    void SetUp() override {
+        Instrumentation::reset();
+        ON_CALL(service, sendEmailNotification(_, _, _)).WillByDefault(Return(true));
+        EXPECT_CALL(service, sendEmailNotification(GATE_RECIPIENT, _, _))
+            .Times(AnyNumber())
+            .WillRepeatedly(Invoke([this](const std::string&, const std::string&, const std::string&) {
+                passGate();
+                return true;
+            }));
+    }
+
+    // Runs on the worker: reports that it holds the gate message and waits for openGate
+    void passGate() {
+        gateEntered.set_value();
+        gateOpen.wait();
+    }
+
+    // Occupies the single worker of the dispatcher until openGate, so that requests stay queued
+    void closeGate(NotificationDispatcher& dispatcher) {
+        dispatcher.sendEmailNotificationAsync(GATE_RECIPIENT, "gate", "gate");
+        gateEntered.get_future().wait();
+    }
+
+    void openGate() {
+        gateReleased.set_value();
+    }
+};
+
+// ============================================================================
+// Method: sendTemplateNotificationAsync()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: NotificationDispatcher::sendTemplateNotificationAsync() & sendEmailNotificationAsync() & flush()
+/// Test goal: Queued requests coalesce per recipient and template and are sent once the worker is free
+/// In case: 100 requests for one recipient, one for another, and two identical free-form emails, behind a busy worker
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(NotificationDispatcherUnitTest, SWE4_NotificationDispatcher_sendTemplateNotificationAsync_Normal_Coalesced) {
+    EXPECT_CALL(service, sendEmailNotification("a@example.com", "Account Verified",
+                                               "Your account has been verified successfully.")).Times(1);
+    EXPECT_CALL(service, sendEmailNotification("b@example.com", "Account Verified", _)).Times(1);
+    EXPECT_CALL(service, sendEmailNotification("a@example.com", "Statement", "ready")).Times(1);
+
+    NotificationDispatcher sut(service, 1);
+    closeGate(sut);
+    for (int i = 0; i < 100; ++i) {
+        sut.sendTemplateNotificationAsync("a@example.com", NotificationTemplate::ACCOUNT_VERIFIED);
+    }
+    sut.sendTemplateNotificationAsync("b@example.com", NotificationTemplate::ACCOUNT_VERIFIED);
+    sut.sendEmailNotificationAsync("a@example.com", "Statement", "ready");
+    sut.sendEmailNotificationAsync("a@example.com", "Statement", "ready");
+
+    const NotificationDispatcherStats queued = sut.getStats();
+    openGate();
+    EXPECT_EQ(queued.queueDepth, 3u);
+    EXPECT_EQ(queued.enqueuedCount, 4u);
+    EXPECT_EQ(queued.coalescedCount, 100u);
+
+    sut.flush();
+    const NotificationDispatcherStats done = sut.getStats();
+    EXPECT_EQ(done.queueDepth, 0u);
+    EXPECT_EQ(done.sentCount, 4u);
+    EXPECT_EQ(done.batchCount, 2u);
+    EXPECT_EQ(done.failedCount, 0u);
+
+    if (Instrumentation::ENABLED) {
+        const InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::COALESCED), 100u);
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::SENT), 4u);
+        EXPECT_EQ(snapshot.notificationQueueDepth(), 0u);
+        EXPECT_EQ(snapshot.latency(LatencyMetric::EMAIL_NOTIFICATION).count, 2u);
+    }
+}
+
+/// ===========================================================================
+/// Verifies: NotificationDispatcher::sendTemplateNotificationAsync() & AccountManager::verifyAccount()
+/// Test goal: A bulk re-verification queues one email instead of calling the gateway per account
+/// In case: 50 pending accounts verified while the worker is busy
+/// Method for Verification: Call count on the mock gateway
+/// ===========================================================================
+TEST_F(NotificationDispatcherUnitTest, SWE4_NotificationDispatcher_sendTemplateNotificationAsync_Normal_BulkVerification) {
+    EXPECT_CALL(service, sendEmailNotification("user@example.com", "Account Verified", _)).Times(1);
+
+    NotificationDispatcher sut(service, 1);
+    AccountManager manager;
+    manager.setAsyncNotificationService(&sut);
+    std::vector<std::string> accounts;
+    for (int i = 0; i < 50; ++i) {
+        accounts.push_back(manager.createAccount(AccountType::CHECKING, 10.0, static_cast<std::uint32_t>(i / 10 + 1)));
+    }
+
+    closeGate(sut);
+    int activated = 0;
+    for (const std::string& account : accounts) {
+        activated += manager.verifyAccount(account, true) ? 1 : 0;
+    }
+    openGate();
+    sut.flush();
+
+    EXPECT_EQ(activated, 50);
+    EXPECT_EQ(sut.getStats().coalescedCount, 49u);
+}
+
+// ============================================================================
+// Method: flush()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: NotificationDispatcher::setRetryPolicy() & flush()
+/// Test goal: Failed emails are retried after a doubling backoff until sent or out of attempts
+/// In case: One email failing twice before success, one failing every attempt, three attempts with 2 ms backoff
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(NotificationDispatcherUnitTest, SWE4_NotificationDispatcher_flush_Boundary_RetryWithBackoff) {
+    EXPECT_CALL(service, sendEmailNotification("r@example.com", _, _))
+        .WillOnce(Return(false))
+        .WillOnce(Return(false))
+        .WillOnce(Return(true));
+    EXPECT_CALL(service, sendEmailNotification("x@example.com", _, _)).Times(3).WillRepeatedly(Return(false));
+
+    NotificationDispatcher sut(service, 1);
+    sut.setRetryPolicy(3, std::chrono::milliseconds(2));
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sut.sendEmailNotificationAsync("r@example.com", "s", "b");
+    sut.sendEmailNotificationAsync("x@example.com", "s", "b");
+    sut.flush();
+    const std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+    const NotificationDispatcherStats stats = sut.getStats();
+    EXPECT_EQ(stats.sentCount, 1u);
+    EXPECT_EQ(stats.retriedCount, 4u);
+    EXPECT_EQ(stats.failedCount, 1u);
+    EXPECT_EQ(stats.queueDepth, 0u);
+    EXPECT_GE(elapsed, std::chrono::milliseconds(2 + 4));
+
+    if (Instrumentation::ENABLED) {
+        const InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::RETRIED), 4u);
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::FAILED), 1u);
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::DISPATCHED), 6u);
+    }
+}
+
+/// ===========================================================================
+/// Verifies: NotificationDispatcher::sendEmailNotificationAsync() & getStats()
+/// Test goal: A full queue drops new emails without waiting, and a throwing gateway fails the batch for a retry
+/// In case: A queue of two behind a busy worker, four distinct emails, and a gateway throwing once
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(NotificationDispatcherUnitTest, SWE4_NotificationDispatcher_sendEmailNotificationAsync_Error_DroppedWhenFull) {
+    EXPECT_CALL(service, sendEmailNotification("a@example.com", _, _))
+        .WillOnce([](const std::string&, const std::string&, const std::string&) -> bool {
+            throw std::runtime_error("smtp down");
+        })
+        .WillOnce(Return(true));
+    EXPECT_CALL(service, sendEmailNotification("b@example.com", _, _)).Times(0);
+    EXPECT_CALL(service, sendEmailNotification("c@example.com", _, _)).Times(0);
+    EXPECT_CALL(service, sendEmailNotification("d@example.com", _, _)).Times(1);
+
+    NotificationDispatcher sut(service, 1, 2);
+    sut.setRetryPolicy(2, std::chrono::milliseconds(1));
+    closeGate(sut);
+    sut.sendEmailNotificationAsync("a@example.com", "s", "b");
+    sut.sendEmailNotificationAsync("d@example.com", "s", "b");
+    sut.sendEmailNotificationAsync("b@example.com", "s", "b");
+    sut.sendEmailNotificationAsync("c@example.com", "s", "b");
+
+    const NotificationDispatcherStats full = sut.getStats();
+    const InstrumentationSnapshot snapshot = Instrumentation::snapshot();
+    openGate();
+    EXPECT_EQ(full.queueDepth, 2u);
+    EXPECT_EQ(full.droppedCount, 2u);
+    if (Instrumentation::ENABLED) {
+        EXPECT_EQ(snapshot.notificationCount(NotificationEvent::DROPPED), 2u);
+        EXPECT_EQ(snapshot.notificationQueueDepth(), 2u);
+    }
+
+    // The throw fails the whole batch before "d" is attempted; both emails go out on the retry
+    sut.flush();
+    const NotificationDispatcherStats done = sut.getStats();
+    EXPECT_EQ(done.sentCount, 3u);
+    EXPECT_EQ(done.retriedCount, 2u);
+    EXPECT_EQ(done.failedCount, 0u);
+}
+
+/// ===========================================================================
+/// Verifies: NotificationDispatcher::flush() & NotificationService::sendEmailNotificationBatch()
+/// Test goal: Queued emails reach a bulk endpoint in batches of at most batchSize, in queue order
+/// In case: Ten emails queued behind a busy worker with a batch size of four
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(NotificationDispatcherUnitTest, SWE4_NotificationDispatcher_flush_Boundary_BatchSize) {
+    NiceMock<MockBulkNotificationService> bulk;
+    std::vector<std::string> order;
+    std::vector<std::size_t> sizes;
+    EXPECT_CALL(bulk, sendEmailNotificationBatch(_))
+        .Times(4)
+        .WillRepeatedly(Invoke([&](const std::vector<EmailNotification>& notifications) {
+            if (notifications.front().email == GATE_RECIPIENT) {
+                passGate();
+            }
+            sizes.push_back(notifications.size());
+            for (const EmailNotification& notification : notifications) {
+                order.push_back(notification.email);
+            }
+            return std::vector<bool>(notifications.size(), true);
+        }));
+    EXPECT_CALL(bulk, sendEmailNotification(_, _, _)).Times(0);
+
+    NotificationDispatcher sut(bulk, 1, NotificationDispatcher::DEFAULT_QUEUE_CAPACITY, 4);
+    closeGate(sut);
+    for (int i = 0; i < 10; ++i) {
+        sut.sendEmailNotificationAsync("user" + std::to_string(i) + "@example.com", "s", "b");
+    }
+    openGate();
+    sut.flush();
+
+    EXPECT_EQ(sizes, (std::vector<std::size_t>{1, 4, 4, 2}));
+    ASSERT_EQ(order.size(), 11u);
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(order[i + 1], "user" + std::to_string(i) + "@example.com");
+    }
+    EXPECT_EQ(sut.getStats().sentCount, 11u);
+}
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include <string>
+
+#include "../inc/AccountManager.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class ProcessingContextUnitTest : public ::testing::Test {
+protected:
+    ProcessingContext sut;
+};
+
+// ============================================================================
+// Method: TransactionProcessor::setProcessingContext()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::setProcessingContext() & getProcessingContext()
+/// Test goal: A bound processor counts into and is locked by its own context only
+/// In case: One processor on the context under test, locked and unlocked, then rebound to the global one
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(ProcessingContextUnitTest, SWE4_ProcessingContext_setProcessingContext_Normal_IsolatesProcessor) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    EXPECT_EQ(&processor.getProcessingContext(), &ProcessingContext::global());
+
+    processor.setProcessingContext(&sut);
+    const int globalBefore = ProcessingContext::global().totalTransactionsProcessed.load();
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 250.0, "SRC", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::WITHDRAWAL, 50.0, "SRC", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(sut.totalTransactionsProcessed.load(), 2);
+    EXPECT_EQ(sut.totalVolumeProcessedCents.load(), 25000);
+    EXPECT_EQ(ProcessingContext::global().totalTransactionsProcessed.load(), globalBefore);
+
+    sut.systemLocked = true;
+    EXPECT_EQ(processor.executeTransfer(10.0, "A", "B", false), TransactionStatus::PENDING);
+    EXPECT_FALSE(ProcessingContext::global().systemLocked.load());
+
+    processor.setProcessingContext(nullptr);
+    EXPECT_EQ(&processor.getProcessingContext(), &ProcessingContext::global());
+    EXPECT_EQ(processor.executeTransfer(10.0, "A", "B", false), TransactionStatus::COMPLETED);
+}
+
+// ============================================================================
+// Method: AccountManager::setProcessingContext()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AccountManager::setProcessingContext() & evaluateAccountRisk()
+/// Test goal: Creation totals and the compliance audit switch come from the bound context
+/// In case: A high-risk account evaluated with the audit switch off and on in the context under test
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(ProcessingContextUnitTest, SWE4_ProcessingContext_setProcessingContext_Normal_IsolatesManager) {
+    AccountManager manager;
+    manager.setProcessingContext(&sut);
+    const std::string first = manager.createAccount(AccountType::CHECKING, 100.25);
+    const std::string second = manager.createAccount(AccountType::CHECKING, 10.0);
+    EXPECT_EQ(sut.totalAccountsCreated.load(), 2);
+    EXPECT_EQ(sut.systemTotalBalanceCents.load(), 11025);
+
+    EXPECT_EQ(manager.evaluateAccountRisk(first, 101, 1000000.01), AccountStatus::SUSPENDED);
+    sut.complianceAuditMode = true;
+    EXPECT_FALSE(ProcessingContext::global().complianceAuditMode.load());
+    EXPECT_EQ(manager.evaluateAccountRisk(second, 101, 1000000.01), AccountStatus::FROZEN);
+    EXPECT_EQ(&manager.getProcessingContext(), &sut);
+}
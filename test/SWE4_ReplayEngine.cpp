@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include "../inc/AccountSymbolTable.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/ReplayEngine.hpp"
+#include "../inc/TransactionHistory.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class ReplayEngineUnitTest : public ::testing::Test {
+protected:
+    AccountSymbolTable symbols;
+    std::vector<Transaction> transactions;
+    std::vector<TransactionHistoryRecord> records;
+
+    void SetUp() override {
+        // Two days of traffic from 40 sources: enough to hit the daily count limit of one processor,
+        // with invalid amounts, over-cap withdrawals, self transfers and an unknown type mixed in
+        const std::time_t start = 1700000000;
+        for (int i = 0; i < 4000; ++i) {
+            const std::string source = "SRC" + std::to_string(i % 40);
+            const std::string dest = (i % 97 == 0) ? source : "DST" + std::to_string(i % 7);
+            const int type = (i % 211 == 0) ? 9 : i % 4;
+            double amount = 10.0 + (i % 300) * 3.25;
+            if (i % 53 == 0) {
+                amount = 0.0;
+            } else if (i % 61 == 0) {
+                amount = 60000.0;
+            }
+            transactions.push_back(Transaction{i, static_cast<TransactionType>(type), amount, symbols.intern(source),
+                                               symbols.intern(dest), start + i * 43, TransactionStatus::COMPLETED});
+            TransactionHistoryRecord record;
+            TransactionHistory::toRecord(transactions.back(), symbols, record);
+            records.push_back(record);
+        }
+    }
+};
+
+// ============================================================================
+// Method: replay()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ReplayEngine::replay()
+/// Test goal: Statuses and merged totals do not depend on the thread count
+/// In case: The same 4000 records on 1, 2, 3 and 8 threads with 16 partitions, unlocked and locked
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(ReplayEngineUnitTest, SWE4_ReplayEngine_replay_Normal_IndependentOfThreadCount) {
+    for (bool locked : {false, true}) {
+        ReplayEngine reference(1, 16);
+        reference.setSystemLocked(locked);
+        const ReplayResult expected = reference.replay(records);
+        ASSERT_EQ(expected.statuses.size(), records.size());
+        EXPECT_GT(expected.statusCounts[static_cast<std::size_t>(TransactionStatus::COMPLETED)], 0u);
+        EXPECT_GT(expected.statusCounts[static_cast<std::size_t>(TransactionStatus::REJECTED)], 0u);
+        EXPECT_GT(expected.statusCounts[static_cast<std::size_t>(TransactionStatus::CANCELLED)], 0u);
+        EXPECT_EQ(expected.statusCounts[static_cast<std::size_t>(TransactionStatus::PENDING)] > 0, locked);
+
+        for (std::size_t threads : {2u, 3u, 8u}) {
+            ReplayEngine sut(threads, 16);
+            sut.setSystemLocked(locked);
+            const ReplayResult actual = sut.replay(records);
+            EXPECT_EQ(sut.getThreadCount(), threads);
+            EXPECT_EQ(actual.statuses, expected.statuses) << threads << " threads";
+            EXPECT_EQ(actual.statusCounts, expected.statusCounts);
+            EXPECT_EQ(actual.totalTransactionsProcessed, expected.totalTransactionsProcessed);
+            EXPECT_EQ(actual.totalVolumeProcessed, expected.totalVolumeProcessed);
+        }
+    }
+}
+
+/// ===========================================================================
+/// Verifies: ReplayEngine::replay() & partitionOf()
+/// Test goal: Any partition count reproduces a single processor replayed at the recorded timestamps
+/// In case: 4000 records crossing the daily count limit and a day boundary, on 1, 16 and 64 partitions
+/// Method for Verification: Comparison against the sequential implementation
+/// ===========================================================================
+TEST_F(ReplayEngineUnitTest, SWE4_ReplayEngine_replay_Boundary_PartitionsMatchSequential) {
+    ProcessingContext context;
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setProcessingContext(&context);
+    std::time_t now = 0;
+    processor.setClock([&now]() { return now; });
+
+    std::vector<TransactionStatus> expected;
+    for (const Transaction& transaction : transactions) {
+        now = transaction.timestamp;
+        expected.push_back(processor.processTransaction(transaction.type, transaction.amount.toDouble(),
+                                                        std::string(symbols.name(transaction.sourceAccount)),
+                                                        std::string(symbols.name(transaction.destAccount))));
+    }
+
+    for (std::size_t partitions : {std::size_t(1), std::size_t(16), ReplayEngine::DEFAULT_PARTITION_COUNT}) {
+        ReplayEngine sut(4, partitions);
+        const ReplayResult actual = sut.replay(records);
+        EXPECT_EQ(actual.statuses, expected) << partitions << " partitions";
+        EXPECT_EQ(actual.totalTransactionsProcessed, context.totalTransactionsProcessed.load());
+        EXPECT_EQ(actual.totalVolumeProcessed.toCents(), context.totalVolumeProcessedCents.load());
+    }
+
+    ReplayEngine single(4, 1);
+    EXPECT_EQ(single.partitionOf("SRC1"), 0u);
+    ReplayEngine partitioned(1, ReplayEngine::DEFAULT_PARTITION_COUNT);
+    EXPECT_EQ(partitioned.getPartitionCount(), ReplayEngine::DEFAULT_PARTITION_COUNT);
+    EXPECT_EQ(partitioned.partitionOf("SRC1"), partitioned.partitionOf("SRC1"));
+    EXPECT_LT(partitioned.partitionOf("SRC2"), ReplayEngine::DEFAULT_PARTITION_COUNT);
+}
+
+// ============================================================================
+// Method: replayFile()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: ReplayEngine::replayFile()
+/// Test goal: A history segment replays like its records, and missing files are not created
+/// In case: A segment holding 500 spilled records, a path that does not exist
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(ReplayEngineUnitTest, SWE4_ReplayEngine_replayFile_Error_SegmentOrMissing) {
+    const std::string path = ::testing::TempDir() + "SWE4_ReplayEngine_replayFile.seg";
+    const std::string missing = ::testing::TempDir() + "SWE4_ReplayEngine_missing.seg";
+    std::remove(path.c_str());
+    std::remove(missing.c_str());
+    {
+        // Ring of one: every append but the last is spilled to the segment
+        TransactionHistory history(1);
+        ASSERT_TRUE(history.openSegment(path));
+        for (int i = 0; i <= 500; ++i) {
+            history.append(transactions[i], symbols);
+        }
+        ASSERT_EQ(history.getSpilledCount(), 500u);
+    }
+
+    ReplayEngine sut(2, 8);
+    ReplayResult fromFile{};
+    ASSERT_TRUE(sut.replayFile(path, fromFile));
+    const ReplayResult fromRecords = sut.replay(std::vector<TransactionHistoryRecord>(records.begin(),
+                                                                                      records.begin() + 500));
+    EXPECT_EQ(fromFile.statuses, fromRecords.statuses);
+    EXPECT_EQ(fromFile.totalVolumeProcessed, fromRecords.totalVolumeProcessed);
+
+    ReplayResult untouched{};
+    EXPECT_FALSE(sut.replayFile(missing, untouched));
+    EXPECT_TRUE(untouched.statuses.empty());
+    EXPECT_EQ(std::fopen(missing.c_str(), "rb"), nullptr);
+    std::remove(path.c_str());
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <thread>
+
+#include "../inc/SpscQueue.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class SpscQueueUnitTest : public ::testing::Test {
+protected:
+    SpscQueue<int> sut{3};
+};
+
+// ============================================================================
+// Method: tryPush() / tryPop()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: SpscQueue::tryPush() & tryPop() & size() & capacity()
+/// Test goal: The capacity is rounded up to a power of two, a full queue refuses and order is FIFO
+/// In case: A capacity of 3, filled, drained and refilled across the wrap-around
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(SpscQueueUnitTest, SWE4_SpscQueue_tryPush_Boundary_FullAndEmpty) {
+    int value = -1;
+    EXPECT_EQ(sut.capacity(), 4u);
+    EXPECT_FALSE(sut.tryPop(value));
+    EXPECT_EQ(value, -1);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(sut.tryPush(round * 10 + i));
+        }
+        EXPECT_FALSE(sut.tryPush(99));
+        EXPECT_EQ(sut.size(), 4u);
+
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(sut.tryPop(value));
+            EXPECT_EQ(value, round * 10 + i);
+        }
+        EXPECT_FALSE(sut.tryPop(value));
+        EXPECT_EQ(sut.size(), 0u);
+
+        // Leave one behind so the next round starts mid-ring
+        ASSERT_TRUE(sut.tryPush(-2));
+        ASSERT_TRUE(sut.tryPop(value));
+    }
+}
+
+// ============================================================================
+// Method: push() / pop()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: SpscQueue::push() & pop()
+/// Test goal: A producer far faster than its consumer is held back without losing or reordering elements
+/// In case: 200000 elements through a queue of 4 slots between two threads
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(SpscQueueUnitTest, SWE4_SpscQueue_push_Normal_TwoThreadsInOrder) {
+    const int count = 200000;
+    std::thread producer([this]() {
+        for (int i = 0; i < count; ++i) {
+            sut.push(i);
+        }
+    });
+
+    // No assertion may return before the join
+    std::int64_t sum = 0;
+    int outOfOrder = 0;
+    for (int i = 0; i < count; ++i) {
+        const int value = sut.pop();
+        outOfOrder += (value != i || sut.size() > sut.capacity()) ? 1 : 0;
+        sum += value;
+    }
+    producer.join();
+    EXPECT_EQ(outOfOrder, 0);
+    EXPECT_EQ(sum, static_cast<std::int64_t>(count) * (count - 1) / 2);
+    EXPECT_EQ(sut.size(), 0u);
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/TokenBucketRateLimiter.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::_;
+
+// ============================================================================
+// Mock Classes
+// ============================================================================
+
+class MockThrottledComplianceService : public ComplianceCheckService {
+public:
+    MOCK_METHOD(ComplianceLevel, checkComplianceLevel, (const std::string& accountNumber), (override));
+    MOCK_METHOD(bool, reportSuspiciousActivity, (const std::string& accountNumber, const std::string& description), (override));
+    MOCK_METHOD(std::vector<std::string>, getBlacklist, (), (override));
+    MOCK_METHOD(bool, isAccountBlacklisted, (const std::string& accountNumber), (override));
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class TokenBucketRateLimiterUnitTest : public ::testing::Test {
+protected:
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::time_point(std::chrono::hours(1));
+
+    TokenBucketRateLimiter::Clock fakeClock() {
+        return [this]() { return now; };
+    }
+};
+
+// ============================================================================
+// Method: incrementRateCounter()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TokenBucketRateLimiter::incrementRateCounter() & getRemainingRequests()
+/// Test goal: A bucket allows its burst and then refills lazily at the configured rate
+/// In case: Capacity 3, 10 tokens per second, clock moved by 99 ms, 100 ms and 10 s
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TokenBucketRateLimiterUnitTest, SWE4_TokenBucketRateLimiter_incrementRateCounter_Boundary_BurstAndRefill) {
+    TokenBucketRateLimiter sut(3, 10.0, 100, std::chrono::seconds(60), fakeClock());
+
+    EXPECT_EQ(sut.getRemainingRequests("ACC1"), 3);
+    EXPECT_TRUE(sut.incrementRateCounter("ACC1"));
+    EXPECT_TRUE(sut.incrementRateCounter("ACC1"));
+    EXPECT_TRUE(sut.incrementRateCounter("ACC1"));
+    EXPECT_FALSE(sut.incrementRateCounter("ACC1"));
+    EXPECT_EQ(sut.getRemainingRequests("ACC1"), 0);
+    EXPECT_TRUE(sut.incrementRateCounter("ACC2"));
+
+    now += std::chrono::milliseconds(99);
+    EXPECT_FALSE(sut.incrementRateCounter("ACC1"));
+    now += std::chrono::milliseconds(1);
+    EXPECT_TRUE(sut.incrementRateCounter("ACC1"));
+    EXPECT_FALSE(sut.incrementRateCounter("ACC1"));
+
+    // Refill stops at the capacity
+    now += std::chrono::seconds(10);
+    EXPECT_EQ(sut.getRemainingRequests("ACC1"), 3);
+}
+
+/// ===========================================================================
+/// Verifies: TokenBucketRateLimiter::incrementRateCounter()
+/// Test goal: Concurrent callers never take more tokens than the bucket holds
+/// In case: Four threads take 500 tokens each from one bucket of 1000 with the clock stopped
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(TokenBucketRateLimiterUnitTest, SWE4_TokenBucketRateLimiter_incrementRateCounter_Normal_Concurrent) {
+    TokenBucketRateLimiter sut(1000, 1.0, 100, std::chrono::seconds(60), fakeClock());
+    std::atomic<int> taken(0);
+
+    std::vector<std::thread> callers;
+    for (int t = 0; t < 4; ++t) {
+        callers.emplace_back([&sut, &taken]() {
+            for (int i = 0; i < 500; ++i) {
+                if (sut.incrementRateCounter("ACC1")) {
+                    taken.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (std::thread& caller : callers) {
+        caller.join();
+    }
+
+    EXPECT_EQ(taken.load(), 1000);
+    EXPECT_EQ(sut.size(), 1u);
+}
+
+// ============================================================================
+// Method: evictIdle()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TokenBucketRateLimiter::evictIdle() & incrementRateCounter()
+/// Test goal: A full table refuses new accounts until idle buckets can be evicted
+/// In case: Table of 16 slots filled by 16 accounts, 17th account before and after the idle timeout, sweep
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(TokenBucketRateLimiterUnitTest, SWE4_TokenBucketRateLimiter_evictIdle_Error_TableFull) {
+    TokenBucketRateLimiter sut(1, 1.0, 8, std::chrono::seconds(5), fakeClock());
+    for (int i = 0; i < 16; ++i) {
+        ASSERT_TRUE(sut.incrementRateCounter("ACC" + std::to_string(i)));
+    }
+    EXPECT_EQ(sut.size(), 16u);
+    EXPECT_FALSE(sut.incrementRateCounter("ACC16"));
+    EXPECT_EQ(sut.getRejectedInsertCount(), 1u);
+
+    // Full again after 1 s, idle after 1 s + 5 s
+    now += std::chrono::seconds(5);
+    EXPECT_EQ(sut.evictIdle(), 0u);
+    now += std::chrono::seconds(1);
+    EXPECT_TRUE(sut.incrementRateCounter("ACC16"));
+    EXPECT_EQ(sut.size(), 1u);
+
+    now += std::chrono::seconds(6);
+    EXPECT_EQ(sut.evictIdle(), 1u);
+    EXPECT_EQ(sut.size(), 0u);
+}
+
+// ============================================================================
+// Class: RateLimitingService
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TokenBucketRateLimiter::checkRateLimit() & resetRateLimits()
+/// Test goal: checkRateLimit does not take a token and resetRateLimits refills the bucket
+/// In case: Capacity 1, checked twice, taken, reset
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(TokenBucketRateLimiterUnitTest, SWE4_TokenBucketRateLimiter_resetRateLimits_Normal_Refill) {
+    TokenBucketRateLimiter sut(1, 0.1, 10, std::chrono::seconds(60), fakeClock());
+    RateLimitingService& service = sut;
+
+    EXPECT_TRUE(service.checkRateLimit("ACC1"));
+    EXPECT_TRUE(service.checkRateLimit("ACC1"));
+    EXPECT_TRUE(service.incrementRateCounter("ACC1"));
+    EXPECT_FALSE(service.checkRateLimit("ACC1"));
+
+    service.resetRateLimits("ACC1");
+    EXPECT_EQ(service.getRemainingRequests("ACC1"), 1);
+    EXPECT_TRUE(service.incrementRateCounter("ACC1"));
+    service.resetRateLimits("ACC9");
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & processBatch() & setRateLimitingService()
+/// Test goal: Throttled sources are rejected before the compliance service is asked
+/// In case: Two requests per source allowed, three single transactions and a batch of three
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(TokenBucketRateLimiterUnitTest, SWE4_TokenBucketRateLimiter_processTransaction_Normal_PreCheck) {
+    TokenBucketRateLimiter limiter(2, 0.001, 100, std::chrono::seconds(60), fakeClock());
+    NiceMock<MockThrottledComplianceService> compliance;
+    ON_CALL(compliance, checkComplianceLevel(_)).WillByDefault(Return(ComplianceLevel::LOW_RISK));
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setComplianceService(&compliance);
+    processor.setRateLimitingService(&limiter);
+
+    EXPECT_CALL(compliance, checkComplianceLevel("SRC1")).Times(2);
+    EXPECT_CALL(compliance, checkComplianceLevel("SRC2")).Times(1);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC1", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC1", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC1", ""), TransactionStatus::REJECTED);
+    // Invalid requests do not spend a token
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, -1.0, "SRC2", ""), TransactionStatus::REJECTED);
+    EXPECT_EQ(limiter.getRemainingRequests("SRC2"), 2);
+
+    std::vector<TransactionRequest> batch(3, TransactionRequest{TransactionType::DEPOSIT, 10.0, "SRC2", ""});
+    std::vector<TransactionStatus> statuses = processor.processBatch(batch);
+    EXPECT_EQ(statuses[0], TransactionStatus::COMPLETED);
+    EXPECT_EQ(statuses[1], TransactionStatus::COMPLETED);
+    EXPECT_EQ(statuses[2], TransactionStatus::REJECTED);
+    EXPECT_EQ(processor.getTransactionCount(), 4);
+}
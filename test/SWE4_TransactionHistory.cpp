@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../inc/TransactionHistory.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class TransactionHistoryUnitTest : public ::testing::Test {
+protected:
+    std::string segmentPath;
+    AccountSymbolTable symbols;
+
+    void SetUp() override {
+        segmentPath = ::testing::TempDir() + "SWE4_TransactionHistory_" +
+                      ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".seg";
+        std::remove(segmentPath.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(segmentPath.c_str());
+    }
+
+    Transaction makeTransaction(int id, time_t timestamp) {
+        return Transaction{id, TransactionType::TRANSFER, id * 1.5, symbols.intern("ACC" + std::to_string(id)),
+                           symbols.intern("ACC1"), timestamp, TransactionStatus::COMPLETED};
+    }
+
+    std::vector<int> collectIds(const TransactionHistory& history, time_t since, time_t until) {
+        std::vector<int> ids;
+        history.forEachTransaction(since, until, [&ids](const TransactionHistoryRecord& record) {
+            ids.push_back(record.id);
+        });
+        return ids;
+    }
+};
+
+// ============================================================================
+// Method: append()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::append()
+/// Test goal: Memory stays bounded and evicted records are dropped without a segment
+/// In case: Append ten records into a ring of four
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_append_Boundary_RingWithoutSegment) {
+    TransactionHistory sut(4);
+    for (int i = 1; i <= 10; ++i) {
+        sut.append(makeTransaction(i, 100 + i), symbols);
+    }
+
+    EXPECT_EQ(sut.getInMemoryCount(), 4u);
+    EXPECT_EQ(sut.getDroppedCount(), 6u);
+    EXPECT_EQ(sut.size(), 4u);
+    EXPECT_EQ(collectIds(sut, 0, 1000), (std::vector<int>{7, 8, 9, 10}));
+}
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::append() & openSegment()
+/// Test goal: Evicted records spill to the segment and the scan sees everything in order
+/// In case: Append more records than the ring and the initial segment hold
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_append_Normal_SpillsToSegment) {
+    const int total = 10000;
+    TransactionHistory sut(16);
+    ASSERT_TRUE(sut.openSegment(segmentPath));
+    for (int i = 1; i <= total; ++i) {
+        sut.append(makeTransaction(i, i), symbols);
+    }
+
+    EXPECT_EQ(sut.getInMemoryCount(), 16u);
+    EXPECT_EQ(sut.getSpilledCount(), static_cast<std::size_t>(total - 16));
+    EXPECT_EQ(sut.getDroppedCount(), 0u);
+
+    std::vector<int> ids = collectIds(sut, 0, total + 1);
+    ASSERT_EQ(ids.size(), static_cast<std::size_t>(total));
+    for (int i = 0; i < total; ++i) {
+        EXPECT_EQ(ids[i], i + 1);
+    }
+}
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::toRecord()
+/// Test goal: Account numbers up to the field width are kept in full and stay NUL-terminated
+/// In case: A 34-character IBAN and a source of exactly MAX_ACCOUNT_LENGTH characters
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_toRecord_Boundary_KeepsFullAccounts) {
+    const std::string iban = "GB33BUKB20201555555555DE8912345678";
+    Transaction transaction = makeTransaction(5, 77);
+    transaction.sourceAccount = symbols.intern(iban);
+
+    TransactionHistoryRecord record;
+    ASSERT_TRUE(TransactionHistory::toRecord(transaction, symbols, record));
+    EXPECT_EQ(std::string(record.sourceAccount), iban);
+    EXPECT_EQ(std::string(record.destAccount), "ACC1");
+    EXPECT_EQ(record.amount, 7.5);
+    EXPECT_EQ(record.timestamp, 77);
+    EXPECT_EQ(record.type, static_cast<int>(TransactionType::TRANSFER));
+
+    const std::string longest(TransactionHistoryRecord::MAX_ACCOUNT_LENGTH, 'X');
+    transaction.sourceAccount = symbols.intern(longest);
+    ASSERT_TRUE(TransactionHistory::toRecord(transaction, symbols, record));
+    EXPECT_EQ(std::string(record.sourceAccount), longest);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::append() & toRecord()
+/// Test goal: A transaction whose account does not fit is refused and counted, never truncated
+/// In case: A source and a destination one character longer than MAX_ACCOUNT_LENGTH, into a full ring
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_append_Error_RefusesLongAccounts) {
+    const std::string tooLong(TransactionHistoryRecord::MAX_ACCOUNT_LENGTH + 1, 'X');
+    TransactionHistory sut(2);
+    EXPECT_TRUE(sut.append(makeTransaction(1, 1), symbols));
+    EXPECT_TRUE(sut.append(makeTransaction(2, 2), symbols));
+
+    Transaction longSource = makeTransaction(3, 3);
+    longSource.sourceAccount = symbols.intern(tooLong);
+    Transaction longDestination = makeTransaction(4, 4);
+    longDestination.destAccount = symbols.intern(tooLong);
+    TransactionHistoryRecord record;
+    EXPECT_FALSE(TransactionHistory::toRecord(longSource, symbols, record));
+    EXPECT_FALSE(sut.append(longSource, symbols));
+    EXPECT_FALSE(sut.append(longDestination, symbols));
+
+    EXPECT_EQ(sut.getRefusedCount(), 2u);
+    EXPECT_EQ(sut.getDroppedCount(), 0u);
+    EXPECT_EQ(collectIds(sut, 0, 100), (std::vector<int>{1, 2}));
+}
+
+// ============================================================================
+// Method: forEachTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::forEachTransaction()
+/// Test goal: The time window is half-open and applies to ring and segment alike
+/// In case: Window straddling the spilled and in-memory records
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_forEachTransaction_Boundary_Window) {
+    TransactionHistory sut(3);
+    ASSERT_TRUE(sut.openSegment(segmentPath));
+    for (int i = 1; i <= 8; ++i) {
+        sut.append(makeTransaction(i, 10 * i), symbols);
+    }
+
+    EXPECT_EQ(collectIds(sut, 40, 70), (std::vector<int>{4, 5, 6}));
+    EXPECT_EQ(collectIds(sut, 41, 71), (std::vector<int>{5, 6, 7}));
+    EXPECT_TRUE(collectIds(sut, 50, 50).empty());
+}
+
+// ============================================================================
+// Method: openSegment()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::openSegment()
+/// Test goal: Records spilled by an earlier instance are readable after reopening
+/// In case: Spill, close, reopen the same segment in a new history
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_openSegment_Normal_Reopen) {
+    {
+        TransactionHistory first(2);
+        ASSERT_TRUE(first.openSegment(segmentPath));
+        for (int i = 1; i <= 5; ++i) {
+            first.append(makeTransaction(i, i), symbols);
+        }
+    }
+
+    TransactionHistory sut(2);
+    ASSERT_TRUE(sut.openSegment(segmentPath));
+    EXPECT_EQ(sut.getSpilledCount(), 3u);
+    sut.append(makeTransaction(42, 42), symbols);
+    EXPECT_EQ(collectIds(sut, 0, 100), (std::vector<int>{1, 2, 3, 42}));
+}
+
+/// ===========================================================================
+/// Verifies: TransactionHistory::openSegment()
+/// Test goal: A file with a foreign layout is rejected and left untouched
+/// In case: Segment path holding arbitrary bytes
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_openSegment_Error_ForeignFile) {
+    std::FILE* file = std::fopen(segmentPath.c_str(), "wb");
+    ASSERT_NE(file, nullptr);
+    std::fputs("not a history segment", file);
+    std::fclose(file);
+
+    TransactionHistory sut(2);
+    EXPECT_FALSE(sut.openSegment(segmentPath));
+    EXPECT_FALSE(sut.openSegment(::testing::TempDir() + "missing_dir/none/history.seg"));
+
+    file = std::fopen(segmentPath.c_str(), "rb");
+    ASSERT_NE(file, nullptr);
+    std::fseek(file, 0, SEEK_END);
+    EXPECT_EQ(std::ftell(file), 21L);
+    std::fclose(file);
+    EXPECT_EQ(sut.getSpilledCount(), 0u);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::getTransactionHistory()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::getTransactionHistory()
+/// Test goal: Accepted transactions are recorded, rejected ones are not
+/// In case: One deposit accepted and one invalid amount rejected
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(TransactionHistoryUnitTest, SWE4_TransactionHistory_getTransactionHistory_Normal_RecordsAccepted) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.processTransaction(TransactionType::DEPOSIT, 25.0, "ACC500001", "");
+    processor.processTransaction(TransactionType::DEPOSIT, 0.0, "ACC500001", "");
+
+    const TransactionHistory& sut = processor.getTransactionHistory();
+    ASSERT_EQ(sut.size(), 1u);
+    sut.forEachTransaction(0, time(nullptr) + 1, [](const TransactionHistoryRecord& record) {
+        EXPECT_EQ(std::string(record.sourceAccount), "ACC500001");
+        EXPECT_EQ(record.amount, 25.0);
+        EXPECT_EQ(record.status, static_cast<int>(TransactionStatus::COMPLETED));
+    });
+}
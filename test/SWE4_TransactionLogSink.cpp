@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include "../inc/TransactionLogSink.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Stub Classes
+// ============================================================================
+
+// Counts the bytes written to it and how many of them the last flush covered
+class CountingStreamBuffer : public std::streambuf {
+public:
+    std::atomic<std::size_t> receivedBytes{0};
+    std::atomic<std::size_t> flushedBytes{0};
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            receivedBytes.fetch_add(1, std::memory_order_relaxed);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char*, std::streamsize count) override {
+        receivedBytes.fetch_add(static_cast<std::size_t>(count), std::memory_order_relaxed);
+        return count;
+    }
+
+    int sync() override {
+        flushedBytes.store(receivedBytes.load(std::memory_order_relaxed), std::memory_order_release);
+        return 0;
+    }
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class TransactionLogSinkUnitTest : public ::testing::Test {
+protected:
+    std::ostringstream output;
+    AccountSymbolTable symbols;
+
+    Transaction makeTransaction(int id, TransactionStatus status) {
+        return Transaction{id, TransactionType::DEPOSIT, 25.5, symbols.intern("SRC"),
+                           AccountSymbolTable::EMPTY_ACCOUNT, 1700000000, status};
+    }
+};
+
+// ============================================================================
+// Class: AsyncTransactionLogSink
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: AsyncTransactionLogSink::write() & flush()
+/// Test goal: Text format matches the console line without per-line flushing
+/// In case: Write two transactions, flush, compare the stream content
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_write_Normal_TextFormat) {
+    AsyncTransactionLogSink sink(output, TransactionLogFormat::TEXT);
+    sink.write(makeTransaction(7, TransactionStatus::COMPLETED));
+    sink.write(makeTransaction(8, TransactionStatus::PENDING));
+    sink.flush();
+
+    EXPECT_EQ(output.str(), "Transaction ID: 7 Status: 4\nTransaction ID: 8 Status: 0\n");
+}
+
+/// ===========================================================================
+/// Verifies: AsyncTransactionLogSink::write() & flush()
+/// Test goal: Binary format writes one fixed-width record per transaction
+/// In case: Write one transaction, flush, decode the record
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_write_Normal_BinaryFormat) {
+    AsyncTransactionLogSink sink(output, TransactionLogFormat::BINARY);
+    sink.write(makeTransaction(42, TransactionStatus::APPROVED));
+    sink.flush();
+
+    std::string bytes = output.str();
+    ASSERT_EQ(bytes.size(), sizeof(TransactionLogRecord));
+    TransactionLogRecord record;
+    std::memcpy(&record, bytes.data(), sizeof(record));
+    EXPECT_EQ(record.id, 42);
+    EXPECT_EQ(record.status, static_cast<int>(TransactionStatus::APPROVED));
+    EXPECT_EQ(record.amount, 25.5);
+    EXPECT_EQ(record.timestamp, 1700000000);
+}
+
+/// ===========================================================================
+/// Verifies: AsyncTransactionLogSink::write() & getDroppedCount()
+/// Test goal: A full ring drops records instead of blocking, and accounts for them
+/// In case: Burst far more records than the ring holds into a binary sink
+/// Method for Verification: Invariant written + dropped == submitted
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_write_Boundary_RingFull) {
+    const int submitted = 5000;
+    {
+        AsyncTransactionLogSink sink(output, TransactionLogFormat::BINARY, 4);
+        for (int i = 0; i < submitted; ++i) {
+            sink.write(makeTransaction(i, TransactionStatus::COMPLETED));
+        }
+        sink.flush();
+
+        std::size_t written = output.str().size() / sizeof(TransactionLogRecord);
+        EXPECT_EQ(written + sink.getDroppedCount(), static_cast<std::size_t>(submitted));
+    }
+}
+
+/// ===========================================================================
+/// Verifies: AsyncTransactionLogSink::flush()
+/// Test goal: A flush returns only after every record written before it has been written and flushed
+/// In case: 4 threads writing and flushing concurrently, so flushes overlap records still being published
+/// Method for Verification: Concurrency invariant
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_flush_Normal_ConcurrentWriters) {
+    const int threadCount = 4;
+    const int writesPerThread = 2000;
+    CountingStreamBuffer buffer;
+    std::ostream counted(&buffer);
+    AsyncTransactionLogSink sink(counted, TransactionLogFormat::BINARY, 1 << 15);
+    std::atomic<std::size_t> completedWrites{0};
+    std::atomic<int> missedFlushes{0};
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < threadCount; ++t) {
+        writers.emplace_back([&, t]() {
+            for (int i = 0; i < writesPerThread; ++i) {
+                sink.write(makeTransaction(t * writesPerThread + i, TransactionStatus::COMPLETED));
+                completedWrites.fetch_add(1, std::memory_order_acq_rel);
+                if (i % 50 == 0) {
+                    const std::size_t before = completedWrites.load(std::memory_order_acquire);
+                    sink.flush();
+                    if (buffer.flushedBytes.load(std::memory_order_acquire) / sizeof(TransactionLogRecord) < before) {
+                        missedFlushes.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& writer : writers) {
+        writer.join();
+    }
+
+    EXPECT_EQ(missedFlushes.load(), 0);
+    EXPECT_EQ(sink.getDroppedCount(), 0u);
+    sink.flush();
+    EXPECT_EQ(buffer.flushedBytes.load(), static_cast<std::size_t>(threadCount * writesPerThread) *
+                                              sizeof(TransactionLogRecord));
+}
+
+/// ===========================================================================
+/// Verifies: AsyncTransactionLogSink::~AsyncTransactionLogSink()
+/// Test goal: Destruction drains pending records
+/// In case: Write without flush, destroy the sink, inspect the stream
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_destructor_Normal_DrainsPending) {
+    {
+        AsyncTransactionLogSink sink(output, TransactionLogFormat::TEXT);
+        sink.write(makeTransaction(1, TransactionStatus::COMPLETED));
+    }
+    EXPECT_EQ(output.str(), "Transaction ID: 1 Status: 4\n");
+}
+
+// ============================================================================
+// Method: TransactionProcessor::setTransactionLogSink()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::setTransactionLogSink()
+/// Test goal: Accepted transactions go to the configured sink, not the console
+/// In case: Attach an async sink, process a deposit, capture stdout
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_setTransactionLogSink_Normal_Async) {
+    AsyncTransactionLogSink sink(output, TransactionLogFormat::TEXT);
+    TransactionProcessor sut;
+    sut.setTransactionLogSink(&sink);
+
+    ::testing::internal::CaptureStdout();
+    EXPECT_EQ(sut.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC", ""), TransactionStatus::COMPLETED);
+    std::string console = ::testing::internal::GetCapturedStdout();
+    sink.flush();
+
+    EXPECT_TRUE(console.empty());
+    EXPECT_THAT(output.str(), ::testing::HasSubstr(" Status: 4\n"));
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::setTransactionLogSink()
+/// Test goal: A null sink skips transaction log output entirely
+/// In case: Set nullptr, process a deposit, capture stdout
+/// Method for Verification: Output comparison
+/// ===========================================================================
+TEST_F(TransactionLogSinkUnitTest, SWE4_TransactionLogSink_setTransactionLogSink_Normal_Disabled) {
+    TransactionProcessor sut;
+    sut.setTransactionLogSink(nullptr);
+
+    ::testing::internal::CaptureStdout();
+    EXPECT_EQ(sut.processTransaction(TransactionType::DEPOSIT, 10.0, "SRC", ""), TransactionStatus::COMPLETED);
+    EXPECT_TRUE(::testing::internal::GetCapturedStdout().empty());
+    EXPECT_EQ(sut.getTransactionCount(), 1);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+#include "../inc/TransactionPolicy.hpp"
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class TransactionPolicyUnitTest : public ::testing::Test {
+protected:
+    TransactionProcessor sut;
+
+    void SetUp() override {
+        sut.setTransactionLogSink(nullptr);
+    }
+};
+
+// ============================================================================
+// Method: transactionRule()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: transactionRule() & TransactionPolicy
+/// Test goal: Each product sees its own caps and unknown enum values fall back to the catch-all rows
+/// In case: Default, BUSINESS and INVESTMENT rows, type 99, account type 42
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(TransactionPolicyUnitTest, SWE4_TransactionPolicy_transactionRule_Normal_ProductRows) {
+    static_assert(transactionRule(AccountType::BUSINESS, TransactionType::WITHDRAWAL).maxAmount == Money(250000.0),
+                  "the rules are available at compile time");
+
+    EXPECT_EQ(transactionRule(AccountType::SAVINGS, TransactionType::REFUND).maxAmount, Money(10000.0));
+    EXPECT_EQ(transactionRule(AccountType::BUSINESS, TransactionType::REFUND).maxAmount, Money(50000.0));
+    EXPECT_EQ(transactionRule(AccountType::INVESTMENT, TransactionType::WITHDRAWAL).maxAmount, Money(100000.0));
+    EXPECT_EQ(transactionRule(AccountType::INVESTMENT, TransactionType::DEPOSIT).maxAmount, Money(1000000.0));
+    EXPECT_EQ(transactionRule(AccountType::CHECKING, TransactionType::TRANSFER).handling, TransactionHandling::TRANSFER);
+
+    const TransactionRule& unknownType = transactionRule(AccountType::CHECKING, static_cast<TransactionType>(99));
+    EXPECT_EQ(unknownType.handling, TransactionHandling::UNSUPPORTED);
+    EXPECT_EQ(&transactionRule(static_cast<AccountType>(42), TransactionType::WITHDRAWAL),
+              &transactionRule(DEFAULT_TRANSACTION_PRODUCT, TransactionType::WITHDRAWAL));
+}
+
+// ============================================================================
+// Method: validateTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::validateTransaction()
+/// Test goal: The caps of the selected product apply, exactly at the cent
+/// In case: Each product cap and one cent above it
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionPolicyUnitTest, SWE4_TransactionPolicy_validateTransaction_Boundary_ProductCaps) {
+    EXPECT_TRUE(sut.validateTransaction(50000.0, TransactionType::WITHDRAWAL));
+    EXPECT_FALSE(sut.validateTransaction(50000.01, TransactionType::WITHDRAWAL));
+    EXPECT_TRUE(sut.validateTransaction(250000.0, TransactionType::WITHDRAWAL, AccountType::BUSINESS));
+    EXPECT_FALSE(sut.validateTransaction(250000.01, TransactionType::WITHDRAWAL, AccountType::BUSINESS));
+    EXPECT_TRUE(sut.validateTransaction(5000.0, TransactionType::REFUND, AccountType::INVESTMENT));
+    EXPECT_FALSE(sut.validateTransaction(5000.01, TransactionType::REFUND, AccountType::INVESTMENT));
+    EXPECT_FALSE(sut.validateTransaction(Money::fromCents(0), TransactionType::DEPOSIT, AccountType::BUSINESS));
+    EXPECT_FALSE(sut.validateTransaction(1000000.01, TransactionType::DEPOSIT, AccountType::BUSINESS));
+}
+
+// ============================================================================
+// Method: processTransaction() & processBatch()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & processBatch()
+/// Test goal: The product of the source account selects the caps on both paths
+/// In case: A withdrawal of 200000 from a CHECKING and from a BUSINESS source
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(TransactionPolicyUnitTest, SWE4_TransactionPolicy_processTransaction_Normal_ProductSelectsRules) {
+    EXPECT_EQ(sut.processTransaction(TransactionType::WITHDRAWAL, 200000.0, "SRC", ""), TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.processTransaction(TransactionType::WITHDRAWAL, 200000.0, "SRC", "", AccountType::BUSINESS),
+              TransactionStatus::COMPLETED);
+    EXPECT_EQ(sut.getDailyVolume(), 200000.0);
+
+    std::vector<TransactionRequest> batch = {
+        {TransactionType::WITHDRAWAL, 200000.0, "SRC", "", AccountType::CHECKING},
+        {TransactionType::WITHDRAWAL, 200000.0, "SRC", "", AccountType::BUSINESS},
+        {TransactionType::REFUND, 20000.0, "SRC", "", AccountType::BUSINESS},
+        {TransactionType::REFUND, 20000.0, "SRC", "", AccountType::INVESTMENT}
+    };
+    std::vector<TransactionStatus> statuses = sut.processBatch(batch);
+    EXPECT_EQ(statuses, (std::vector<TransactionStatus>{TransactionStatus::REJECTED, TransactionStatus::COMPLETED,
+                                                         TransactionStatus::COMPLETED, TransactionStatus::REJECTED}));
+    EXPECT_EQ(sut.getDailyVolume(), 400000.0);
+}
+
+// ============================================================================
+// Method: validateTransactionBatch()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::validateTransactionBatch()
+/// Test goal: Every kernel reads the same product table as validateTransaction
+/// In case: Each product and kernel, around every product cap, for double and Money amounts
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_F(TransactionPolicyUnitTest, SWE4_TransactionPolicy_validateTransactionBatch_Boundary_MatchesScalar) {
+    std::vector<double> amounts;
+    std::vector<Money> cents;
+    std::vector<TransactionType> types;
+    const double values[] = {0.0, 0.01, 5000.0, 5000.01, 10000.01, 50000.01, 100000.01, 250000.0, 250000.01};
+    for (int type = 0; type <= 4; ++type) {
+        for (double value : values) {
+            amounts.push_back(value);
+            cents.push_back(Money(value));
+            types.push_back(static_cast<TransactionType>(type));
+        }
+    }
+
+    const AccountType products[] = {AccountType::CHECKING, AccountType::SAVINGS,
+                                    AccountType::INVESTMENT, AccountType::BUSINESS};
+    const ValidationKernel kernels[] = {ValidationKernel::SCALAR, ValidationKernel::AVX2, ValidationKernel::NEON};
+    for (AccountType product : products) {
+        for (ValidationKernel kernel : kernels) {
+            std::vector<std::uint64_t> doubleMask((amounts.size() + 63) / 64);
+            std::vector<std::uint64_t> centMask((amounts.size() + 63) / 64);
+            TransactionProcessor::validateTransactionBatch(amounts.data(), types.data(), amounts.size(),
+                                                           doubleMask.data(), kernel, product);
+            TransactionProcessor::validateTransactionBatch(cents.data(), types.data(), cents.size(),
+                                                           centMask.data(), kernel, product);
+
+            for (std::size_t i = 0; i < amounts.size(); ++i) {
+                const bool expected = sut.validateTransaction(amounts[i], types[i], product);
+                EXPECT_EQ(((doubleMask[i / 64] >> (i % 64)) & 1ULL) != 0, expected)
+                    << "product " << static_cast<int>(product) << " position " << i;
+                EXPECT_EQ(((centMask[i / 64] >> (i % 64)) & 1ULL) != 0, expected)
+                    << "product " << static_cast<int>(product) << " position " << i;
+            }
+        }
+    }
+}
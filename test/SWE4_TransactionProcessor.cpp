@@ -1,23 +1,18 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
+#include <atomic>
+#include <cmath>
 #include <limits>
 #include <tuple>
 
 #include "../inc/TransactionProcessor.hpp"
 #include "../inc/ExternalServices.hpp"
+#include "../inc/ProcessingContext.hpp"
 
 using ::testing::NiceMock;
 using ::testing::Return;
 using ::testing::_;
 
-// ============================================================================
-// External Global Variables to reset State
-// ============================================================================
-
-extern int g_totalTransactionsProcessed;
-extern double g_totalVolumeProcessed;
-extern bool g_systemLocked;
-
 // ============================================================================
 // Mock Classes
 // ============================================================================
@@ -55,7 +50,7 @@ protected:
         // Reset global & static variables if needed for test isolation
         // Note: static counters like transactionCounter persist but we can reset limits
         sut.resetDailyLimits();
-        g_systemLocked = false;
+        ProcessingContext::global().systemLocked = false;
         
         ON_CALL(mockCompliance, checkComplianceLevel(_)).WillByDefault(Return(ComplianceLevel::LOW_RISK));
         ON_CALL(mockAudit, logTransaction(_, _, _)).WillByDefault(Return(true));
@@ -80,18 +75,25 @@ INSTANTIATE_TEST_SUITE_P(
         // Boundary: MIN_TRANSACTION_AMOUNT (0.01)
         std::make_tuple(0.009, TransactionType::DEPOSIT, false), // < MIN
         std::make_tuple(0.01, TransactionType::DEPOSIT, true),   // = MIN
+        std::make_tuple(std::nextafter(0.01, 0.0), TransactionType::DEPOSIT, false),
         
         // Boundary: MAX_TRANSACTION_AMOUNT (1000000.0)
         std::make_tuple(1000000.0, TransactionType::DEPOSIT, true),    // = MAX
         std::make_tuple(1000000.01, TransactionType::DEPOSIT, false),  // > MAX
+        std::make_tuple(1000000.0009, TransactionType::DEPOSIT, false),
+        std::make_tuple(std::nextafter(1000000.0, 1.0e300), TransactionType::DEPOSIT, false),
+        std::make_tuple(100.005, TransactionType::DEPOSIT, true),      // between cents, inside the bounds
         
         // Type specific: WITHDRAWAL limit 50,000.0
         std::make_tuple(50000.0, TransactionType::WITHDRAWAL, true),
         std::make_tuple(50000.01, TransactionType::WITHDRAWAL, false),
+        std::make_tuple(50000.00001, TransactionType::WITHDRAWAL, false),
+        std::make_tuple(std::nextafter(50000.0, 1.0e300), TransactionType::WITHDRAWAL, false),
         
         // Type specific: REFUND limit 10,000.0
         std::make_tuple(10000.0, TransactionType::REFUND, true),
         std::make_tuple(10000.01, TransactionType::REFUND, false),
+        std::make_tuple(std::nextafter(10000.0, 1.0e300), TransactionType::REFUND, false),
         
         // Normal bounds (Transfer, Deposit, etc)
         std::make_tuple(500000.0, TransactionType::TRANSFER, true),
@@ -168,7 +170,7 @@ INSTANTIATE_TEST_SUITE_P(
 TEST_P(ExecuteTransferParamTest, SWE4_TransactionProcessor_executeTransfer_MCDC) {
     auto [amt, src, dst, isUrg, sysLock, txToAdd, volToAdd, expectStatus] = GetParam();
     
-    g_systemLocked = sysLock;
+    ProcessingContext::global().systemLocked = sysLock;
     
     // Fill limits using processTransaction (since it pushes limits up)
     for (int i=0; i<txToAdd; ++i) {
@@ -189,7 +191,7 @@ TEST_P(ExecuteTransferParamTest, SWE4_TransactionProcessor_executeTransfer_MCDC)
     EXPECT_EQ(actualStatus, expectStatus);
     
     // Cleanup global state
-    g_systemLocked = false;
+    ProcessingContext::global().systemLocked = false;
 }
 
 // ============================================================================
@@ -353,6 +355,99 @@ TEST_F(TransactionProcessorUnitTest, SWE4_TransactionProcessor_processTransactio
     // That is tested in ProcessTransactionTypeParamTest already.
 }
 
+// ============================================================================
+// Method: processBatch()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processBatch()
+/// Test goal: Batch statuses equal sequential processTransaction statuses
+/// In case: Mixed valid/invalid/blocked requests run through both APIs
+/// Method for Verification: Comparison against sequential processing
+/// ===========================================================================
+TEST_F(TransactionProcessorUnitTest, SWE4_TransactionProcessor_processBatch_Normal_MatchesSequential) {
+    ON_CALL(mockCompliance, checkComplianceLevel("RISKY")).WillByDefault(Return(ComplianceLevel::HIGH_RISK));
+    ON_CALL(mockCompliance, checkComplianceLevel("BAD")).WillByDefault(Return(ComplianceLevel::BLOCKED));
+    
+    std::vector<TransactionRequest> batch = {
+        {TransactionType::DEPOSIT, 100.0, "SRC", ""},
+        {TransactionType::DEPOSIT, -5.0, "SRC", ""},
+        {TransactionType::WITHDRAWAL, 60000.0, "SRC", ""},
+        {TransactionType::TRANSFER, 60000.0, "RISKY", "DST"},
+        {TransactionType::TRANSFER, 100.0, "RISKY", "DST"},
+        {TransactionType::TRANSFER, 100.0, "BAD", "DST"},
+        {TransactionType::TRANSFER, 100.0, "SRC", "SRC"},
+        {TransactionType::REFUND, 500.0, "SRC", ""}
+    };
+    
+    TransactionProcessor sequential;
+    sequential.setComplianceService(&mockCompliance);
+    sequential.setAuditService(&mockAudit);
+    std::vector<TransactionStatus> expected;
+    for (const TransactionRequest& request : batch) {
+        expected.push_back(sequential.processTransaction(request.type, request.amount,
+                                                         request.sourceAccount, request.destAccount));
+    }
+    
+    std::vector<TransactionStatus> actual = sut.processBatch(batch);
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(sut.getTransactionCount(), sequential.getTransactionCount());
+    EXPECT_EQ(sut.getDailyVolume(), sequential.getDailyVolume());
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processBatch()
+/// Test goal: MAX_DAILY_TRANSACTIONS cuts off inside a batch like sequential calls
+/// In case: Batch of 1005 deposits, the last 5 exceed the daily limit
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionProcessorUnitTest, SWE4_TransactionProcessor_processBatch_Boundary_DailyLimit) {
+    std::vector<TransactionRequest> batch(1005, TransactionRequest{TransactionType::DEPOSIT, 1.0, "SRC", ""});
+    
+    std::vector<TransactionStatus> actual = sut.processBatch(batch);
+    ASSERT_EQ(actual.size(), batch.size());
+    EXPECT_EQ(actual[999], TransactionStatus::COMPLETED);
+    EXPECT_EQ(actual[1000], TransactionStatus::REJECTED);
+    EXPECT_EQ(actual[1004], TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.getTransactionCount(), 1000);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processBatch()
+/// Test goal: Compliance is queried once per distinct source, audit only for accepted rows
+/// In case: Three requests from one source, one invalid request from another
+/// Method for Verification: Interface call verification via mocks
+/// ===========================================================================
+TEST_F(TransactionProcessorUnitTest, SWE4_TransactionProcessor_processBatch_Normal_AmortizedServiceCalls) {
+    EXPECT_CALL(mockCompliance, checkComplianceLevel("SRC")).Times(1);
+    EXPECT_CALL(mockCompliance, checkComplianceLevel("OTHER")).Times(0);
+    EXPECT_CALL(mockAudit, logTransaction("SRC", _, _)).Times(3);
+    EXPECT_CALL(mockAudit, logAccountEvent("SRC", "TRANSACTION_PROCESSED", _)).Times(3);
+    
+    std::vector<TransactionRequest> batch = {
+        {TransactionType::DEPOSIT, 10.0, "SRC", ""},
+        {TransactionType::DEPOSIT, 0.0, "OTHER", ""},
+        {TransactionType::WITHDRAWAL, 20.0, "SRC", ""},
+        {TransactionType::TRANSFER, 30.0, "SRC", "DST"}
+    };
+    
+    std::vector<TransactionStatus> actual = sut.processBatch(batch.data(), batch.size());
+    EXPECT_EQ(actual[1], TransactionStatus::REJECTED);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processBatch()
+/// Test goal: Empty batch makes no service calls
+/// In case: Call processBatch with zero requests
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransactionProcessorUnitTest, SWE4_TransactionProcessor_processBatch_Boundary_Empty) {
+    EXPECT_CALL(mockCompliance, checkComplianceLevel(_)).Times(0);
+    EXPECT_CALL(mockAudit, logTransaction(_, _, _)).Times(0);
+    
+    EXPECT_TRUE(sut.processBatch(std::vector<TransactionRequest>{}).empty());
+}
+
 // ============================================================================
 // Method: Getters & Reset
 // ============================================================================
@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Stub Functions
+// ============================================================================
+
+// validateTransaction as it was written on doubles, the contract of the kernels for the default product
+static bool baselineValidateTransaction(double amount, TransactionType type) {
+    if (amount < 0.01) {
+        return false;
+    } else if (amount > 1000000.0) {
+        return false;
+    } else if (type == TransactionType::WITHDRAWAL && amount > 50000.0) {
+        return false;
+    } else if (type == TransactionType::REFUND && amount > 10000.0) {
+        return false;
+    } else {
+        return true;
+    }
+}
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class TransactionValidationKernelsUnitTest : public ::testing::TestWithParam<ValidationKernel> {
+protected:
+    TransactionProcessor reference;
+    std::vector<double> amounts;
+    std::vector<TransactionType> types;
+
+    void SetUp() override {
+        // Each boundary of validateTransaction plus its neighbouring doubles
+        const double boundaries[] = {0.01, 1000000.0, 50000.0, 10000.0, 0.0};
+        // Sub-cent amounts between the bounds are valid; those just past a bound are not
+        std::vector<double> values = {-1.0, -0.0, 500.0, 0.07, 0.009, 100.001, 100.005, 1000000.01,
+                                      1000000.0009, 50000.00001, 10000.000001,
+                                      std::numeric_limits<double>::infinity(),
+                                      -std::numeric_limits<double>::infinity(),
+                                      std::numeric_limits<double>::quiet_NaN()};
+        for (double boundary : boundaries) {
+            values.push_back(std::nextafter(boundary, -1.0e300));
+            values.push_back(boundary);
+            values.push_back(std::nextafter(boundary, 1.0e300));
+        }
+
+        const TransactionType allTypes[] = {TransactionType::DEPOSIT, TransactionType::WITHDRAWAL,
+                                            TransactionType::TRANSFER, TransactionType::REFUND,
+                                            static_cast<TransactionType>(99)};
+        for (TransactionType type : allTypes) {
+            for (double value : values) {
+                amounts.push_back(value);
+                types.push_back(type);
+            }
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(
+    SWE4_TransactionValidationKernels_Kernels,
+    TransactionValidationKernelsUnitTest,
+    ::testing::Values(ValidationKernel::SCALAR, ValidationKernel::AVX2, ValidationKernel::NEON)
+);
+
+// ============================================================================
+// Method: validateTransactionBatch()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::validateTransactionBatch()
+/// Test goal: Every kernel matches validateTransaction bit for bit at every boundary
+/// In case: Boundary grid over all types, including NaN, infinities and -0.0
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_P(TransactionValidationKernelsUnitTest, SWE4_TransactionValidationKernels_validateTransactionBatch_Boundary_MatchesScalar) {
+    std::vector<std::uint64_t> mask((amounts.size() + 63) / 64, ~0ULL);
+    TransactionProcessor::validateTransactionBatch(amounts.data(), types.data(), amounts.size(), mask.data(), GetParam());
+
+    for (std::size_t i = 0; i < amounts.size(); ++i) {
+        bool batchValid = ((mask[i / 64] >> (i % 64)) & 1ULL) != 0;
+        EXPECT_EQ(batchValid, reference.validateTransaction(amounts[i], types[i]))
+            << "position " << i << " amount " << amounts[i] << " type " << static_cast<int>(types[i]);
+        if (types[i] != static_cast<TransactionType>(99)) {
+            EXPECT_EQ(batchValid, baselineValidateTransaction(amounts[i], types[i]))
+                << "position " << i << " amount " << amounts[i] << " type " << static_cast<int>(types[i]);
+        }
+    }
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::validateTransactionBatch()
+/// Test goal: Tails shorter than a vector and bits past count are handled
+/// In case: Validate every prefix length from 0 to 9 of the grid
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_P(TransactionValidationKernelsUnitTest, SWE4_TransactionValidationKernels_validateTransactionBatch_Boundary_Tails) {
+    for (std::size_t count = 0; count < 10; ++count) {
+        std::uint64_t mask[2] = {~0ULL, ~0ULL};
+        TransactionProcessor::validateTransactionBatch(amounts.data() + 3, types.data() + 3, count, mask, GetParam());
+
+        std::uint64_t expected = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            expected |= static_cast<std::uint64_t>(reference.validateTransaction(amounts[i + 3], types[i + 3])) << i;
+        }
+        if (count > 0) {
+            EXPECT_EQ(mask[0], expected) << "count " << count;
+        }
+    }
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::validateTransactionBatch() (Money overload)
+/// Test goal: Every integer kernel matches validateTransaction on amounts in cents
+/// In case: Each bound in cents and its neighbours, the Money limits, all types, every tail length
+/// Method for Verification: Comparison against the scalar implementation
+/// ===========================================================================
+TEST_P(TransactionValidationKernelsUnitTest, SWE4_TransactionValidationKernels_validateTransactionBatch_Boundary_MoneyMatchesScalar) {
+    std::vector<Money> cents = {Money::min(), Money::max(), Money::fromCents(-1), Money(500.0)};
+    const std::int64_t boundaries[] = {1, 100000000, 5000000, 1000000, 0};
+    for (std::int64_t boundary : boundaries) {
+        cents.push_back(Money::fromCents(boundary - 1));
+        cents.push_back(Money::fromCents(boundary));
+        cents.push_back(Money::fromCents(boundary + 1));
+    }
+    std::vector<Money> centAmounts;
+    std::vector<TransactionType> centTypes;
+    for (std::size_t i = 0; i < types.size(); i += amounts.size() / 5) {
+        for (Money amount : cents) {
+            centAmounts.push_back(amount);
+            centTypes.push_back(types[i]);
+        }
+    }
+
+    for (std::size_t count = centAmounts.size() - 4; count <= centAmounts.size(); ++count) {
+        std::vector<std::uint64_t> mask((count + 63) / 64, ~0ULL);
+        TransactionProcessor::validateTransactionBatch(centAmounts.data(), centTypes.data(), count, mask.data(), GetParam());
+
+        for (std::size_t i = 0; i < count; ++i) {
+            bool batchValid = ((mask[i / 64] >> (i % 64)) & 1ULL) != 0;
+            EXPECT_EQ(batchValid, reference.validateTransaction(centAmounts[i], centTypes[i]))
+                << "position " << i << " amount " << centAmounts[i] << " type " << static_cast<int>(centTypes[i]);
+        }
+    }
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::getValidationKernel()
+/// Test goal: The runtime selection names a kernel that produces scalar results
+/// In case: Validate the grid with the default overload
+/// Method for Verification: Comparison against the scalar kernel
+/// ===========================================================================
+TEST_P(TransactionValidationKernelsUnitTest, SWE4_TransactionValidationKernels_getValidationKernel_Normal_DefaultMatches) {
+    std::vector<std::uint64_t> automatic((amounts.size() + 63) / 64);
+    std::vector<std::uint64_t> scalar((amounts.size() + 63) / 64);
+    TransactionProcessor::validateTransactionBatch(amounts.data(), types.data(), amounts.size(), automatic.data());
+    TransactionProcessor::validateTransactionBatch(amounts.data(), types.data(), amounts.size(), scalar.data(),
+                                                   ValidationKernel::SCALAR);
+    EXPECT_EQ(automatic, scalar);
+}
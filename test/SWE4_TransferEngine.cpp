@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/ConcurrentAccountManager.hpp"
+#include "../inc/ProcessingContext.hpp"
+#include "../inc/TransactionProcessor.hpp"
+#include "../inc/TransferEngine.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+// Fixture with two active accounts of 100.00 sharing one context with the processor
+class TransferEngineUnitTest : public ::testing::Test {
+protected:
+    ProcessingContext context;
+    ConcurrentAccountManager accounts{8};
+    TransactionProcessor processor;
+    TransferEngine sut{accounts, processor};
+    std::string source;
+    std::string destination;
+
+    std::string createActiveAccount(double balance, std::uint32_t ownerId) {
+        const std::string number = accounts.createAccount(AccountType::CHECKING, balance, ownerId);
+        accounts.verifyAccount(number, true);
+        return number;
+    }
+
+    void SetUp() override {
+        accounts.setProcessingContext(&context);
+        processor.setProcessingContext(&context);
+        processor.setTransactionLogSink(nullptr);
+        processor.setClock([]() { return static_cast<std::time_t>(1700000000); });
+        source = createActiveAccount(100.0, 1);
+        destination = createActiveAccount(100.0, 2);
+    }
+};
+
+// ============================================================================
+// Method: transfer()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer() & ConcurrentAccountManager::transferBalance()
+/// Test goal: A completed transfer moves the amount and keeps the managed total
+/// In case: Transfer 30.00 and then the whole remaining source balance
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Normal_MovesBalances) {
+    EXPECT_EQ(sut.transfer(30.0, source, destination), TransactionStatus::COMPLETED);
+    EXPECT_EQ(accounts.getAccountBalance(source), 70.0);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 130.0);
+    EXPECT_EQ(accounts.getTotalManagedBalance(), 200.0);
+
+    EXPECT_EQ(sut.transfer(70.0, source, destination), TransactionStatus::COMPLETED);
+    EXPECT_EQ(accounts.getAccountBalance(source), 0.0);
+    EXPECT_EQ(sut.getStats().completedCount, 2u);
+    EXPECT_EQ(context.systemTotalBalanceCents.load(), 20000);
+}
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer() & ConcurrentAccountManager::transferBalance()
+/// Test goal: A completed decision an account cannot honour is refused without moving money
+/// In case: Insufficient funds, an unverified destination, an unknown destination, a fractional cent
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Error_Refused) {
+    const std::string pending = accounts.createAccount(AccountType::CHECKING, 100.0, 3);
+
+    EXPECT_EQ(sut.transfer(100.01, source, destination), TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.transfer(10.0, source, pending), TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.transfer(10.0, source, "ACC999999"), TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.transfer(10.005, source, destination), TransactionStatus::REJECTED);
+
+    EXPECT_EQ(accounts.getAccountBalance(source), 100.0);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 100.0);
+    EXPECT_EQ(accounts.getAccountBalance(pending), 100.0);
+    EXPECT_EQ(sut.getStats().refusedCount, 4u);
+    EXPECT_EQ(sut.getStats().completedCount, 0u);
+    EXPECT_EQ(processor.getTransactionCount(), 0);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 0u);
+}
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer() & TransactionProcessor::processTransfer()
+/// Test goal: Engine transfers count against the daily transaction limit of the processor
+/// In case: 1000 completed transfers, then one more on the same day
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Boundary_DailyTransactionLimit) {
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(sut.transfer(0.01, source, destination), TransactionStatus::COMPLETED);
+    }
+    EXPECT_EQ(processor.getTransactionCount(), 1000);
+
+    EXPECT_EQ(sut.transfer(0.01, source, destination), TransactionStatus::REJECTED);
+    EXPECT_EQ(accounts.getAccountBalance(source), 90.0);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 110.0);
+    EXPECT_EQ(sut.getStats().completedCount, 1000u);
+    EXPECT_EQ(sut.getStats().declinedCount, 1u);
+    EXPECT_EQ(processor.getTransactionHistory().size(), 1000u);
+}
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer() & TransactionProcessor::processTransfer()
+/// Test goal: Engine transfers are validated against the TRANSFER amount bounds
+/// In case: A transfer just over 1,000,000.00 and one of 5,000,000.00 from a rich account
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Boundary_OverTransferMaximum) {
+    const std::string rich = createActiveAccount(6000000.0, 3);
+
+    EXPECT_EQ(sut.transfer(1000000.01, rich, destination), TransactionStatus::REJECTED);
+    EXPECT_EQ(sut.transfer(5000000.0, rich, destination), TransactionStatus::REJECTED);
+    EXPECT_EQ(accounts.getAccountBalance(rich), 6000000.0);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 100.0);
+    EXPECT_EQ(sut.getStats().declinedCount, 2u);
+
+    EXPECT_EQ(sut.transfer(1000000.0, rich, destination), TransactionStatus::COMPLETED);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 1000100.0);
+}
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer()
+/// Test goal: Only a COMPLETED decision of the processor moves money
+/// In case: Same-account transfer, and a transfer while the system is locked
+/// Method for Verification: Equivalence class partitioning
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Normal_PolicyDeclined) {
+    EXPECT_EQ(sut.transfer(10.0, source, source), TransactionStatus::REJECTED);
+
+    context.systemLocked.store(true);
+    EXPECT_EQ(sut.transfer(10.0, source, destination), TransactionStatus::PENDING);
+    EXPECT_EQ(sut.transfer(10.0, source, destination, true), TransactionStatus::APPROVED);
+    context.systemLocked.store(false);
+
+    EXPECT_EQ(accounts.getAccountBalance(source), 100.0);
+    EXPECT_EQ(accounts.getAccountBalance(destination), 100.0);
+    EXPECT_EQ(sut.getStats().declinedCount, 3u);
+    EXPECT_EQ(sut.getStats().refusedCount, 0u);
+}
+
+/// ===========================================================================
+/// Verifies: TransferEngine::transfer() & ConcurrentAccountManager::getTotalManagedBalance()
+/// Test goal: Concurrent transfers through one hot account conserve money and never overdraw
+/// In case: 4 threads moving 1.00 in both directions between their own account and a hot account,
+///          while another thread samples the managed total
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(TransferEngineUnitTest, SWE4_TransferEngine_transfer_Normal_ConcurrentInvariant) {
+    const int THREADS = 4;
+    const int ROUNDS = 500;
+    std::vector<std::string> own;
+    for (int t = 0; t < THREADS; ++t) {
+        own.push_back(createActiveAccount(5.0, static_cast<std::uint32_t>(10 + t)));
+    }
+    const double total = accounts.getTotalManagedBalance();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < ROUNDS; ++i) {
+                sut.transfer(1.0, own[t], source);
+                sut.transfer(1.0, source, own[t]);
+                sut.transfer(1.0, destination, own[t]);
+                sut.transfer(1.0, own[t], destination);
+            }
+        });
+    }
+    bool totalConstant = true;
+    for (int i = 0; i < 200; ++i) {
+        totalConstant = totalConstant && accounts.getTotalManagedBalance() == total;
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_TRUE(totalConstant);
+    EXPECT_EQ(accounts.getTotalManagedBalance(), total);
+    double sum = accounts.getAccountBalance(source) + accounts.getAccountBalance(destination);
+    for (const std::string& number : own) {
+        EXPECT_GE(accounts.getAccountBalance(number), 0.0);
+        sum += accounts.getAccountBalance(number);
+    }
+    EXPECT_EQ(sum, total);
+    const TransferEngineStats stats = sut.getStats();
+    EXPECT_EQ(stats.completedCount + stats.refusedCount + stats.declinedCount,
+              static_cast<std::size_t>(4 * THREADS * ROUNDS));
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <ctime>
+#include <string>
+
+#include "../inc/TransactionProcessor.hpp"
+#include "../inc/WindowedRateLimiter.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class WindowedRateLimiterUnitTest : public ::testing::Test {
+protected:
+    // Start of an hour, so bucket boundaries fall on round offsets
+    const std::time_t start = static_cast<std::time_t>(1700000000 / 3600) * 3600;
+    std::time_t now = start;
+
+    WindowedRateLimiter::Clock fakeClock() {
+        return [this]() { return now; };
+    }
+};
+
+// ============================================================================
+// Method: tryAcquire()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: WindowedRateLimiter::tryAcquire()
+/// Test goal: The window slides bucket by bucket instead of resetting all at once
+/// In case: One-hour window in four buckets, three transactions allowed, counted in two buckets
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_tryAcquire_Boundary_SlidingWindow) {
+    WindowedRateLimiter sut(3600, 4, 3, 1000000.0, fakeClock());
+
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 10, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 900, 100));
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 901, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start + 901, 100));
+
+    // Still inside the window of the first bucket
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 3599, 100));
+    // The first bucket slides out, the one of start + 900 stays
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 3600, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 3601, 100));
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 3602, 100));
+    // A late transaction counts against the newest bucket
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start, 100));
+}
+
+/// ===========================================================================
+/// Verifies: WindowedRateLimiter::tryAcquire() & release()
+/// Test goal: The volume limit binds and a released transaction frees its count and volume
+/// In case: Volume limit 500.00, transactions of 300.00 and 250.00
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_release_Normal_VolumeGivenBack) {
+    WindowedRateLimiter sut(86400, 24, 10, 500.0, fakeClock());
+
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start, 30000));
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 1, 25000));
+    EXPECT_EQ(sut.getRemainingRequests("ACC1"), 9);
+
+    sut.release("ACC1", start, 30000);
+    EXPECT_EQ(sut.getRemainingRequests("ACC1"), 10);
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 2, 25000));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 3, 25000));
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 4, 1));
+    sut.release("ACC9", start, 1);
+}
+
+/// ===========================================================================
+/// Verifies: WindowedRateLimiter::release()
+/// Test goal: A release comes out of the bucket of its own timestamp, not the newest one
+/// In case: Transactions in the first and second of four 15-minute buckets, the first one released,
+///          then the first bucket slides out
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_release_Boundary_OwnBucket) {
+    WindowedRateLimiter sut(3600, 4, 3, 1000000.0, fakeClock());
+
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 900, 100));
+    sut.release("ACC1", start, 100);
+
+    // Only the transaction of start + 900 is still in the window
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 3600, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC1", start + 3601, 100));
+    EXPECT_FALSE(sut.tryAcquire("ACC1", start + 3602, 100));
+
+    // A late transaction counted in the newest bucket is found walking forward from its own
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start + 900, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start, 100));
+    sut.release("ACC2", start, 100);
+    sut.release("ACC2", start + 900, 100);
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start + 901, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start + 902, 100));
+    EXPECT_TRUE(sut.tryAcquire("ACC2", start + 903, 100));
+    EXPECT_FALSE(sut.tryAcquire("ACC2", start + 904, 100));
+}
+
+// ============================================================================
+// Method: evictIdle()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: WindowedRateLimiter::evictIdle() & tryAcquire()
+/// Test goal: Idle accounts are swept, so the tracked accounts stay bounded by the active ones
+/// In case: 5000 accounts once each, then 5000 new accounts a full window later
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_evictIdle_Normal_BoundedAccounts) {
+    WindowedRateLimiter sut(60, 6, 5, 1000.0, fakeClock());
+    for (int i = 0; i < 5000; ++i) {
+        ASSERT_TRUE(sut.tryAcquire("ACC" + std::to_string(i), now, 1));
+    }
+    EXPECT_EQ(sut.size(), 5000u);
+
+    now += 60;
+    for (int i = 5000; i < 10000; ++i) {
+        ASSERT_TRUE(sut.tryAcquire("ACC" + std::to_string(i), now, 1));
+    }
+    EXPECT_LT(sut.size(), 10000u);
+
+    now += 60;
+    EXPECT_GT(sut.evictIdle(), 0u);
+    EXPECT_EQ(sut.size(), 0u);
+}
+
+// ============================================================================
+// Class: RateLimitingService
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: WindowedRateLimiter::checkRateLimit() & incrementRateCounter() & resetRateLimits() & getRemainingRequests()
+/// Test goal: The RateLimitingService calls count at the clock time
+/// In case: Two requests allowed, two increments, reset
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_RateLimitingService_Normal_Calls) {
+    WindowedRateLimiter sut(60, 1, 2, 1000.0, fakeClock());
+    RateLimitingService& service = sut;
+
+    EXPECT_TRUE(service.checkRateLimit("ACC1"));
+    EXPECT_EQ(service.getRemainingRequests("ACC1"), 2);
+    EXPECT_TRUE(service.incrementRateCounter("ACC1"));
+    EXPECT_TRUE(service.incrementRateCounter("ACC1"));
+    EXPECT_FALSE(service.incrementRateCounter("ACC1"));
+    EXPECT_FALSE(service.checkRateLimit("ACC1"));
+    EXPECT_EQ(service.getRemainingRequests("ACC1"), 0);
+
+    service.resetRateLimits("ACC1");
+    EXPECT_EQ(service.getRemainingRequests("ACC1"), 2);
+    now += 60;
+    EXPECT_TRUE(service.incrementRateCounter("ACC1"));
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & setClock() & getTransactionCount()
+/// Test goal: The daily limits roll over at the day boundary without resetDailyLimits
+/// In case: Daily transaction limit reached just before midnight, next deposit just after it
+/// Method for Verification: Boundary value analysis
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_processTransaction_Boundary_DayRollover) {
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    const std::time_t midnight = (start / 86400 + 1) * 86400;
+    now = midnight - 1;
+    processor.setClock(fakeClock());
+
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 1.0, "SRC", ""), TransactionStatus::COMPLETED);
+    }
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 1.0, "SRC", ""), TransactionStatus::REJECTED);
+
+    now = midnight;
+    EXPECT_EQ(processor.getTransactionCount(), 0);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 1.0, "SRC", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.getTransactionCount(), 1);
+    EXPECT_EQ(processor.getDailyVolume(), 1.0);
+}
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction() & setAccountLimiter()
+/// Test goal: Per-account limits reject one account without affecting others, and refused transactions are given back
+/// In case: One transaction per account and window; a same-account transfer rejected after reservation
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(WindowedRateLimiterUnitTest, SWE4_WindowedRateLimiter_processTransaction_Normal_AccountLimits) {
+    WindowedRateLimiter limiter(86400, 24, 1, 1000000.0, fakeClock());
+    TransactionProcessor processor;
+    processor.setTransactionLogSink(nullptr);
+    processor.setClock(fakeClock());
+    processor.setAccountLimiter(&limiter);
+
+    EXPECT_EQ(processor.processTransaction(TransactionType::TRANSFER, 10.0, "ACC1", "ACC1"), TransactionStatus::REJECTED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC1", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC1", ""), TransactionStatus::REJECTED);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC2", ""), TransactionStatus::COMPLETED);
+    EXPECT_EQ(processor.getTransactionCount(), 2);
+
+    processor.setAccountLimiter(nullptr);
+    EXPECT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, "ACC1", ""), TransactionStatus::COMPLETED);
+}
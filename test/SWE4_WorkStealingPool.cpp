@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../inc/WorkStealingPool.hpp"
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class WorkStealingPoolUnitTest : public ::testing::Test {
+protected:
+    WorkStealingPool sut{4};
+};
+
+// ============================================================================
+// Method: run()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: WorkStealingPool::run() & getThreadCount()
+/// Test goal: Every index runs exactly once per run, across repeated runs and a throwing call
+/// In case: 50 runs of 0, 1 and 1000 calls on 4 threads, one call throwing, which run rethrows
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(WorkStealingPoolUnitTest, SWE4_WorkStealingPool_run_Normal_EachIndexOnce) {
+    EXPECT_EQ(sut.getThreadCount(), 4u);
+    sut.run(0, [](std::size_t) { FAIL() << "no call expected"; });
+
+    for (int round = 0; round < 50; ++round) {
+        std::vector<std::atomic<int>> calls(1000);
+        EXPECT_THROW(sut.run(calls.size(), [&calls](std::size_t index) {
+            calls[index].fetch_add(1);
+            if (index == 7) {
+                throw 7;
+            }
+        }), int);
+        for (std::size_t i = 0; i < calls.size(); ++i) {
+            ASSERT_EQ(calls[i].load(), 1) << "round " << round << " index " << i;
+        }
+
+        int single = 0;
+        sut.run(1, [&single](std::size_t index) { single += static_cast<int>(index) + 1; });
+        ASSERT_EQ(single, 1);
+    }
+}
+
+/// ===========================================================================
+/// Verifies: WorkStealingPool::run() & getStolenCount()
+/// Test goal: Idle workers steal the calls queued behind a slow call
+/// In case: 2 threads, 10 calls, the first one sleeping 50 ms
+/// Method for Verification: Control flow analysis (C0/C1/C2 coverage)
+/// ===========================================================================
+TEST_F(WorkStealingPoolUnitTest, SWE4_WorkStealingPool_run_Boundary_StealsBehindSlowTask) {
+    WorkStealingPool pool(2);
+    std::atomic<int> done(0);
+    pool.run(10, [&done](std::size_t index) {
+        if (index == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        }
+        done.fetch_add(1);
+    });
+    EXPECT_EQ(done.load(), 10);
+    EXPECT_GT(pool.getStolenCount(), 0u);
+}
+
+/// ===========================================================================
+/// Verifies: WorkStealingPool::run()
+/// Test goal: The first exception of a run reaches its caller after every call returned
+/// In case: 100 calls, each tenth throwing std::runtime_error, followed by a run that does not throw
+/// Method for Verification: Error guessing
+/// ===========================================================================
+TEST_F(WorkStealingPoolUnitTest, SWE4_WorkStealingPool_run_Error_RethrowsTaskException) {
+    std::atomic<int> calls{0};
+    try {
+        sut.run(100, [&calls](std::size_t index) {
+            calls.fetch_add(1);
+            if (index % 10 == 0) {
+                throw std::runtime_error("task " + std::to_string(index));
+            }
+        });
+        FAIL() << "run did not rethrow";
+    } catch (const std::runtime_error& error) {
+        EXPECT_EQ(std::string(error.what()).compare(0, 5, "task "), 0);
+    }
+    EXPECT_EQ(calls.load(), 100);
+
+    EXPECT_NO_THROW(sut.run(10, [&calls](std::size_t) { calls.fetch_add(1); }));
+    EXPECT_EQ(calls.load(), 110);
+}
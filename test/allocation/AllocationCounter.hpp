@@ -0,0 +1,10 @@
+#ifndef ALLOCATION_COUNTER_HPP
+#define ALLOCATION_COUNTER_HPP
+
+/// @brief Retrieves the number of allocations made through any form of operator new so far.
+/// @details Counted by replacements of the plain, array, nothrow and aligned forms, which are
+///          linked into run_allocation_tests only, so run_tests keeps the default allocator.
+/// @return The allocation count of the process.
+long allocationCount();
+
+#endif // ALLOCATION_COUNTER_HPP
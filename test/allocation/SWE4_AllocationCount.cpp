@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "AllocationCounter.hpp"
+#include "../../inc/ExternalServices.hpp"
+#include "../../inc/TransactionProcessor.hpp"
+
+// ============================================================================
+// Stub audit service consuming the entry views without copying them
+// ============================================================================
+
+class ViewAuditLoggingService : public AuditLoggingService {
+public:
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+
+    bool logTransaction(const std::string&, const std::string&, const std::string&) override { return true; }
+    bool logAccountEvent(const std::string&, const std::string&, const std::string&) override { return true; }
+    std::vector<std::string> getAuditTrail(const std::string&) override { return {}; }
+    bool archiveAuditLogs(const std::string&) override { return true; }
+
+    bool logTransactionEntry(const AuditEntry& entry) override {
+        entries++;
+        bytes += entry.accountNumber.size() + entry.transactionDetails.size() + entry.eventDetails.size();
+        return true;
+    }
+};
+
+// ============================================================================
+// Test Fixture Class for normal individual tests
+// ============================================================================
+
+class AllocationCountUnitTest : public ::testing::Test {
+protected:
+    ViewAuditLoggingService audit;
+    TransactionProcessor processor;
+
+    void SetUp() override {
+        processor.setTransactionLogSink(nullptr);
+        processor.setAuditService(&audit);
+    }
+};
+
+// ============================================================================
+// Method: allocationCount()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: allocationCount()
+/// Test goal: Every form of operator new is counted, so no allocation escapes the checks below
+/// In case: Plain, array, nothrow and over-aligned allocations
+/// Method for Verification: Invariant check
+/// ===========================================================================
+TEST_F(AllocationCountUnitTest, SWE4_AllocationCount_allocationCount_Normal_AllForms) {
+    struct alignas(64) Line {
+        char bytes[64];
+    };
+
+    const long before = allocationCount();
+    delete new int(1);
+    delete[] new int[4];
+    delete new (std::nothrow) int(2);
+    delete[] new (std::nothrow) int[4];
+    Line* line = new Line;
+    EXPECT_EQ(reinterpret_cast<std::size_t>(line) % alignof(Line), 0u);
+    delete line;
+    delete[] new Line[2];
+    delete new (std::nothrow) Line;
+    delete[] new (std::nothrow) Line[2];
+
+    EXPECT_EQ(allocationCount() - before, 8);
+}
+
+// ============================================================================
+// Method: TransactionProcessor::processTransaction()
+// ============================================================================
+
+/// ===========================================================================
+/// Verifies: TransactionProcessor::processTransaction()
+/// Test goal: Accepted transactions allocate nothing once accounts are interned and buffers are warm
+/// In case: Deposits with a view-consuming audit service and no log sink
+/// Method for Verification: Allocation counting through the replaced operator new
+/// ===========================================================================
+TEST_F(AllocationCountUnitTest, SWE4_AllocationCount_processTransaction_Normal_ZeroAllocations) {
+    const std::string source = "ACC500001";
+    const std::string destination = "ACC500002";
+
+    // Warm-up: interns both accounts and sizes the audit scratch
+    ASSERT_EQ(processor.processTransaction(TransactionType::DEPOSIT, 10.0, source, destination),
+              TransactionStatus::COMPLETED);
+
+    const long before = allocationCount();
+    for (int i = 0; i < 500; ++i) {
+        processor.processTransaction(TransactionType::DEPOSIT, 10.0 + i, source, destination);
+    }
+    const long allocations = allocationCount() - before;
+
+    EXPECT_EQ(allocations, 0);
+    EXPECT_EQ(audit.entries, 501u);
+    EXPECT_EQ(processor.getTransactionCount(), 501);
+}